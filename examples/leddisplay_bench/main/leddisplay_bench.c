@@ -0,0 +1,248 @@
+/* *********************************************************************************************** */
+/* leddisplay benchmark
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+/* *********************************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <esp_log.h>
+#include <esp_system.h>
+#include <soc/rtc.h>
+#include <xtensa/hal.h>
+
+#include <leddisplay.h>
+
+/* *********************************************************************************************** */
+
+// local logging
+#define LOGNAME "leddisplay_bench"
+#define ERROR(fmt, ...)   ESP_LOGE(LOGNAME, fmt, ## __VA_ARGS__)
+#define WARNING(fmt, ...) ESP_LOGW(LOGNAME, fmt, ## __VA_ARGS__)
+#define INFO(fmt, ...)    ESP_LOGI(LOGNAME, fmt, ## __VA_ARGS__)
+#define DEBUG(fmt, ...)   ESP_LOGD(LOGNAME, fmt, ## __VA_ARGS__)
+#define TRACE(fmt, ...)   ESP_LOGV(LOGNAME, fmt, ## __VA_ARGS__)
+
+// useful macros
+#define MS2TICKS(ms)              ((ms) / portTICK_PERIOD_MS)
+#define osSleep(ms)               vTaskDelay(MS2TICKS(ms));
+#define NUMOF(x)                  (sizeof(x)/sizeof(*(x)))
+
+// number of runs for each benchmark
+#define BENCH_RUNS 50
+
+// the configuration (for the results table)
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT
+#  define BENCH_CORR "strict"
+#elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+#  define BENCH_CORR "modified"
+#else
+#  define BENCH_CORR "none"
+#endif
+
+/* *********************************************************************************************** */
+
+// forward declarations
+static void sLeddisplayBenchTask(void *pParam);
+
+void app_main(void)
+{
+    osSleep(2000);
+
+    BaseType_t res = xTaskCreatePinnedToCore(
+        sLeddisplayBenchTask, "leddisplay_bench", 8192 / sizeof(StackType_t), NULL, 10, NULL, 1);
+    assert(res == pdPASS);
+}
+
+/* *********************************************************************************************** */
+
+// results of one benchmark
+typedef struct BENCH_s
+{
+    const char *name;
+    uint32_t    n;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    sum;
+} BENCH_t;
+
+static void sBenchInit(BENCH_t *pBench, const char *name)
+{
+    memset(pBench, 0, sizeof(*pBench));
+    pBench->name = name;
+    pBench->min = UINT32_MAX;
+}
+
+static void sBenchAdd(BENCH_t *pBench, const uint32_t cycles)
+{
+    pBench->n++;
+    pBench->sum += cycles;
+    if (cycles < pBench->min) { pBench->min = cycles; }
+    if (cycles > pBench->max) { pBench->max = cycles; }
+}
+
+static int sCpuMhz;
+
+// print CSV header (lines starting with "bench," can be grep'ed from the monitor output)
+static void sBenchHeader(void)
+{
+    printf("bench,test,width,height,depth,corr,buffers,cpu_mhz,n,min_cycles,avg_cycles,max_cycles,avg_us\r\n");
+}
+
+static void sBenchPrint(const BENCH_t *pBench)
+{
+    const uint32_t avg = pBench->n > 0 ? (pBench->sum / pBench->n) : 0;
+    printf("bench,%s,%d,%d,%d,%s,%d,%d,%u,%u,%u,%u,%u\r\n",
+        pBench->name, LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT, CONFIG_LEDDISPLAY_COLOR_DEPTH, BENCH_CORR,
+        CONFIG_LEDDISPLAY_NUM_FRAME_BUFFERS, sCpuMhz, pBench->n, pBench->n > 0 ? pBench->min : 0, avg,
+        pBench->max, avg / sCpuMhz);
+}
+
+// fill frame with "random" (but reproducible) content, only every n-th pixel is lit
+static void sFrameRandom(leddisplay_frame_t *pFrame, const int every)
+{
+    static uint32_t sRnd = 12345;
+    leddisplay_frame_clear(pFrame);
+    for (int ix = 0; ix < NUMOF(pFrame->ix); ix += every)
+    {
+        sRnd = (sRnd * 1103515245) + 12345;
+        pFrame->ix[ix][0] = sRnd >> 8;
+        pFrame->ix[ix][1] = sRnd >> 16;
+        pFrame->ix[ix][2] = sRnd >> 24;
+    }
+}
+
+// a frame based update of the display for run 0..BENCH_RUNS-1 of a benchmark
+typedef void (*BENCH_UPDATE_t)(leddisplay_frame_t *pFrame, const int run);
+
+static void sFrameUpdate(leddisplay_frame_t *pFrame, const int run)
+{
+    (void)run;
+    leddisplay_frame_update(pFrame);
+}
+
+// the pixel updated by sFrameUpdateRect1x1()
+static void sFrameRect1x1(const int run, uint16_t *pX, uint16_t *pY)
+{
+    *pX = run % LEDDISPLAY_WIDTH;
+    *pY = run % LEDDISPLAY_HEIGHT;
+}
+
+static void sFrameUpdateRect1x1(leddisplay_frame_t *pFrame, const int run)
+{
+    uint16_t x, y;
+    sFrameRect1x1(run, &x, &y);
+    leddisplay_frame_update_rect(pFrame, x, y, 1, 1);
+}
+
+// benchmark a frame based update (e.g. leddisplay_frame_update()) for a given content, the time
+// waiting for a free frame buffer (see leddisplay_get_stats()) is not included
+static void sBenchFrameUpdate(const char *name, leddisplay_frame_t *pFrame, BENCH_UPDATE_t update)
+{
+    BENCH_t bench;
+    sBenchInit(&bench, name);
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        leddisplay_stats_t stats0;
+        leddisplay_stats_t stats1;
+        leddisplay_get_stats(&stats0);
+        const uint32_t t0 = xthal_get_ccount();
+        update(pFrame, run);
+        const uint32_t t1 = xthal_get_ccount();
+        leddisplay_get_stats(&stats1);
+        const uint32_t blocked = (stats1.blocked_time - stats0.blocked_time) * sCpuMhz;
+        sBenchAdd(&bench, (t1 - t0) > blocked ? (t1 - t0) - blocked : 0);
+    }
+    sBenchPrint(&bench);
+}
+
+static void sLeddisplayBenchTask(void *pParam)
+{
+    static leddisplay_frame_t sFrame;
+
+    rtc_cpu_freq_config_t cpuCfg;
+    rtc_clk_cpu_freq_get_config(&cpuCfg);
+    sCpuMhz = cpuCfg.freq_mhz;
+
+    if (leddisplay_init() != ESP_OK)
+    {
+        ERROR("init fail");
+        vTaskDelete(NULL);
+        return;
+    }
+
+    sBenchHeader();
+    BENCH_t bench;
+
+    // pixel based API: set one pixel
+    sBenchInit(&bench, "pixel_xy_rgb");
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
+        {
+            for (uint16_t x = 0; x < LEDDISPLAY_WIDTH; x += 7)
+            {
+                const uint32_t t0 = xthal_get_ccount();
+                leddisplay_pixel_xy_rgb(x, y, x * 4, y * 4, run * 5);
+                const uint32_t t1 = xthal_get_ccount();
+                sBenchAdd(&bench, t1 - t0);
+            }
+        }
+    }
+    sBenchPrint(&bench);
+
+    // pixel based API: fill display
+    sBenchInit(&bench, "pixel_fill_rgb");
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        const uint32_t t0 = xthal_get_ccount();
+        leddisplay_pixel_fill_rgb(run * 5, 255 - (run * 5), 128);
+        const uint32_t t1 = xthal_get_ccount();
+        sBenchAdd(&bench, t1 - t0);
+    }
+    sBenchPrint(&bench);
+    leddisplay_pixel_update(1);
+
+    // frame based API: random, solid and sparse content
+    sFrameRandom(&sFrame, 1);
+    sBenchFrameUpdate("frame_update_random", &sFrame, sFrameUpdate);
+    leddisplay_frame_fill_rgb(&sFrame, 255, 128, 0);
+    sBenchFrameUpdate("frame_update_solid", &sFrame, sFrameUpdate);
+    sFrameRandom(&sFrame, 20);
+    sBenchFrameUpdate("frame_update_sparse", &sFrame, sFrameUpdate);
+
+    // frame based API: incremental update of one pixel (set in the frame beforehand, the time
+    // to render the rows doesn't depend on the content)
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        uint16_t x, y;
+        sFrameRect1x1(run, &x, &y);
+        leddisplay_frame_xy_rgb(&sFrame, x, y, 255, 255, 255);
+    }
+    sBenchFrameUpdate("frame_update_rect_1x1", &sFrame, sFrameUpdateRect1x1);
+
+    // driver info
+    leddisplay_stats_t stats;
+    leddisplay_get_stats(&stats);
+    printf("info,refresh_rate,lsb_msb_transition_bit,dma_total_bytes,encode_time_max_us,ring_rows,ring_underruns,ring_lead_min\r\n");
+    printf("info,%d,%d,%u,%u,%d,%u,%d\r\n", stats.refresh_rate, stats.lsb_msb_transition_bit,
+        stats.dma_total_bytes, stats.encode_time_max, stats.ring_rows, stats.ring_underruns, stats.ring_lead_min);
+    printf("bench,done\r\n");
+
+    leddisplay_shutdown();
+    vTaskDelete(NULL);
+}
+
+/* *********************************************************************************************** */
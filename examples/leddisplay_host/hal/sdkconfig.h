@@ -0,0 +1,28 @@
+// configuration for the host build, override using "make CONFIG=..." (see README.md)
+#ifndef __SDKCONFIG_H__
+#define __SDKCONFIG_H__
+
+#if !(CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN || CONFIG_LEDDISPLAY_TYPE_32X16_8SCAN || \
+      CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN || CONFIG_LEDDISPLAY_TYPE_32X32_16SCAN || \
+      CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN || CONFIG_LEDDISPLAY_TYPE_64X32_16SCAN || \
+      CONFIG_LEDDISPLAY_TYPE_64X64_32SCAN)
+#  define CONFIG_LEDDISPLAY_TYPE_64X32_16SCAN 1
+#endif
+
+#if !(CONFIG_LEDDISPLAY_CORR_BRIGHT_NONE || CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || \
+      CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED)
+#  define CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED 1
+#endif
+
+#ifndef CONFIG_LEDDISPLAY_COLOR_DEPTH
+#  define CONFIG_LEDDISPLAY_COLOR_DEPTH 8
+#endif
+
+#ifndef CONFIG_LEDDISPLAY_CHAIN_LENGTH
+#  define CONFIG_LEDDISPLAY_CHAIN_LENGTH 1
+#endif
+#ifndef CONFIG_LEDDISPLAY_CHAIN_ROWS
+#  define CONFIG_LEDDISPLAY_CHAIN_ROWS 1
+#endif
+
+#endif // __SDKCONFIG_H__
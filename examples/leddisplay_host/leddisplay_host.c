@@ -0,0 +1,766 @@
+/* *********************************************************************************************** */
+/* leddisplay frame buffer encoder on the host
+
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+/* *********************************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sdkconfig.h>
+#include <leddisplay.h>
+#include <leddisplay_anim.h>
+
+#include "val2pwm.h"
+#include "leddisplay_enc.h"
+
+/* *********************************************************************************************** */
+
+#define NUMOF(x) ((int)(sizeof(x)/sizeof(*(x))))
+
+// number of runs for each benchmark
+#define BENCH_RUNS 200
+
+// the configuration (for the results table)
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT
+#  define BENCH_CORR "strict"
+#elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+#  define BENCH_CORR "modified"
+#else
+#  define BENCH_CORR "none"
+#endif
+
+// the simulated DMA buffer (frame buffer memory, the frame based encoder writes all dithering
+// sub-frames) and control bits templates
+static frame_t     sDmaBuf[DITHER_FRAMES];
+static frame_t     sDmaBuf2;
+static ctrl_bits_t sCtrl;
+
+// the PWM value that the encoder is expected to produce for a colour value
+static uint8_t sExpectedPwm(const uint8_t val)
+{
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    return val2pwm_bits(val, COLOR_DEPTH_BITS);
+#else
+    return val >> (8 - COLOR_DEPTH_BITS);
+#endif
+}
+
+// the PWM value that the frame based encoder is expected to produce for a colour value in a
+// dithering sub-frame (-1 = not dithered), this is intentionally not using the order and phases
+// from leddisplay_enc.c
+static uint8_t sExpectedPwmSub(const uint8_t val, const int row, const int x, const int sub)
+{
+#if DITHER_FRAMES > 1
+    if (sub >= 0)
+    {
+#  if DITHER_FRAMES == 4
+        const int phase = (x % 2) + ((row % 2) * 2);
+        const int orders[] = { 0, 2, 1, 3 };
+#  else
+        const int phase = (x + row) % 2;
+        const int orders[] = { 0, 1 };
+#  endif
+        const int order = orders[(phase + sub) % DITHER_FRAMES];
+        const int sum = val2pwm_dither_bits(val, COLOR_DEPTH_BITS, DITHER_FRAMES);
+        return (sum / DITHER_FRAMES) + ((sum % DITHER_FRAMES) > order ? 1 : 0);
+    }
+#else
+    (void)row;
+    (void)x;
+    (void)sub;
+#endif
+    return sExpectedPwm(val);
+}
+
+// the control signals (LAT, OE, A..E) that the encoder is expected to produce, this is
+// intentionally not using the templates from leddisplay_enc_ctrl_bits()
+static uint16_t sExpectedCtrl(const int row, const int bitplane, const int x,
+    const int brightness, const int transition)
+{
+    uint16_t v = 0;
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    // no address on the bus, and the LSB only latches (the previous row is displayed in the row gap)
+    (void)row;
+    if (bitplane == 0)
+    {
+        return x == (CHAIN_WIDTH - 1) ? (BIT_OE | BIT_LAT) : BIT_OE;
+    }
+#else
+    const int addr = bitplane == 0 ? row - 1 : row;
+    if (addr & BIT(0)) { v |= BIT_A; }
+    if (addr & BIT(1)) { v |= BIT_B; }
+    if (addr & BIT(2)) { v |= BIT_C; }
+    if (addr & BIT(3)) { v |= BIT_D; }
+#  if LEDDISPLAY_NEED_E_GPIO
+    if (addr & BIT(4)) { v |= BIT_E; }
+#  endif
+#endif
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    // no output enable (MCPWM pulse after each latch)
+    (void)brightness;
+    (void)transition;
+    if (x == (CHAIN_WIDTH - 1)) { v |= BIT_LAT; }
+#else
+    if ( (x == 0) || (x == (CHAIN_WIDTH - 1)) ) { v |= BIT_OE; }
+    if (x == (CHAIN_WIDTH - 1)) { v |= BIT_LAT; }
+    const int limit = (bitplane == 0) || (bitplane > transition) ?
+        brightness : (brightness >> (transition - bitplane + 1));
+    if (x >= limit) { v |= BIT_OE; }
+#endif
+    return v;
+}
+
+// the display (canvas) pixel for a pixel in the chain (panel y and chain x), see Kconfig for the
+// layout of the panels, this is intentionally not using the mapping from leddisplay_enc.c
+static const uint8_t *sChainPixel(const leddisplay_frame_t *pFrame, const int panelY, const int chainX)
+{
+    const int panel = LEDDISPLAY_CHAIN_LENGTH - 1 - (chainX / LEDDISPLAY_PANEL_WIDTH); // 0 = first in chain
+    const int panelRow = panel / LEDDISPLAY_CHAIN_COLS;
+    const int posInRow = panel % LEDDISPLAY_CHAIN_COLS; // in chain order
+    int x = chainX % LEDDISPLAY_PANEL_WIDTH;
+    int y = panelY;
+#if CONFIG_LEDDISPLAY_CHAIN_SERPENTINE
+    const bool upsideDown = (panelRow % 2) == 1;
+#else
+    const bool upsideDown = false;
+#endif
+    const int panelCol = upsideDown ? posInRow : (LEDDISPLAY_CHAIN_COLS - 1 - posInRow);
+    if (upsideDown)
+    {
+        x = LEDDISPLAY_PANEL_WIDTH - 1 - x;
+        y = LEDDISPLAY_PANEL_HEIGHT - 1 - y;
+    }
+    return pFrame->yx[(panelRow * LEDDISPLAY_PANEL_HEIGHT) + y][(panelCol * LEDDISPLAY_PANEL_WIDTH) + x];
+}
+
+// decode the simulated DMA buffer (a dithering sub-frame, or -1) and compare against the frame,
+// returns the number of errors
+static int sDecodeCheckSub(const frame_t *pDmaBuf, const leddisplay_frame_t *pFrame,
+    const int brightness, const int transition, const int sub, const char *what)
+{
+    int errors = 0;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        for (int bitplane = 0; bitplane < COLOR_DEPTH_BITS; bitplane++)
+        {
+            for (int x = 0; x < CHAIN_WIDTH; x++)
+            {
+                const uint8_t *pTop = sChainPixel(pFrame, row, x);
+                const uint8_t *pBot = sChainPixel(pFrame, row + ROWS_PER_FRAME, x);
+                uint16_t expected = sExpectedCtrl(row, bitplane, x, brightness, transition);
+                const uint8_t mask = BIT(bitplane);
+                if (sExpectedPwmSub(pTop[0], row, x, sub) & mask) { expected |= BIT_R1; }
+                if (sExpectedPwmSub(pTop[1], row, x, sub) & mask) { expected |= BIT_G1; }
+                if (sExpectedPwmSub(pTop[2], row, x, sub) & mask) { expected |= BIT_B1; }
+                if (sExpectedPwmSub(pBot[0], row, x, sub) & mask) { expected |= BIT_R2; }
+                if (sExpectedPwmSub(pBot[1], row, x, sub) & mask) { expected |= BIT_G2; }
+                if (sExpectedPwmSub(pBot[2], row, x, sub) & mask) { expected |= BIT_B2; }
+
+                // 16 bit words are swapped, and bytes in 8 bit mode (I2S Tx FIFO mode1 ordering)
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+                const uint16_t actual = pDmaBuf->rowdata[row].rowbits[bitplane].pixel[x ^ 2];
+#else
+                const uint16_t actual = pDmaBuf->rowdata[row].rowbits[bitplane].pixel[x ^ 1];
+#endif
+                if (actual != expected)
+                {
+                    if (errors < 10)
+                    {
+                        printf("check,%s,fail,sub=%d,row=%d,bitplane=%d,x=%d,brightness=%d,transition=%d,expected=0x%04x,actual=0x%04x\n",
+                            what, sub, row, bitplane, x, brightness, transition, expected, actual);
+                    }
+                    errors++;
+                }
+            }
+        }
+    }
+    return errors;
+}
+
+// decode and compare a single frame (not dithered)
+static int sDecodeCheck(const frame_t *pDmaBuf, const leddisplay_frame_t *pFrame,
+    const int brightness, const int transition, const char *what)
+{
+    return sDecodeCheckSub(pDmaBuf, pFrame, brightness, transition, -1, what);
+}
+
+// decode and compare the output of the frame based encoder (all dithering sub-frames)
+static int sDecodeCheckFrames(const frame_t *pDmaBuf, const leddisplay_frame_t *pFrame,
+    const int brightness, const int transition, const char *what)
+{
+#if DITHER_FRAMES > 1
+    int errors = 0;
+    for (int sub = 0; sub < DITHER_FRAMES; sub++)
+    {
+        errors += sDecodeCheckSub(&pDmaBuf[sub], pFrame, brightness, transition, sub, what);
+    }
+    return errors;
+#else
+    return sDecodeCheck(pDmaBuf, pFrame, brightness, transition, what);
+#endif
+}
+
+// compare the load of the rows (sum of the PWM values of all LEDs, see leddisplay_enc_frame_rows())
+// against the frame (dithered, i.e. all sub-frames, or as a single frame), returns the number of errors
+static int sLoadCheck(const uint32_t *pLoad, const leddisplay_frame_t *pFrame, const bool dithered, const char *what)
+{
+    int errors = 0;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        uint32_t expected = 0;
+        for (int x = 0; x < CHAIN_WIDTH; x++)
+        {
+            const uint8_t *pTop = sChainPixel(pFrame, row, x);
+            const uint8_t *pBot = sChainPixel(pFrame, row + ROWS_PER_FRAME, x);
+            // all sub-frames (or -1 = not dithered)
+            for (int n = 0; n < (dithered ? DITHER_FRAMES : 1); n++)
+            {
+                const int sub = (dithered && (DITHER_FRAMES > 1)) ? n : -1;
+                for (int ix = 0; ix < 3; ix++)
+                {
+                    expected += sExpectedPwmSub(pTop[ix], row, x, sub) + sExpectedPwmSub(pBot[ix], row, x, sub);
+                }
+            }
+        }
+        if (pLoad[row] != expected)
+        {
+            if (errors < 10)
+            {
+                printf("check,%s,fail,row=%d,expected=%u,actual=%u\n", what, row, expected, pLoad[row]);
+            }
+            errors++;
+        }
+    }
+    return errors;
+}
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+// check the row gap (the previous row's last bitplane displayed for one latch period using the LSB
+// brightness, then dark), returns the number of errors
+static int sRowGapCheck(const int brightness, const int transition)
+{
+    static bus_word_t sGap[PIXELS_PER_LATCH + 64];
+    leddisplay_enc_row_gap(sGap, NUMOF(sGap), &sCtrl);
+    int errors = 0;
+    for (int x = 0; x < NUMOF(sGap); x++)
+    {
+        const uint16_t expected = (x < CHAIN_WIDTH) && (x > 0) && (x < (CHAIN_WIDTH - 1)) && (x < brightness) ? 0 : BIT_OE;
+        const uint16_t actual = sGap[x ^ 2];
+        if (actual != expected)
+        {
+            if (errors < 10)
+            {
+                printf("check,row_gap,fail,x=%d,brightness=%d,transition=%d,expected=0x%04x,actual=0x%04x\n",
+                    x, brightness, transition, expected, actual);
+            }
+            errors++;
+        }
+    }
+    return errors;
+}
+#endif
+
+// write the frame to the simulated DMA buffer as an application would using the direct
+// functions (see leddisplay_direct_get()), i.e. only using the layout documented in leddisplay.h
+static void sDirectWrite(frame_t *pDmaBuf, const leddisplay_frame_t *pFrame)
+{
+    const leddisplay_direct_t direct =
+    {
+        .mem = (uint8_t *)pDmaBuf, .size = sizeof(*pDmaBuf), .num_rows = ROWS_PER_FRAME,
+        .num_bitplanes = COLOR_DEPTH_BITS, .num_words = CHAIN_WIDTH, .word_size = sizeof(bus_word_t),
+        .ctrl = &sCtrl.oe[0][0],
+    };
+    for (int row = 0; row < direct.num_rows; row++)
+    {
+        for (int bitplane = 0; bitplane < direct.num_bitplanes; bitplane++)
+        {
+            for (int x = 0; x < direct.num_words; x++)
+            {
+                const uint8_t *pTop = sChainPixel(pFrame, row, x);
+                const uint8_t *pBot = sChainPixel(pFrame, row + direct.num_rows, x);
+                const uint8_t mask = BIT(bitplane);
+                uint8_t rgb = 0;
+                if (sExpectedPwm(pTop[0]) & mask) { rgb |= LEDDISPLAY_DIRECT_R1; }
+                if (sExpectedPwm(pTop[1]) & mask) { rgb |= LEDDISPLAY_DIRECT_G1; }
+                if (sExpectedPwm(pTop[2]) & mask) { rgb |= LEDDISPLAY_DIRECT_B1; }
+                if (sExpectedPwm(pBot[0]) & mask) { rgb |= LEDDISPLAY_DIRECT_R2; }
+                if (sExpectedPwm(pBot[1]) & mask) { rgb |= LEDDISPLAY_DIRECT_G2; }
+                if (sExpectedPwm(pBot[2]) & mask) { rgb |= LEDDISPLAY_DIRECT_B2; }
+                *leddisplay_direct_lo(&direct, row, bitplane, x) = direct.ctrl[(bitplane * direct.num_words) + x] | rgb;
+            }
+        }
+    }
+}
+
+// fill frame with "random" (but reproducible) content, only every n-th pixel is lit
+static void sFrameRandom(leddisplay_frame_t *pFrame, const int every)
+{
+    static uint32_t sRnd = 12345;
+    memset(pFrame, 0, sizeof(*pFrame));
+    for (int ix = 0; ix < NUMOF(pFrame->ix); ix += every)
+    {
+        sRnd = (sRnd * 1103515245) + 12345;
+        pFrame->ix[ix][0] = sRnd >> 8;
+        pFrame->ix[ix][1] = sRnd >> 16;
+        pFrame->ix[ix][2] = sRnd >> 24;
+    }
+}
+
+// all colour values in all channels
+static void sFrameRamp(leddisplay_frame_t *pFrame)
+{
+    for (int ix = 0; ix < NUMOF(pFrame->ix); ix++)
+    {
+        pFrame->ix[ix][0] = ix;
+        pFrame->ix[ix][1] = ix + 85;
+        pFrame->ix[ix][2] = 255 - ix;
+    }
+}
+
+/* *********************************************************************************************** */
+
+static int sCheck(void)
+{
+    static leddisplay_frame_t sFrame;
+    static leddisplay_frame_t sFrame2;
+    const int brightnesses[] = { 0, 1, PIXELS_PER_LATCH / 3, (PIXELS_PER_LATCH * 3) / 4, PIXELS_PER_LATCH };
+    const int transitions[] = { 0, 1, COLOR_DEPTH_BITS - 1 };
+    int errors = 0;
+    int checks = 0;
+
+    for (int bIx = 0; bIx < NUMOF(brightnesses); bIx++)
+    {
+        for (int tIx = 0; tIx < NUMOF(transitions); tIx++)
+        {
+            const int brightness = brightnesses[bIx];
+            const int transition = transitions[tIx];
+            leddisplay_enc_ctrl_bits(&sCtrl, brightness, transition);
+            for (int sub = 0; sub < DITHER_FRAMES; sub++)
+            {
+                leddisplay_enc_fill(&sDmaBuf[sub], &sCtrl, 0, 0, 0);
+            }
+
+            // frame based encoder: full frame, random and all colour values
+            sFrameRandom(&sFrame, 1);
+            static uint32_t sLoad[ROWS_PER_FRAME];
+            leddisplay_enc_frame_rows(sDmaBuf, &sCtrl, &sFrame, ROWS_MASK_ALL, sLoad);
+            errors += sDecodeCheckFrames(sDmaBuf, &sFrame, brightness, transition, "frame_rows_random");
+            errors += sLoadCheck(sLoad, &sFrame, true, "frame_rows_load");
+            memset(sLoad, 0, sizeof(sLoad));
+            for (int sub = 0; sub < DITHER_FRAMES; sub++)
+            {
+                leddisplay_enc_load_rows(&sDmaBuf[sub], ROWS_MASK_ALL, sLoad);
+            }
+            errors += sLoadCheck(sLoad, &sFrame, true, "frame_rows_load_measured");
+            sFrameRamp(&sFrame);
+            leddisplay_enc_frame_rows(sDmaBuf, &sCtrl, &sFrame, ROWS_MASK_ALL, NULL);
+            errors += sDecodeCheckFrames(sDmaBuf, &sFrame, brightness, transition, "frame_rows_ramp");
+
+            // frame based encoder: only some rows (the others must be unchanged)
+            sFrame2 = sFrame;
+            sFrameRandom(&sFrame, 3);
+            const uint32_t rows = 0x55555555 & ROWS_MASK_ALL;
+            leddisplay_enc_frame_rows(sDmaBuf, &sCtrl, &sFrame, rows, NULL);
+            for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+            {
+                if ((rows & leddisplay_enc_row_mask(y)) == 0)
+                {
+                    memcpy(sFrame.yx[y], sFrame2.yx[y], sizeof(sFrame.yx[y]));
+                }
+            }
+            errors += sDecodeCheckFrames(sDmaBuf, &sFrame, brightness, transition, "frame_rows_partial");
+
+            // indexed colour frames (8 and 4 bits per pixel)
+            for (int bits = 8; bits >= 4; bits -= 4)
+            {
+                static palette_bits_t sPal;
+                static uint8_t sPalRgb[256][3];
+                static uint8_t sFrameIx[LEDDISPLAY_HEIGHT * LEDDISPLAY_WIDTH];
+                sFrameRandom(&sFrame, 1);
+                for (int colour = 0; colour < NUMOF(sPalRgb); colour++)
+                {
+                    memcpy(sPalRgb[colour], sFrame.ix[colour % NUMOF(sFrame.ix)], 3);
+                    leddisplay_enc_palette(&sPal, colour, sPalRgb[colour][0], sPalRgb[colour][1], sPalRgb[colour][2]);
+                }
+                memset(sFrameIx, 0, sizeof(sFrameIx));
+                for (int ix = 0; ix < NUMOF(sFrame.ix); ix++)
+                {
+                    const int colour = (ix * 37 + (ix / 5)) & ((1 << bits) - 1);
+                    if (bits == 8)
+                    {
+                        sFrameIx[ix] = colour;
+                    }
+                    else
+                    {
+                        sFrameIx[ix / 2] |= colour << ((ix % 2) * 4);
+                    }
+                    memcpy(sFrame.ix[ix], sPalRgb[colour], 3);
+                }
+                leddisplay_enc_frame_ix_rows(sDmaBuf, &sCtrl, &sPal, sFrameIx, bits, ROWS_MASK_ALL);
+                errors += sDecodeCheck(sDmaBuf, &sFrame, brightness, transition, bits == 8 ? "frame8" : "frame4");
+            }
+
+            // pixel based encoder must give the same result as the frame based one
+            sFrameRandom(&sFrame, 2);
+            leddisplay_enc_fill(&sDmaBuf2, &sCtrl, 0, 0, 0);
+            for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+            {
+                for (int x = 0; x < LEDDISPLAY_WIDTH; x++)
+                {
+                    const uint8_t *pRgb = sFrame.yx[y][x];
+                    leddisplay_enc_pixel_xy(&sDmaBuf2, &sCtrl, x, y, pRgb[0], pRgb[1], pRgb[2]);
+                }
+            }
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "pixel_xy");
+
+            // span encoder: whole rows from the frame (blit), then some lines of one colour
+            sFrameRandom(&sFrame, 1);
+            leddisplay_enc_fill(&sDmaBuf2, &sCtrl, 0, 0, 0);
+            for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+            {
+                leddisplay_enc_pixel_span(&sDmaBuf2, &sCtrl, 0, y, LEDDISPLAY_WIDTH, sFrame.yx[y][0], 3);
+            }
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "pixel_span_blit");
+            memset(sLoad, 0, sizeof(sLoad));
+            leddisplay_enc_load_rows(&sDmaBuf2, ROWS_MASK_ALL, sLoad);
+            errors += sLoadCheck(sLoad, &sFrame, false, "pixel_span_load");
+            for (int y = 1; y < LEDDISPLAY_HEIGHT; y += 3)
+            {
+                const uint16_t x0 = (y * 7) % LEDDISPLAY_WIDTH;
+                const uint16_t width = ((y * 13) % (LEDDISPLAY_WIDTH - x0)) + 1;
+                const uint8_t rgb[3] = { y * 5, 255 - y, y * 3 };
+                leddisplay_enc_pixel_span(&sDmaBuf2, &sCtrl, x0, y, width, rgb, 0);
+                for (int x = x0; x < (x0 + width); x++)
+                {
+                    memcpy(sFrame.yx[y][x], rgb, sizeof(rgb));
+                }
+            }
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "pixel_span_line");
+
+            // span encoder: RGB565 (expanded to 8 bits per colour as 5/6 bits replicated)
+            for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+            {
+                uint16_t rgb565[LEDDISPLAY_WIDTH];
+                for (int x = 0; x < LEDDISPLAY_WIDTH; x++)
+                {
+                    const uint16_t v = (uint16_t)((x * 0x9e37) ^ (y * 0x7f4a) ^ (bIx << 3));
+                    const uint8_t r5 = v >> 11, g6 = (v >> 5) & 0x3f, b5 = v & 0x1f;
+                    rgb565[x] = v;
+                    sFrame.yx[y][x][0] = (r5 << 3) | (r5 >> 2);
+                    sFrame.yx[y][x][1] = (g6 << 2) | (g6 >> 4);
+                    sFrame.yx[y][x][2] = (b5 << 3) | (b5 >> 2);
+                }
+                leddisplay_enc_pixel_span_rgb565(&sDmaBuf2, &sCtrl, 0, y, LEDDISPLAY_WIDTH, rgb565);
+            }
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "pixel_span_rgb565");
+
+            // fill
+            for (int val = 0; val < 256; val += 15)
+            {
+                leddisplay_enc_fill(&sDmaBuf2, &sCtrl, val, 255 - val, val / 2);
+                for (int ix = 0; ix < NUMOF(sFrame.ix); ix++)
+                {
+                    sFrame.ix[ix][0] = val;
+                    sFrame.ix[ix][1] = 255 - val;
+                    sFrame.ix[ix][2] = val / 2;
+                }
+                errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "fill");
+            }
+
+            // direct (zero-copy) functions layout
+            sFrameRandom(&sFrame, 1);
+            leddisplay_enc_fill(&sDmaBuf2, &sCtrl, 0, 0, 0);
+            sDirectWrite(&sDmaBuf2, &sFrame);
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness, transition, "direct");
+
+            // brightness change of the rendered frame (only the control signals are replaced)
+            const int brightness2 = brightnesses[(bIx + 1) % NUMOF(brightnesses)];
+            leddisplay_enc_ctrl_bits(&sCtrl, brightness2, transition);
+            leddisplay_enc_ctrl_update(&sDmaBuf2, &sCtrl);
+            errors += sDecodeCheck(&sDmaBuf2, &sFrame, brightness2, transition, "ctrl_update");
+            leddisplay_enc_ctrl_bits(&sCtrl, brightness, transition);
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            errors += sRowGapCheck(brightness, transition);
+#endif
+            checks++;
+        }
+    }
+
+    printf("check,%dx%d,chain=%dx%d,depth=%d,corr=%s,configs=%d,errors=%d,%s\n", LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT,
+        LEDDISPLAY_CHAIN_COLS, LEDDISPLAY_CHAIN_ROWS, COLOR_DEPTH_BITS, BENCH_CORR, checks, errors, errors == 0 ? "ok" : "FAIL");
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* *********************************************************************************************** */
+
+static uint64_t sNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+static void sBenchFrameRows(const char *name, const leddisplay_frame_t *pFrame)
+{
+    uint64_t min = UINT64_MAX, max = 0, sum = 0;
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        const uint64_t t0 = sNow();
+        leddisplay_enc_frame_rows(sDmaBuf, &sCtrl, pFrame, ROWS_MASK_ALL, NULL);
+        const uint64_t t1 = sNow();
+        const uint64_t dt = t1 - t0;
+        sum += dt;
+        if (dt < min) { min = dt; }
+        if (dt > max) { max = dt; }
+    }
+    printf("bench,%s,%d,%d,%d,%s,%d,%llu,%llu,%llu\n", name, LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT,
+        COLOR_DEPTH_BITS, BENCH_CORR, BENCH_RUNS, (unsigned long long)min,
+        (unsigned long long)(sum / BENCH_RUNS), (unsigned long long)max);
+}
+
+static void sBenchPixelSpans(const char *name, const leddisplay_frame_t *pFrame)
+{
+    uint64_t min = UINT64_MAX, max = 0, sum = 0;
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        const uint64_t t0 = sNow();
+        for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+        {
+            leddisplay_enc_pixel_span(sDmaBuf, &sCtrl, 0, y, LEDDISPLAY_WIDTH, pFrame->yx[y][0], 3);
+        }
+        const uint64_t t1 = sNow();
+        const uint64_t dt = t1 - t0;
+        sum += dt;
+        if (dt < min) { min = dt; }
+        if (dt > max) { max = dt; }
+    }
+    printf("bench,%s,%d,%d,%d,%s,%d,%llu,%llu,%llu\n", name, LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT,
+        COLOR_DEPTH_BITS, BENCH_CORR, BENCH_RUNS, (unsigned long long)min,
+        (unsigned long long)(sum / BENCH_RUNS), (unsigned long long)max);
+}
+
+static void sBenchPixelXy(const char *name, const leddisplay_frame_t *pFrame)
+{
+    uint64_t min = UINT64_MAX, max = 0, sum = 0;
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        const uint64_t t0 = sNow();
+        for (int y = 0; y < LEDDISPLAY_HEIGHT; y++)
+        {
+            for (int x = 0; x < LEDDISPLAY_WIDTH; x++)
+            {
+                const uint8_t *pRgb = pFrame->yx[y][x];
+                leddisplay_enc_pixel_xy(sDmaBuf, &sCtrl, x, y, pRgb[0], pRgb[1], pRgb[2]);
+            }
+        }
+        const uint64_t t1 = sNow();
+        const uint64_t dt = t1 - t0;
+        sum += dt;
+        if (dt < min) { min = dt; }
+        if (dt > max) { max = dt; }
+    }
+    printf("bench,%s,%d,%d,%d,%s,%d,%llu,%llu,%llu\n", name, LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT,
+        COLOR_DEPTH_BITS, BENCH_CORR, BENCH_RUNS, (unsigned long long)min,
+        (unsigned long long)(sum / BENCH_RUNS), (unsigned long long)max);
+}
+
+static int sBench(void)
+{
+    static leddisplay_frame_t sFrame;
+    leddisplay_enc_ctrl_bits(&sCtrl, (LEDDISPLAY_WIDTH * 3) / 4, 1);
+    leddisplay_enc_fill(sDmaBuf, &sCtrl, 0, 0, 0);
+
+    printf("bench,test,width,height,depth,corr,n,min_ns,avg_ns,max_ns\n");
+    sFrameRandom(&sFrame, 1);
+    sBenchFrameRows("frame_rows_random", &sFrame);
+    memset(&sFrame, 0x80, sizeof(sFrame));
+    sBenchFrameRows("frame_rows_solid", &sFrame);
+    sFrameRandom(&sFrame, 20);
+    sBenchFrameRows("frame_rows_sparse", &sFrame);
+    sFrameRandom(&sFrame, 1);
+    sBenchPixelXy("pixel_xy_random", &sFrame);
+    sBenchPixelSpans("pixel_span_random", &sFrame);
+    printf("bench,done\n");
+    return EXIT_SUCCESS;
+}
+
+/* *********************************************************************************************** */
+
+// append a run of n values v to the animation frame data (see leddisplay_anim.h for the tokens)
+static uint32_t sAnimRun(uint8_t *pData, uint32_t size, uint32_t n, const uint8_t v)
+{
+    while (n > 0)
+    {
+        if ( (v == 0) && (n <= 64) )
+        {
+            pData[size++] = 0x80 | (n - 1);
+            n = 0;
+        }
+        else if ( (v != 0) && (n == 1) )
+        {
+            pData[size++] = v;
+            n = 0;
+        }
+        else if ( (v != 0) && (n <= 65) )
+        {
+            pData[size++] = 0x40 | (n - 2);
+            pData[size++] = v;
+            n = 0;
+        }
+        else
+        {
+            const uint32_t chunk = n > 16384 ? 16384 : n;
+            pData[size++] = 0xc0 | ((chunk - 1) >> 8);
+            pData[size++] = (chunk - 1) & 0xff;
+            pData[size++] = v;
+            n -= chunk;
+        }
+    }
+    return size;
+}
+
+// encode the values of a frame (XOR-ed onto pPrev, or NULL for key frames) into the tokens
+static uint32_t sAnimTokens(uint8_t *pData, const uint8_t *pValues, const uint8_t *pPrev, const uint32_t num)
+{
+    uint32_t size = 0;
+    uint32_t ix = 0;
+    while (ix < num)
+    {
+        const uint8_t v = pValues[ix] ^ (pPrev != NULL ? pPrev[ix] : 0);
+        uint32_t n = 1;
+        while ( ((ix + n) < num) && ((pValues[ix + n] ^ (pPrev != NULL ? pPrev[ix + n] : 0)) == v) )
+        {
+            n++;
+        }
+        size = sAnimRun(pData, size, n, v);
+        ix += n;
+    }
+    return size;
+}
+
+static void sAnimUint(FILE *pOut, const uint32_t val, const int n)
+{
+    for (int ix = 0; ix < n; ix++)
+    {
+        fputc((val >> (8 * ix)) & 0xff, pOut);
+    }
+}
+
+// encode raw RGB frames (LEDDISPLAY_WIDTH x LEDDISPLAY_HEIGHT x 3 bytes each) into an animation
+// for the leddisplay_anim player (see leddisplay_anim.h)
+static int sAnim(const int frameMs, FILE *pIn, FILE *pOut)
+{
+    static leddisplay_frame_t sFrame;
+    enum { NUM_VALUES = ROWS_PER_FRAME * COLOR_DEPTH_BITS * CHAIN_WIDTH };
+    static uint8_t sValues[NUM_VALUES];
+    static uint8_t sPrev[NUM_VALUES];
+    static uint8_t sKey[(NUM_VALUES * 3) + 16];
+    static uint8_t sDelta[(NUM_VALUES * 3) + 16];
+
+    // the control bits don't matter, only the colours are stored
+    leddisplay_enc_ctrl_bits(&sCtrl, PIXELS_PER_LATCH, 1);
+    leddisplay_enc_fill(sDmaBuf, &sCtrl, 0, 0, 0);
+
+    uint8_t *pAnim = NULL;
+    uint32_t animSize = 0;
+    int numFrames = 0;
+    int numKeyFrames = 0;
+    while (fread(&sFrame, sizeof(sFrame), 1, pIn) == 1)
+    {
+        leddisplay_enc_frame_rows(sDmaBuf, &sCtrl, &sFrame, ROWS_MASK_ALL, NULL);
+        uint8_t *pValue = sValues;
+        for (int row = 0; row < ROWS_PER_FRAME; row++)
+        {
+            for (int bitplane = 0; bitplane < COLOR_DEPTH_BITS; bitplane++)
+            {
+                for (int x = 0; x < CHAIN_WIDTH; x++)
+                {
+                    *pValue++ = BUS_WORD_LO(&sDmaBuf[0].rowdata[row].rowbits[bitplane], BUS_WORD_IX(x)) & LEDDISPLAY_DIRECT_RGB_MASK;
+                }
+            }
+        }
+
+        // delta frame, unless a key frame is smaller
+        const uint32_t keySize = sAnimTokens(sKey, sValues, NULL, NUM_VALUES);
+        const uint32_t deltaSize = numFrames > 0 ? sAnimTokens(sDelta, sValues, sPrev, NUM_VALUES) : UINT32_MAX;
+        const bool isKey = keySize <= deltaSize;
+        const uint32_t size = isKey ? keySize : deltaSize;
+        pAnim = realloc(pAnim, animSize + 4 + size);
+        if (pAnim == NULL)
+        {
+            fprintf(stderr, "anim: out of memory\n");
+            return EXIT_FAILURE;
+        }
+        const uint32_t sizeField = size | (isKey ? LEDDISPLAY_ANIM_KEY_FRAME : 0);
+        for (int ix = 0; ix < 4; ix++)
+        {
+            pAnim[animSize++] = (sizeField >> (8 * ix)) & 0xff;
+        }
+        memcpy(&pAnim[animSize], isKey ? sKey : sDelta, size);
+        animSize += size;
+        memcpy(sPrev, sValues, sizeof(sPrev));
+        numFrames++;
+        numKeyFrames += isKey ? 1 : 0;
+    }
+    if ( (numFrames < 1) || (numFrames > 0xffff) )
+    {
+        fprintf(stderr, "anim: need 1..65535 frames of %dx%d\n", LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT);
+        free(pAnim);
+        return EXIT_FAILURE;
+    }
+
+    fwrite("LDA1", 4, 1, pOut);
+    sAnimUint(pOut, CHAIN_WIDTH, 2);
+    sAnimUint(pOut, ROWS_PER_FRAME, 1);
+    sAnimUint(pOut, COLOR_DEPTH_BITS, 1);
+    sAnimUint(pOut, numFrames, 2);
+    sAnimUint(pOut, frameMs, 2);
+    sAnimUint(pOut, 0, 4);
+    fwrite(pAnim, animSize, 1, pOut);
+    free(pAnim);
+
+    fprintf(stderr, "anim,%dx%d,depth=%d,corr=%s,frames=%d,key=%d,size=%u,raw=%u\n", LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT,
+        COLOR_DEPTH_BITS, BENCH_CORR, numFrames, numKeyFrames, LEDDISPLAY_ANIM_HEADER_SIZE + animSize,
+        (unsigned int)(numFrames * sizeof(sFrame)));
+    return EXIT_SUCCESS;
+}
+
+/* *********************************************************************************************** */
+
+int main(int argc, char **argv)
+{
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    val2pwm_init();
+#endif
+#if DITHER_FRAMES > 1
+    val2pwm_dither_init();
+#endif
+
+    if ( (argc == 2) && (strcmp(argv[1], "check") == 0) )
+    {
+        return sCheck();
+    }
+    else if ( (argc == 2) && (strcmp(argv[1], "bench") == 0) )
+    {
+        return sBench();
+    }
+    else if ( (argc == 3) && (strcmp(argv[1], "anim") == 0) )
+    {
+        return sAnim(atoi(argv[2]), stdin, stdout);
+    }
+    fprintf(stderr, "usage: %s check|bench|anim <frame_ms> (< in.rgb > out.lda)\n", argv[0]);
+    return EXIT_FAILURE;
+}
+
+/* *********************************************************************************************** */
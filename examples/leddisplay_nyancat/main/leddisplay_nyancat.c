@@ -23,6 +23,7 @@
 #include <esp_timer.h>
 
 #include <leddisplay.h>
+#include <leddisplay_anim.h>
 
 #include "mon.h"
 #include "nyan_64x32.h"
@@ -121,6 +122,37 @@ static void sLeddisplayTestTask(void *pParam)
 
         // -----------------------------------------------------------------------------------------
 
+        INFO("animation (pre-encoded)");
+        {
+            uint32_t animSize;
+            const uint8_t *animData = get_nyan_64x32_anim(&animSize);
+            leddisplay_anim_t anim;
+            if (leddisplay_anim_open_mem(&anim, animData, animSize) == ESP_OK)
+            {
+                uint32_t prevTick = xTaskGetTickCount();
+                int n = 15;
+                while (n > 0)
+                {
+                    if (leddisplay_anim_frame(&anim, true) == ESP_OK)
+                    {
+                        vTaskDelayUntil(&prevTick, MS2TICKS(anim.frame_ms));
+                    }
+                    else
+                    {
+                        leddisplay_anim_rewind(&anim);
+                        n--;
+                    }
+                }
+                leddisplay_anim_close(&anim);
+            }
+            else
+            {
+                WARNING("animation not for this display configuration (see nyan_64x32_anim.sh)");
+            }
+        }
+
+        // -----------------------------------------------------------------------------------------
+
         leddisplay_frame_clear(&sDispFrame);
         leddisplay_frame_update(&sDispFrame);
 
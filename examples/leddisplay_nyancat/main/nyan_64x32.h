@@ -5,4 +5,7 @@
 
 const uint8_t *get_nyan_64x32(int *nFrames);
 
+// pre-encoded for the default configuration (see nyan_64x32_anim.sh and leddisplay_anim.h)
+const uint8_t *get_nyan_64x32_anim(uint32_t *size);
+
 #endif // __NYAN_64X32_H__
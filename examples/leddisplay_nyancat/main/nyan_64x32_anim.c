@@ -0,0 +1,1622 @@
+// Auto-generated
+#include <sdkconfig.h>
+#include "nyan_64x32.h"
+static const unsigned char myanim[]={
+  0x4c, 0x44, 0x41, 0x31, 0x40, 0x00, 0x10, 0x08, 0x0c, 0x00, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc7, 0x09, 0x00, 0x80, 0x41, 0x1a, 0x47, 0x12,
+  0x44, 0x02, 0x1a, 0x45, 0x2a, 0x0a, 0x42, 0x02, 0x3a, 0x44, 0x02, 0x3a,
+  0x42, 0x02, 0x53, 0x12, 0x41, 0x1d, 0x47, 0x15, 0x44, 0x05, 0x0d, 0x45,
+  0x2d, 0x0d, 0x42, 0x05, 0x3d, 0x44, 0x05, 0x3d, 0x42, 0x05, 0x53, 0x2d,
+  0x41, 0x1c, 0x47, 0x14, 0x44, 0x04, 0x0c, 0x45, 0x2c, 0x0c, 0x42, 0x04,
+  0x3c, 0x44, 0x04, 0x3c, 0x42, 0x04, 0x53, 0x24, 0x4a, 0x1c, 0x40, 0x04,
+  0x40, 0x3c, 0x40, 0x04, 0x2c, 0x46, 0x3c, 0x04, 0x42, 0x3c, 0x04, 0x44,
+  0x3c, 0x04, 0x40, 0x3c, 0x04, 0x53, 0x24, 0x41, 0x1e, 0x47, 0x16, 0x44,
+  0x06, 0x1e, 0x45, 0x2e, 0x0e, 0x42, 0x06, 0x3e, 0x44, 0x06, 0x3e, 0x42,
+  0x06, 0x53, 0x36, 0x41, 0x1c, 0x47, 0x14, 0x44, 0x04, 0x0c, 0x45, 0x2c,
+  0x0c, 0x42, 0x04, 0x3c, 0x44, 0x04, 0x3c, 0x42, 0x04, 0x53, 0x24, 0x41,
+  0x18, 0x47, 0x10, 0x81, 0x40, 0x38, 0x81, 0x28, 0x45, 0x38, 0x28, 0x80,
+  0x42, 0x38, 0x80, 0x44, 0x38, 0x80, 0x40, 0x38, 0x95, 0x41, 0x18, 0x47,
+  0x10, 0x85, 0x18, 0x45, 0x28, 0x08, 0x83, 0x38, 0x85, 0x38, 0x98, 0x48,
+  0x12, 0x41, 0x22, 0x43, 0x02, 0x3a, 0x2a, 0x0a, 0x2a, 0x3a, 0x42, 0x2a,
+  0x4e, 0x02, 0x53, 0x12, 0x48, 0x15, 0x41, 0x25, 0x43, 0x05, 0x3d, 0x2d,
+  0x0d, 0x2d, 0x3d, 0x42, 0x2d, 0x4e, 0x05, 0x53, 0x2d, 0x48, 0x14, 0x41,
+  0x24, 0x43, 0x04, 0x3c, 0x2c, 0x0c, 0x2c, 0x3c, 0x42, 0x2c, 0x4e, 0x04,
+  0x53, 0x24, 0x48, 0x1c, 0x41, 0x34, 0x40, 0x04, 0x40, 0x3c, 0x04, 0x47,
+  0x3c, 0x04, 0x41, 0x3c, 0x40, 0x04, 0x43, 0x3c, 0x40, 0x04, 0x40, 0x3c,
+  0x04, 0x53, 0x24, 0x48, 0x16, 0x41, 0x26, 0x43, 0x06, 0x3e, 0x2e, 0x0e,
+  0x2e, 0x3e, 0x42, 0x2e, 0x4e, 0x06, 0x53, 0x36, 0x48, 0x14, 0x41, 0x24,
+  0x43, 0x04, 0x3c, 0x2c, 0x0c, 0x2c, 0x3c, 0x42, 0x2c, 0x4e, 0x04, 0x53,
+  0x24, 0x48, 0x10, 0x41, 0x30, 0x81, 0x40, 0x38, 0x80, 0x40, 0x38, 0x28,
+  0x44, 0x38, 0x80, 0x41, 0x38, 0x81, 0x43, 0x38, 0x81, 0x40, 0x38, 0x95,
+  0x48, 0x10, 0x41, 0x20, 0x84, 0x38, 0x28, 0x08, 0x28, 0x38, 0x42, 0x28,
+  0xa4, 0x41, 0x12, 0x4b, 0x22, 0x40, 0x02, 0x1a, 0x2a, 0x3a, 0x41, 0x2a,
+  0x0a, 0x40, 0x2a, 0x40, 0x02, 0x40, 0x0a, 0x47, 0x02, 0x40, 0x0a, 0x02,
+  0x44, 0x12, 0x17, 0x4c, 0x12, 0x41, 0x15, 0x4b, 0x25, 0x40, 0x05, 0x0d,
+  0x2d, 0x3d, 0x41, 0x2d, 0x0d, 0x40, 0x2d, 0x40, 0x05, 0x40, 0x0d, 0x47,
+  0x05, 0x40, 0x0d, 0x05, 0x44, 0x2d, 0x2f, 0x4c, 0x2d, 0x41, 0x14, 0x4b,
+  0x24, 0x40, 0x04, 0x0c, 0x2c, 0x3c, 0x41, 0x2c, 0x0c, 0x40, 0x2c, 0x40,
+  0x04, 0x40, 0x0c, 0x47, 0x04, 0x40, 0x0c, 0x04, 0x44, 0x24, 0x27, 0x4c,
+  0x24, 0x41, 0x1c, 0x4b, 0x34, 0x40, 0x04, 0x2c, 0x46, 0x3c, 0x04, 0x4c,
+  0x3c, 0x04, 0x44, 0x24, 0x27, 0x4c, 0x24, 0x41, 0x16, 0x4b, 0x26, 0x40,
+  0x06, 0x1e, 0x2e, 0x3e, 0x41, 0x2e, 0x0e, 0x40, 0x2e, 0x40, 0x06, 0x40,
+  0x0e, 0x47, 0x06, 0x40, 0x0e, 0x06, 0x44, 0x36, 0x37, 0x4c, 0x36, 0x41,
+  0x14, 0x4b, 0x24, 0x40, 0x04, 0x0c, 0x2c, 0x3c, 0x41, 0x2c, 0x0c, 0x40,
+  0x2c, 0x40, 0x04, 0x40, 0x0c, 0x47, 0x04, 0x40, 0x0c, 0x04, 0x44, 0x24,
+  0x27, 0x4c, 0x24, 0x41, 0x10, 0x4b, 0x30, 0x81, 0x28, 0x43, 0x38, 0x28,
+  0x40, 0x38, 0x80, 0x4c, 0x38, 0x86, 0x07, 0x8d, 0x41, 0x10, 0x4b, 0x20,
+  0x81, 0x18, 0x28, 0x38, 0x41, 0x28, 0x08, 0x40, 0x28, 0x81, 0x40, 0x08,
+  0x88, 0x40, 0x08, 0x86, 0x07, 0x8d, 0x48, 0x22, 0x45, 0x2a, 0x02, 0x40,
+  0x1a, 0x2a, 0x0a, 0x43, 0x2a, 0x40, 0x02, 0x40, 0x0a, 0x47, 0x02, 0x40,
+  0x0a, 0x02, 0x44, 0x12, 0x17, 0x4c, 0x12, 0x4f, 0x25, 0x05, 0x40, 0x0d,
+  0x2d, 0x0d, 0x43, 0x2d, 0x40, 0x05, 0x40, 0x0d, 0x47, 0x05, 0x40, 0x0d,
+  0x05, 0x44, 0x2d, 0x2f, 0x4c, 0x2d, 0x48, 0x24, 0x45, 0x2c, 0x04, 0x40,
+  0x0c, 0x2c, 0x0c, 0x43, 0x2c, 0x40, 0x04, 0x40, 0x0c, 0x47, 0x04, 0x40,
+  0x0c, 0x04, 0x44, 0x24, 0x27, 0x4c, 0x24, 0x48, 0x34, 0x45, 0x3c, 0x04,
+  0x40, 0x2c, 0x45, 0x3c, 0x04, 0x42, 0x3c, 0x04, 0x40, 0x3c, 0x04, 0x40,
+  0x3c, 0x04, 0x41, 0x3c, 0x04, 0x44, 0x24, 0x27, 0x4c, 0x24, 0x48, 0x26,
+  0x45, 0x2e, 0x06, 0x40, 0x1e, 0x2e, 0x0e, 0x43, 0x2e, 0x40, 0x06, 0x40,
+  0x0e, 0x47, 0x06, 0x40, 0x0e, 0x06, 0x44, 0x36, 0x37, 0x4c, 0x36, 0x4f,
+  0x24, 0x04, 0x40, 0x0c, 0x2c, 0x0c, 0x43, 0x2c, 0x40, 0x04, 0x40, 0x0c,
+  0x47, 0x04, 0x40, 0x0c, 0x04, 0x44, 0x24, 0x27, 0x4c, 0x24, 0x48, 0x30,
+  0x45, 0x20, 0x80, 0x40, 0x28, 0x38, 0x28, 0x43, 0x38, 0x80, 0x42, 0x38,
+  0x80, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80, 0x41, 0x38, 0x86, 0x07, 0x8d,
+  0x4f, 0x20, 0x80, 0x40, 0x18, 0x28, 0x08, 0x43, 0x28, 0x81, 0x40, 0x08,
+  0x88, 0x40, 0x08, 0x86, 0x07, 0x8d, 0x41, 0x22, 0x4c, 0x2a, 0x02, 0x41,
+  0x1a, 0x45, 0x2a, 0x4c, 0x02, 0x54, 0x12, 0x4f, 0x25, 0x05, 0x41, 0x0d,
+  0x45, 0x2d, 0x4c, 0x05, 0x54, 0x2d, 0x41, 0x24, 0x4c, 0x2c, 0x04, 0x41,
+  0x0c, 0x45, 0x2c, 0x4c, 0x04, 0x54, 0x24, 0x41, 0x34, 0x4c, 0x3c, 0x04,
+  0x41, 0x2c, 0x45, 0x3c, 0x04, 0x41, 0x3c, 0x45, 0x04, 0x40, 0x3c, 0x04,
+  0x54, 0x24, 0x41, 0x26, 0x4c, 0x2e, 0x06, 0x41, 0x1e, 0x45, 0x2e, 0x4c,
+  0x06, 0x54, 0x36, 0x4f, 0x24, 0x04, 0x41, 0x0c, 0x45, 0x2c, 0x4c, 0x04,
+  0x54, 0x24, 0x41, 0x30, 0x4c, 0x20, 0x80, 0x41, 0x28, 0x45, 0x38, 0x80,
+  0x41, 0x38, 0x86, 0x40, 0x38, 0x96, 0x4f, 0x20, 0x80, 0x41, 0x18, 0x45,
+  0x28, 0xa3, 0x48, 0x2a, 0x44, 0x12, 0x41, 0x02, 0x48, 0x1a, 0x4a, 0x02,
+  0x43, 0x12, 0x40, 0x17, 0x12, 0x17, 0x12, 0x40, 0x17, 0x49, 0x12, 0x48,
+  0x25, 0x44, 0x2d, 0x41, 0x05, 0x48, 0x0d, 0x4a, 0x05, 0x43, 0x2d, 0x40,
+  0x2f, 0x2d, 0x2f, 0x2d, 0x40, 0x2f, 0x49, 0x2d, 0x48, 0x2c, 0x44, 0x24,
+  0x41, 0x04, 0x48, 0x0c, 0x4a, 0x04, 0x43, 0x24, 0x40, 0x27, 0x24, 0x27,
+  0x24, 0x40, 0x27, 0x49, 0x24, 0x48, 0x3c, 0x44, 0x24, 0x41, 0x04, 0x48,
+  0x2c, 0x04, 0x48, 0x3c, 0x04, 0x43, 0x24, 0x40, 0x27, 0x24, 0x27, 0x24,
+  0x40, 0x27, 0x49, 0x24, 0x48, 0x2e, 0x44, 0x36, 0x41, 0x06, 0x48, 0x1e,
+  0x4a, 0x06, 0x43, 0x36, 0x40, 0x37, 0x36, 0x37, 0x36, 0x40, 0x37, 0x49,
+  0x36, 0x4e, 0x24, 0x41, 0x04, 0x48, 0x0c, 0x4a, 0x04, 0x43, 0x24, 0x40,
+  0x27, 0x24, 0x27, 0x24, 0x40, 0x27, 0x49, 0x24, 0x48, 0x20, 0x88, 0x48,
+  0x28, 0x80, 0x48, 0x38, 0x85, 0x40, 0x07, 0x80, 0x07, 0x80, 0x40, 0x07,
+  0x8a, 0x48, 0x20, 0x88, 0x48, 0x18, 0x90, 0x40, 0x07, 0x80, 0x07, 0x80,
+  0x40, 0x07, 0x8a, 0x41, 0x2a, 0x4a, 0x12, 0x42, 0x02, 0x90, 0x42, 0x02,
+  0x56, 0x12, 0x41, 0x25, 0x4a, 0x2d, 0x42, 0x05, 0x90, 0x42, 0x05, 0x56,
+  0x2d, 0x41, 0x2c, 0x4a, 0x24, 0x42, 0x04, 0x90, 0x42, 0x04, 0x56, 0x24,
+  0x41, 0x3c, 0x4a, 0x24, 0x04, 0x41, 0x3c, 0x90, 0x42, 0x04, 0x56, 0x24,
+  0x41, 0x2e, 0x4a, 0x36, 0x42, 0x06, 0x90, 0x42, 0x06, 0x56, 0x36, 0x4d,
+  0x24, 0x42, 0x04, 0x90, 0x42, 0x04, 0x56, 0x24, 0x41, 0x20, 0x8c, 0x41,
+  0x38, 0xac, 0x41, 0x20, 0xbc, 0x4d, 0x12, 0x41, 0x02, 0x80, 0x03, 0x13,
+  0x42, 0x03, 0x43, 0x13, 0x42, 0x03, 0x13, 0x03, 0x80, 0x40, 0x02, 0x48,
+  0x12, 0x17, 0x4c, 0x12, 0x4d, 0x2d, 0x41, 0x05, 0x80, 0x01, 0x29, 0x42,
+  0x01, 0x43, 0x29, 0x42, 0x01, 0x29, 0x01, 0x80, 0x40, 0x05, 0x48, 0x2d,
+  0x2f, 0x4c, 0x2d, 0x4d, 0x24, 0x41, 0x04, 0x80, 0x01, 0x21, 0x42, 0x01,
+  0x43, 0x21, 0x42, 0x01, 0x21, 0x01, 0x80, 0x40, 0x04, 0x48, 0x24, 0x27,
+  0x5b, 0x24, 0x04, 0x40, 0x3c, 0x80, 0x05, 0x25, 0x05, 0x40, 0x3d, 0x05,
+  0x43, 0x25, 0x05, 0x40, 0x3d, 0x05, 0x25, 0x05, 0x38, 0x3c, 0x04, 0x48,
+  0x24, 0x27, 0x4c, 0x24, 0x4d, 0x36, 0x41, 0x06, 0x80, 0x03, 0x33, 0x42,
+  0x03, 0x43, 0x33, 0x42, 0x03, 0x33, 0x03, 0x80, 0x40, 0x06, 0x48, 0x36,
+  0x37, 0x4c, 0x36, 0x4d, 0x24, 0x41, 0x04, 0x80, 0x01, 0x21, 0x42, 0x01,
+  0x43, 0x21, 0x42, 0x01, 0x21, 0x01, 0x80, 0x40, 0x04, 0x48, 0x24, 0x27,
+  0x4c, 0x24, 0x8f, 0x40, 0x38, 0x80, 0x41, 0x05, 0x40, 0x3d, 0x45, 0x05,
+  0x40, 0x3d, 0x41, 0x05, 0x40, 0x38, 0x8a, 0x07, 0xa0, 0x4f, 0x03, 0x8c,
+  0x07, 0x8d, 0x4d, 0x12, 0x40, 0x02, 0x80, 0x03, 0x40, 0x13, 0x41, 0x05,
+  0x45, 0x15, 0x41, 0x05, 0x40, 0x13, 0x03, 0x80, 0x49, 0x12, 0x17, 0x40,
+  0x12, 0x17, 0x49, 0x12, 0x4d, 0x2d, 0x40, 0x05, 0x80, 0x01, 0x40, 0x29,
+  0x41, 0x05, 0x45, 0x2d, 0x41, 0x05, 0x40, 0x29, 0x01, 0x80, 0x49, 0x2d,
+  0x2f, 0x40, 0x2d, 0x2f, 0x49, 0x2d, 0x4d, 0x24, 0x40, 0x04, 0x80, 0x01,
+  0x40, 0x21, 0x41, 0x05, 0x45, 0x25, 0x41, 0x05, 0x40, 0x21, 0x01, 0x80,
+  0x49, 0x24, 0x27, 0x40, 0x24, 0x27, 0x58, 0x24, 0x40, 0x04, 0x80, 0x05,
+  0x40, 0x25, 0x41, 0x07, 0x45, 0x27, 0x41, 0x07, 0x40, 0x25, 0x05, 0x80,
+  0x49, 0x24, 0x27, 0x40, 0x24, 0x27, 0x49, 0x24, 0x4d, 0x36, 0x40, 0x06,
+  0x80, 0x03, 0x40, 0x33, 0x41, 0x05, 0x45, 0x35, 0x41, 0x05, 0x40, 0x33,
+  0x03, 0x80, 0x49, 0x36, 0x37, 0x40, 0x36, 0x37, 0x49, 0x36, 0x4d, 0x24,
+  0x40, 0x04, 0x80, 0x01, 0x40, 0x21, 0x41, 0x05, 0x45, 0x25, 0x41, 0x05,
+  0x40, 0x21, 0x01, 0x80, 0x49, 0x24, 0x27, 0x40, 0x24, 0x27, 0x49, 0x24,
+  0x91, 0x41, 0x05, 0x4b, 0x07, 0x41, 0x05, 0x8b, 0x07, 0x81, 0x07, 0x9c,
+  0x41, 0x03, 0x4b, 0x05, 0x41, 0x03, 0x8b, 0x07, 0x81, 0x07, 0x8a, 0x48,
+  0x12, 0x45, 0x11, 0x10, 0x40, 0x13, 0x44, 0x15, 0x11, 0x40, 0x15, 0x11,
+  0x43, 0x15, 0x40, 0x13, 0x10, 0x4c, 0x12, 0x17, 0x49, 0x12, 0x48, 0x2d,
+  0x45, 0x29, 0x28, 0x40, 0x29, 0x44, 0x2d, 0x29, 0x40, 0x2d, 0x29, 0x43,
+  0x2d, 0x40, 0x29, 0x28, 0x4c, 0x2d, 0x2f, 0x49, 0x2d, 0x48, 0x24, 0x45,
+  0x21, 0x20, 0x40, 0x21, 0x44, 0x25, 0x21, 0x40, 0x25, 0x21, 0x43, 0x25,
+  0x40, 0x21, 0x20, 0x4c, 0x24, 0x27, 0x53, 0x24, 0x45, 0x21, 0x20, 0x40,
+  0x25, 0x4d, 0x27, 0x40, 0x25, 0x20, 0x4c, 0x24, 0x27, 0x49, 0x24, 0x48,
+  0x36, 0x45, 0x31, 0x30, 0x40, 0x33, 0x44, 0x35, 0x31, 0x40, 0x35, 0x31,
+  0x43, 0x35, 0x40, 0x33, 0x30, 0x4c, 0x36, 0x37, 0x49, 0x36, 0x48, 0x24,
+  0x45, 0x21, 0x20, 0x40, 0x21, 0x44, 0x25, 0x21, 0x40, 0x25, 0x21, 0x43,
+  0x25, 0x40, 0x21, 0x20, 0x4c, 0x24, 0x27, 0x49, 0x24, 0x89, 0x45, 0x01,
+  0x80, 0x40, 0x05, 0x44, 0x07, 0x05, 0x40, 0x07, 0x05, 0x43, 0x07, 0x40,
+  0x05, 0x8e, 0x07, 0x94, 0x45, 0x01, 0x80, 0x40, 0x03, 0x44, 0x05, 0x01,
+  0x40, 0x05, 0x01, 0x43, 0x05, 0x40, 0x03, 0x8e, 0x07, 0x8a, 0x41, 0x12,
+  0x4c, 0x11, 0x10, 0x13, 0x40, 0x15, 0x11, 0x4c, 0x15, 0x13, 0x10, 0x58,
+  0x12, 0x41, 0x2d, 0x4c, 0x29, 0x28, 0x29, 0x40, 0x2d, 0x29, 0x4c, 0x2d,
+  0x29, 0x28, 0x58, 0x2d, 0x41, 0x24, 0x4c, 0x21, 0x20, 0x21, 0x40, 0x25,
+  0x21, 0x4c, 0x25, 0x21, 0x20, 0x5b, 0x24, 0x4c, 0x21, 0x20, 0x25, 0x4f,
+  0x27, 0x25, 0x20, 0x58, 0x24, 0x41, 0x36, 0x4c, 0x31, 0x30, 0x33, 0x40,
+  0x35, 0x31, 0x4c, 0x35, 0x33, 0x30, 0x58, 0x36, 0x41, 0x24, 0x4c, 0x21,
+  0x20, 0x21, 0x40, 0x25, 0x21, 0x4c, 0x25, 0x21, 0x20, 0x58, 0x24, 0x82,
+  0x4c, 0x01, 0x80, 0x05, 0x40, 0x07, 0x05, 0x4c, 0x07, 0x05, 0x9d, 0x4c,
+  0x01, 0x80, 0x03, 0x40, 0x05, 0x01, 0x4c, 0x05, 0x03, 0x9a, 0x4f, 0x11,
+  0x10, 0x13, 0x48, 0x15, 0x40, 0x10, 0x40, 0x15, 0x11, 0x40, 0x15, 0x13,
+  0x10, 0x12, 0x40, 0x10, 0x46, 0x12, 0x40, 0x17, 0x12, 0x17, 0x12, 0x40,
+  0x17, 0x46, 0x12, 0x4f, 0x29, 0x28, 0x29, 0x48, 0x2d, 0x40, 0x28, 0x40,
+  0x2d, 0x29, 0x40, 0x2d, 0x29, 0x28, 0x2d, 0x40, 0x28, 0x46, 0x2d, 0x40,
+  0x2f, 0x2d, 0x2f, 0x2d, 0x40, 0x2f, 0x46, 0x2d, 0x4f, 0x21, 0x20, 0x21,
+  0x48, 0x25, 0x40, 0x20, 0x40, 0x25, 0x21, 0x40, 0x25, 0x21, 0x20, 0x24,
+  0x40, 0x20, 0x46, 0x24, 0x40, 0x27, 0x24, 0x27, 0x24, 0x40, 0x27, 0x46,
+  0x24, 0x48, 0x21, 0x45, 0x23, 0x20, 0x25, 0x48, 0x27, 0x40, 0x20, 0x43,
+  0x27, 0x25, 0x20, 0x24, 0x40, 0x20, 0x46, 0x24, 0x40, 0x27, 0x24, 0x27,
+  0x24, 0x40, 0x27, 0x46, 0x24, 0x4f, 0x31, 0x30, 0x33, 0x48, 0x35, 0x40,
+  0x30, 0x40, 0x35, 0x31, 0x40, 0x35, 0x33, 0x30, 0x36, 0x40, 0x30, 0x46,
+  0x36, 0x40, 0x37, 0x36, 0x37, 0x36, 0x40, 0x37, 0x46, 0x36, 0x4f, 0x21,
+  0x20, 0x21, 0x48, 0x25, 0x40, 0x20, 0x40, 0x25, 0x21, 0x40, 0x25, 0x21,
+  0x20, 0x24, 0x40, 0x20, 0x46, 0x24, 0x40, 0x27, 0x24, 0x27, 0x24, 0x40,
+  0x27, 0x46, 0x24, 0x48, 0x01, 0x45, 0x03, 0x80, 0x05, 0x48, 0x07, 0x81,
+  0x40, 0x07, 0x05, 0x40, 0x07, 0x05, 0x8b, 0x40, 0x07, 0x80, 0x07, 0x80,
+  0x40, 0x07, 0x87, 0x4f, 0x01, 0x80, 0x03, 0x48, 0x05, 0x81, 0x40, 0x05,
+  0x01, 0x40, 0x05, 0x03, 0x8b, 0x40, 0x07, 0x80, 0x07, 0x80, 0x40, 0x07,
+  0x87, 0x4f, 0x11, 0x10, 0x13, 0x15, 0x17, 0x45, 0x15, 0x42, 0x10, 0x42,
+  0x15, 0x13, 0x43, 0x10, 0x54, 0x12, 0x4f, 0x29, 0x28, 0x29, 0x2d, 0x2f,
+  0x45, 0x2d, 0x42, 0x28, 0x42, 0x2d, 0x29, 0x43, 0x28, 0x54, 0x2d, 0x4f,
+  0x21, 0x20, 0x21, 0x25, 0x27, 0x45, 0x25, 0x42, 0x20, 0x42, 0x25, 0x21,
+  0x43, 0x20, 0x54, 0x24, 0x41, 0x21, 0x4c, 0x23, 0x20, 0x25, 0x47, 0x27,
+  0x20, 0x40, 0x27, 0x20, 0x42, 0x27, 0x25, 0x40, 0x20, 0x40, 0x27, 0x20,
+  0x54, 0x24, 0x4f, 0x31, 0x30, 0x33, 0x35, 0x37, 0x45, 0x35, 0x42, 0x30,
+  0x42, 0x35, 0x33, 0x43, 0x30, 0x54, 0x36, 0x4f, 0x21, 0x20, 0x21, 0x25,
+  0x27, 0x45, 0x25, 0x42, 0x20, 0x42, 0x25, 0x21, 0x43, 0x20, 0x54, 0x24,
+  0x41, 0x01, 0x4c, 0x03, 0x80, 0x05, 0x47, 0x07, 0x80, 0x40, 0x07, 0x80,
+  0x42, 0x07, 0x05, 0x81, 0x40, 0x07, 0x96, 0x4f, 0x01, 0x80, 0x03, 0x05,
+  0x07, 0x45, 0x05, 0x83, 0x42, 0x05, 0x03, 0x9a, 0x48, 0x11, 0x13, 0x42,
+  0x10, 0x40, 0x13, 0x10, 0x17, 0x41, 0x15, 0x17, 0x40, 0x15, 0x11, 0x40,
+  0x15, 0x43, 0x10, 0x41, 0x15, 0x13, 0x43, 0x10, 0x48, 0x12, 0x17, 0x49,
+  0x12, 0x48, 0x29, 0x2b, 0x42, 0x28, 0x40, 0x2b, 0x28, 0x2f, 0x41, 0x2d,
+  0x2f, 0x40, 0x2d, 0x29, 0x40, 0x2d, 0x43, 0x28, 0x41, 0x2d, 0x29, 0x43,
+  0x28, 0x48, 0x2d, 0x2f, 0x49, 0x2d, 0x48, 0x21, 0x23, 0x42, 0x20, 0x40,
+  0x23, 0x20, 0x27, 0x41, 0x25, 0x27, 0x40, 0x25, 0x21, 0x40, 0x25, 0x43,
+  0x20, 0x41, 0x25, 0x21, 0x43, 0x20, 0x48, 0x24, 0x27, 0x49, 0x24, 0x49,
+  0x23, 0x42, 0x20, 0x40, 0x23, 0x20, 0x48, 0x27, 0x20, 0x41, 0x27, 0x20,
+  0x41, 0x27, 0x25, 0x20, 0x41, 0x27, 0x20, 0x48, 0x24, 0x27, 0x49, 0x24,
+  0x48, 0x31, 0x33, 0x42, 0x30, 0x40, 0x33, 0x30, 0x37, 0x41, 0x35, 0x37,
+  0x40, 0x35, 0x31, 0x40, 0x35, 0x43, 0x30, 0x41, 0x35, 0x33, 0x43, 0x30,
+  0x48, 0x36, 0x37, 0x49, 0x36, 0x48, 0x21, 0x23, 0x42, 0x20, 0x40, 0x23,
+  0x20, 0x27, 0x41, 0x25, 0x27, 0x40, 0x25, 0x21, 0x40, 0x25, 0x43, 0x20,
+  0x41, 0x25, 0x21, 0x43, 0x20, 0x48, 0x24, 0x27, 0x49, 0x24, 0x49, 0x03,
+  0x83, 0x40, 0x03, 0x80, 0x45, 0x07, 0x05, 0x40, 0x07, 0x80, 0x41, 0x07,
+  0x80, 0x41, 0x07, 0x05, 0x80, 0x41, 0x07, 0x8a, 0x07, 0x8a, 0x48, 0x01,
+  0x03, 0x83, 0x40, 0x03, 0x80, 0x07, 0x41, 0x05, 0x07, 0x40, 0x05, 0x01,
+  0x40, 0x05, 0x84, 0x41, 0x05, 0x03, 0x8e, 0x07, 0x8a, 0x41, 0x11, 0x46,
+  0x13, 0x43, 0x10, 0x13, 0x10, 0x13, 0x47, 0x15, 0x4c, 0x10, 0x48, 0x12,
+  0x17, 0x49, 0x12, 0x41, 0x29, 0x46, 0x2b, 0x43, 0x28, 0x2b, 0x28, 0x29,
+  0x47, 0x2d, 0x4c, 0x28, 0x48, 0x2d, 0x2f, 0x49, 0x2d, 0x41, 0x21, 0x46,
+  0x23, 0x43, 0x20, 0x23, 0x20, 0x21, 0x47, 0x25, 0x4c, 0x20, 0x48, 0x24,
+  0x27, 0x49, 0x24, 0x49, 0x23, 0x20, 0x40, 0x27, 0x40, 0x20, 0x23, 0x20,
+  0x25, 0x47, 0x27, 0x20, 0x42, 0x27, 0x42, 0x20, 0x42, 0x27, 0x20, 0x48,
+  0x24, 0x27, 0x49, 0x24, 0x41, 0x31, 0x46, 0x33, 0x43, 0x30, 0x33, 0x30,
+  0x33, 0x47, 0x35, 0x4c, 0x30, 0x48, 0x36, 0x37, 0x49, 0x36, 0x41, 0x21,
+  0x46, 0x23, 0x43, 0x20, 0x23, 0x20, 0x21, 0x47, 0x25, 0x4c, 0x20, 0x48,
+  0x24, 0x27, 0x49, 0x24, 0x49, 0x03, 0x80, 0x40, 0x07, 0x81, 0x03, 0x80,
+  0x05, 0x47, 0x07, 0x80, 0x42, 0x07, 0x83, 0x42, 0x07, 0x8a, 0x07, 0x8a,
+  0x41, 0x01, 0x46, 0x03, 0x84, 0x03, 0x80, 0x03, 0x47, 0x05, 0x97, 0x07,
+  0x8a, 0x48, 0x13, 0x12, 0x44, 0x10, 0x17, 0x13, 0x41, 0x15, 0x11, 0x17,
+  0x42, 0x15, 0x4c, 0x10, 0x54, 0x12, 0x48, 0x2b, 0x2a, 0x44, 0x28, 0x2f,
+  0x29, 0x41, 0x2d, 0x29, 0x2f, 0x42, 0x2d, 0x4c, 0x28, 0x54, 0x2d, 0x48,
+  0x23, 0x22, 0x44, 0x20, 0x27, 0x21, 0x41, 0x25, 0x21, 0x27, 0x42, 0x25,
+  0x4c, 0x20, 0x54, 0x24, 0x49, 0x23, 0x40, 0x20, 0x40, 0x27, 0x40, 0x20,
+  0x27, 0x25, 0x47, 0x27, 0x20, 0x4a, 0x27, 0x20, 0x54, 0x24, 0x48, 0x33,
+  0x32, 0x44, 0x30, 0x37, 0x33, 0x41, 0x35, 0x31, 0x37, 0x42, 0x35, 0x4c,
+  0x30, 0x54, 0x36, 0x48, 0x23, 0x22, 0x44, 0x20, 0x27, 0x21, 0x41, 0x25,
+  0x21, 0x27, 0x42, 0x25, 0x4c, 0x20, 0x54, 0x24, 0x48, 0x03, 0x02, 0x81,
+  0x40, 0x07, 0x81, 0x07, 0x05, 0x41, 0x07, 0x05, 0x43, 0x07, 0x80, 0x4a,
+  0x07, 0x96, 0x48, 0x03, 0x02, 0x85, 0x07, 0x03, 0x41, 0x05, 0x01, 0x07,
+  0x42, 0x05, 0xa3, 0x01, 0x06, 0x00, 0x00, 0x8a, 0x10, 0x8e, 0x28, 0x82,
+  0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x10, 0x9e, 0x10, 0x8e, 0x28, 0x82,
+  0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x28, 0x9e, 0x10, 0x8e, 0x28, 0x82,
+  0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x20, 0x9e, 0x18, 0x42, 0x38, 0x8a,
+  0x40, 0x38, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x80, 0x38, 0x20, 0x9e,
+  0x10, 0x8e, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x30, 0x9e,
+  0x10, 0x8e, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x20, 0x9e,
+  0x10, 0x42, 0x38, 0x8a, 0x40, 0x38, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38,
+  0x80, 0x38, 0x9f, 0x10, 0x8e, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38,
+  0xa3, 0x20, 0x84, 0x20, 0x82, 0x10, 0x83, 0x28, 0x8e, 0x10, 0x9f, 0x20,
+  0x84, 0x30, 0x82, 0x10, 0x83, 0x28, 0x8e, 0x28, 0x9f, 0x20, 0x84, 0x30,
+  0x82, 0x10, 0x83, 0x28, 0x8e, 0x20, 0x9f, 0x30, 0x40, 0x38, 0x82, 0x10,
+  0x87, 0x40, 0x38, 0x81, 0x38, 0x80, 0x38, 0x83, 0x38, 0x80, 0x38, 0x80,
+  0x38, 0x20, 0x9f, 0x20, 0x84, 0x20, 0x82, 0x10, 0x83, 0x28, 0x8e, 0x30,
+  0x9f, 0x20, 0x84, 0x30, 0x82, 0x10, 0x83, 0x28, 0x8e, 0x20, 0x9f, 0x30,
+  0x40, 0x38, 0x82, 0x10, 0x87, 0x40, 0x38, 0x81, 0x38, 0x80, 0x38, 0x83,
+  0x38, 0x80, 0x38, 0x80, 0x38, 0xa0, 0x20, 0x84, 0x20, 0x82, 0x10, 0x83,
+  0x28, 0xb2, 0x20, 0x38, 0x82, 0x10, 0x85, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x10, 0x81, 0x05, 0x81, 0x05, 0x9c, 0x20, 0x38,
+  0x82, 0x10, 0x85, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08,
+  0x28, 0x81, 0x02, 0x81, 0x02, 0x9c, 0x20, 0x38, 0x82, 0x10, 0x85, 0x28,
+  0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x81, 0x03, 0x81,
+  0x03, 0x9c, 0x30, 0x38, 0x89, 0x40, 0x38, 0x8c, 0x38, 0x20, 0x81, 0x03,
+  0x81, 0x03, 0x9c, 0x20, 0x38, 0x82, 0x10, 0x85, 0x28, 0x80, 0x08, 0x80,
+  0x08, 0x87, 0x08, 0x80, 0x08, 0x30, 0x81, 0x01, 0x81, 0x01, 0x9c, 0x20,
+  0x38, 0x82, 0x10, 0x85, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80,
+  0x08, 0x20, 0x81, 0x03, 0x81, 0x03, 0x9c, 0x30, 0x38, 0x89, 0x40, 0x38,
+  0x8c, 0x38, 0x82, 0x07, 0x81, 0x07, 0x9c, 0x20, 0x38, 0x82, 0x10, 0x85,
+  0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x82, 0x07, 0x81,
+  0x07, 0x9d, 0x10, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80,
+  0x08, 0x10, 0x05, 0x82, 0x40, 0x05, 0x9d, 0x18, 0x89, 0x28, 0x80, 0x08,
+  0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x28, 0x02, 0x82, 0x40, 0x02, 0x9d,
+  0x10, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20,
+  0x03, 0x82, 0x40, 0x03, 0xa8, 0x40, 0x38, 0x82, 0x40, 0x38, 0x80, 0x40,
+  0x38, 0x80, 0x40, 0x38, 0x81, 0x38, 0x20, 0x03, 0x82, 0x40, 0x03, 0x9d,
+  0x10, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x30,
+  0x01, 0x82, 0x40, 0x01, 0x9d, 0x18, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x20, 0x03, 0x82, 0x40, 0x03, 0x9d, 0x18, 0x89,
+  0x40, 0x38, 0x82, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80, 0x40, 0x38, 0x81,
+  0x38, 0x80, 0x07, 0x82, 0x40, 0x07, 0x9d, 0x18, 0x89, 0x28, 0x80, 0x08,
+  0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x80, 0x07, 0x82, 0x40, 0x07, 0x9b,
+  0x40, 0x10, 0x80, 0x38, 0x20, 0x88, 0x28, 0x8c, 0x10, 0xa2, 0x40, 0x18,
+  0x80, 0x38, 0x30, 0x88, 0x28, 0x8c, 0x28, 0xa2, 0x40, 0x10, 0x80, 0x38,
+  0x30, 0x88, 0x28, 0x8c, 0x20, 0xa5, 0x38, 0x10, 0x88, 0x40, 0x38, 0x81,
+  0x38, 0x85, 0x38, 0x80, 0x38, 0x20, 0xa2, 0x40, 0x10, 0x80, 0x38, 0x20,
+  0x88, 0x28, 0x8c, 0x30, 0xa2, 0x40, 0x18, 0x80, 0x38, 0x30, 0x88, 0x28,
+  0x8c, 0x20, 0xa2, 0x40, 0x18, 0x80, 0x38, 0x10, 0x88, 0x40, 0x38, 0x81,
+  0x38, 0x85, 0x38, 0x80, 0x38, 0xa3, 0x40, 0x18, 0x80, 0x38, 0x20, 0x88,
+  0x28, 0xb2, 0x38, 0x8b, 0x18, 0x8a, 0x10, 0x80, 0x05, 0x81, 0x40, 0x05,
+  0x82, 0x40, 0x05, 0x9a, 0x38, 0x8b, 0x08, 0x8a, 0x28, 0x80, 0x02, 0x81,
+  0x40, 0x02, 0x82, 0x40, 0x02, 0x9a, 0x38, 0x8b, 0x08, 0x8a, 0x20, 0x80,
+  0x03, 0x81, 0x40, 0x03, 0x82, 0x40, 0x03, 0x9a, 0x38, 0x8b, 0x28, 0x38,
+  0x88, 0x38, 0x20, 0x80, 0x03, 0x81, 0x40, 0x03, 0x82, 0x40, 0x03, 0x9a,
+  0x38, 0x8b, 0x18, 0x8a, 0x30, 0x80, 0x01, 0x81, 0x40, 0x01, 0x82, 0x40,
+  0x01, 0x9a, 0x38, 0x8b, 0x08, 0x8a, 0x20, 0x80, 0x03, 0x81, 0x40, 0x03,
+  0x82, 0x40, 0x03, 0x9a, 0x38, 0x8b, 0x28, 0x38, 0x88, 0x38, 0x81, 0x07,
+  0x81, 0x40, 0x07, 0x82, 0x40, 0x07, 0x9a, 0x38, 0x8b, 0x18, 0x8c, 0x07,
+  0x81, 0x40, 0x07, 0x82, 0x40, 0x07, 0x99, 0x10, 0x38, 0x96, 0x10, 0xa5,
+  0x28, 0x38, 0x96, 0x28, 0xa5, 0x20, 0x38, 0x96, 0x20, 0xa5, 0x20, 0x97,
+  0x20, 0xa5, 0x30, 0x38, 0x96, 0x30, 0xa5, 0x20, 0x38, 0x96, 0x20, 0xc0,
+  0x66, 0x00, 0x38, 0xbd, 0x10, 0x8d, 0x10, 0x82, 0x40, 0x10, 0x82, 0x10,
+  0x83, 0x05, 0x82, 0x40, 0x05, 0x9c, 0x28, 0x8d, 0x28, 0x82, 0x40, 0x28,
+  0x82, 0x28, 0x83, 0x02, 0x82, 0x40, 0x02, 0x9c, 0x20, 0x8d, 0x20, 0x82,
+  0x40, 0x20, 0x82, 0x20, 0x83, 0x03, 0x82, 0x40, 0x03, 0x9c, 0x20, 0x38,
+  0x80, 0x38, 0x8a, 0x20, 0x38, 0x80, 0x38, 0x40, 0x20, 0x38, 0x80, 0x38,
+  0x20, 0x83, 0x03, 0x82, 0x40, 0x03, 0x9c, 0x30, 0x8d, 0x30, 0x82, 0x40,
+  0x30, 0x82, 0x30, 0x83, 0x01, 0x82, 0x40, 0x01, 0x9c, 0x20, 0x8d, 0x20,
+  0x82, 0x40, 0x20, 0x82, 0x20, 0x83, 0x03, 0x82, 0x40, 0x03, 0x9d, 0x38,
+  0x80, 0x38, 0x8b, 0x38, 0x80, 0x38, 0x81, 0x38, 0x80, 0x38, 0x84, 0x07,
+  0x82, 0x40, 0x07, 0xb9, 0x07, 0x82, 0x40, 0x07, 0x9c, 0x10, 0x84, 0x10,
+  0x81, 0x10, 0x85, 0x10, 0x81, 0x10, 0x80, 0x10, 0x80, 0x40, 0x10, 0x85,
+  0x05, 0x84, 0x05, 0x99, 0x28, 0x84, 0x28, 0x81, 0x28, 0x85, 0x28, 0x81,
+  0x28, 0x80, 0x28, 0x80, 0x40, 0x28, 0x85, 0x02, 0x84, 0x02, 0x99, 0x20,
+  0x84, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x80, 0x40,
+  0x20, 0x85, 0x03, 0x84, 0x03, 0x99, 0x20, 0x84, 0x20, 0x81, 0x20, 0x85,
+  0x20, 0x81, 0x20, 0x80, 0x20, 0x80, 0x40, 0x20, 0x85, 0x03, 0x84, 0x03,
+  0x99, 0x30, 0x84, 0x30, 0x81, 0x30, 0x85, 0x30, 0x81, 0x30, 0x80, 0x30,
+  0x80, 0x40, 0x30, 0x85, 0x01, 0x84, 0x01, 0x99, 0x20, 0x84, 0x20, 0x81,
+  0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x80, 0x40, 0x20, 0x85, 0x03,
+  0x84, 0x03, 0xb8, 0x07, 0x84, 0x07, 0xb8, 0x07, 0x84, 0x07, 0xb9, 0x05,
+  0x82, 0x40, 0x05, 0xb9, 0x02, 0x82, 0x40, 0x02, 0xb9, 0x03, 0x82, 0x40,
+  0x03, 0xb9, 0x03, 0x82, 0x40, 0x03, 0xb9, 0x01, 0x82, 0x40, 0x01, 0xb9,
+  0x03, 0x82, 0x40, 0x03, 0xb9, 0x07, 0x82, 0x40, 0x07, 0xb9, 0x07, 0x82,
+  0x40, 0x07, 0xc2, 0x27, 0x00, 0x05, 0x80, 0x05, 0x86, 0x02, 0x80, 0x02,
+  0x83, 0x05, 0x81, 0x40, 0x05, 0x82, 0x40, 0x05, 0xa4, 0x05, 0x80, 0x05,
+  0x86, 0x05, 0x80, 0x05, 0x83, 0x02, 0x81, 0x40, 0x02, 0x82, 0x40, 0x02,
+  0xa4, 0x05, 0x80, 0x05, 0x86, 0x04, 0x80, 0x04, 0x83, 0x03, 0x81, 0x40,
+  0x03, 0x82, 0x40, 0x03, 0xa4, 0x07, 0x80, 0x07, 0x86, 0x04, 0x80, 0x04,
+  0x83, 0x03, 0x81, 0x40, 0x03, 0x82, 0x40, 0x03, 0xa4, 0x05, 0x80, 0x05,
+  0x86, 0x06, 0x80, 0x06, 0x83, 0x01, 0x81, 0x40, 0x01, 0x82, 0x40, 0x01,
+  0xa4, 0x05, 0x80, 0x05, 0x86, 0x04, 0x80, 0x04, 0x83, 0x03, 0x81, 0x40,
+  0x03, 0x82, 0x40, 0x03, 0xa4, 0x07, 0x80, 0x07, 0x8d, 0x07, 0x81, 0x40,
+  0x07, 0x82, 0x40, 0x07, 0xa4, 0x05, 0x80, 0x05, 0x8d, 0x07, 0x81, 0x40,
+  0x07, 0x82, 0x40, 0x07, 0x9b, 0x02, 0x86, 0x05, 0x82, 0x05, 0x84, 0x02,
+  0x82, 0x02, 0xa8, 0x02, 0x86, 0x05, 0x82, 0x05, 0x84, 0x05, 0x82, 0x05,
+  0xa8, 0x02, 0x86, 0x05, 0x82, 0x05, 0x84, 0x04, 0x82, 0x04, 0xb0, 0x40,
+  0x07, 0x80, 0x40, 0x07, 0x84, 0x04, 0x07, 0x80, 0x07, 0x04, 0xa8, 0x02,
+  0x86, 0x05, 0x82, 0x05, 0x84, 0x06, 0x82, 0x06, 0xa8, 0x02, 0x86, 0x05,
+  0x82, 0x05, 0x84, 0x04, 0x82, 0x04, 0xb0, 0x40, 0x07, 0x80, 0x40, 0x07,
+  0x85, 0x07, 0x80, 0x07, 0xa9, 0x02, 0x86, 0x05, 0x82, 0x05, 0xa9, 0x42,
+  0x03, 0x82, 0x04, 0x82, 0x02, 0x84, 0x05, 0x83, 0x05, 0x87, 0x02, 0x83,
+  0x05, 0x82, 0x40, 0x05, 0x95, 0x42, 0x03, 0x82, 0x06, 0x82, 0x02, 0x84,
+  0x05, 0x83, 0x05, 0x87, 0x05, 0x83, 0x02, 0x82, 0x40, 0x02, 0x95, 0x42,
+  0x03, 0x82, 0x06, 0x82, 0x02, 0x84, 0x05, 0x83, 0x05, 0x87, 0x04, 0x83,
+  0x03, 0x82, 0x40, 0x03, 0x95, 0x42, 0x03, 0x82, 0x02, 0x88, 0x40, 0x07,
+  0x81, 0x40, 0x07, 0x83, 0x07, 0x81, 0x07, 0x04, 0x83, 0x03, 0x82, 0x40,
+  0x03, 0x95, 0x42, 0x03, 0x82, 0x04, 0x82, 0x02, 0x84, 0x05, 0x83, 0x05,
+  0x87, 0x06, 0x83, 0x01, 0x82, 0x40, 0x01, 0x95, 0x42, 0x03, 0x82, 0x06,
+  0x82, 0x02, 0x84, 0x05, 0x83, 0x05, 0x87, 0x04, 0x83, 0x03, 0x82, 0x40,
+  0x03, 0x95, 0x42, 0x03, 0x82, 0x02, 0x88, 0x40, 0x07, 0x81, 0x40, 0x07,
+  0x83, 0x07, 0x81, 0x07, 0x84, 0x07, 0x82, 0x40, 0x07, 0x95, 0x42, 0x03,
+  0x82, 0x04, 0x82, 0x02, 0x84, 0x05, 0x83, 0x05, 0x8c, 0x07, 0x82, 0x40,
+  0x07, 0x95, 0x03, 0x81, 0x40, 0x03, 0x8b, 0x05, 0x8c, 0x02, 0x85, 0x05,
+  0x81, 0x05, 0x95, 0x03, 0x81, 0x40, 0x03, 0x8b, 0x05, 0x8c, 0x05, 0x85,
+  0x02, 0x81, 0x02, 0x95, 0x03, 0x81, 0x40, 0x03, 0x8b, 0x05, 0x8c, 0x04,
+  0x85, 0x03, 0x81, 0x03, 0x95, 0x03, 0x40, 0x07, 0x40, 0x03, 0x8b, 0x40,
+  0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x04, 0x85, 0x03, 0x81, 0x03,
+  0x95, 0x03, 0x81, 0x40, 0x03, 0x8b, 0x05, 0x8c, 0x06, 0x85, 0x01, 0x81,
+  0x01, 0x95, 0x03, 0x81, 0x40, 0x03, 0x8b, 0x05, 0x8c, 0x04, 0x85, 0x03,
+  0x81, 0x03, 0x95, 0x03, 0x40, 0x07, 0x40, 0x03, 0x8b, 0x40, 0x07, 0x82,
+  0x07, 0x82, 0x07, 0x82, 0x07, 0x86, 0x07, 0x81, 0x07, 0x95, 0x03, 0x81,
+  0x40, 0x03, 0x8b, 0x05, 0x93, 0x07, 0x81, 0x07, 0x99, 0x40, 0x02, 0x07,
+  0x84, 0x02, 0x83, 0x05, 0x8c, 0x02, 0xa3, 0x40, 0x02, 0x07, 0x84, 0x02,
+  0x83, 0x05, 0x8c, 0x05, 0xa3, 0x40, 0x02, 0x07, 0x84, 0x02, 0x83, 0x05,
+  0x8c, 0x04, 0xa0, 0x07, 0x80, 0x07, 0x40, 0x03, 0x07, 0x89, 0x40, 0x07,
+  0x8a, 0x07, 0x04, 0xa3, 0x40, 0x02, 0x07, 0x84, 0x02, 0x83, 0x05, 0x8c,
+  0x06, 0xa3, 0x40, 0x02, 0x07, 0x84, 0x02, 0x83, 0x05, 0x8c, 0x04, 0xa0,
+  0x07, 0x80, 0x07, 0x40, 0x02, 0x07, 0x89, 0x40, 0x07, 0x8a, 0x07, 0xa4,
+  0x40, 0x02, 0x07, 0x84, 0x02, 0x83, 0x05, 0xa2, 0x12, 0x07, 0x00, 0x00,
+  0x8a, 0x44, 0x10, 0x84, 0x20, 0x82, 0x20, 0x80, 0x28, 0x82, 0x38, 0x85,
+  0x38, 0x82, 0x10, 0x9e, 0x44, 0x10, 0x84, 0x20, 0x82, 0x20, 0x80, 0x28,
+  0x82, 0x38, 0x85, 0x38, 0x82, 0x28, 0x9e, 0x44, 0x10, 0x84, 0x20, 0x82,
+  0x20, 0x80, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x20, 0x9e, 0x18, 0x40,
+  0x20, 0x41, 0x18, 0x8a, 0x40, 0x38, 0x82, 0x38, 0x85, 0x38, 0x80, 0x38,
+  0x20, 0x9e, 0x44, 0x10, 0x84, 0x20, 0x82, 0x20, 0x80, 0x28, 0x82, 0x38,
+  0x85, 0x38, 0x82, 0x30, 0x9e, 0x44, 0x10, 0x84, 0x20, 0x82, 0x20, 0x80,
+  0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x20, 0x9e, 0x10, 0x40, 0x28, 0x41,
+  0x10, 0x84, 0x10, 0x82, 0x10, 0x80, 0x40, 0x38, 0x82, 0x38, 0x85, 0x38,
+  0x80, 0x38, 0x9f, 0x44, 0x10, 0x84, 0x20, 0x82, 0x20, 0x80, 0x28, 0x82,
+  0x38, 0x85, 0x38, 0xa3, 0x20, 0x38, 0x8b, 0x20, 0x84, 0x38, 0x85, 0x38,
+  0xa3, 0x20, 0x38, 0x8b, 0x20, 0x84, 0x38, 0x85, 0x38, 0xa3, 0x20, 0x38,
+  0x8b, 0x20, 0x84, 0x38, 0x85, 0x38, 0xa3, 0x30, 0x80, 0x41, 0x38, 0x8e,
+  0x38, 0x85, 0x38, 0xa3, 0x20, 0x38, 0x8b, 0x20, 0x84, 0x38, 0x85, 0x38,
+  0xa3, 0x20, 0x38, 0x8b, 0x20, 0x84, 0x38, 0x85, 0x38, 0xa3, 0x30, 0x80,
+  0x41, 0x38, 0x88, 0x10, 0x84, 0x38, 0x85, 0x38, 0xa3, 0x20, 0x38, 0x8b,
+  0x20, 0x84, 0x38, 0x85, 0x38, 0xa2, 0x40, 0x20, 0x18, 0x20, 0x80, 0x38,
+  0x86, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x82, 0x05, 0x9b, 0x40,
+  0x20, 0x18, 0x20, 0x80, 0x38, 0x86, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x82, 0x02, 0x9b, 0x40, 0x20, 0x18, 0x20, 0x80, 0x38, 0x86, 0x20,
+  0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x82, 0x03, 0x9b, 0x40, 0x30, 0x40,
+  0x08, 0x38, 0x8f, 0x40, 0x38, 0x84, 0x40, 0x38, 0x84, 0x03, 0x9b, 0x40,
+  0x20, 0x18, 0x20, 0x80, 0x38, 0x86, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x82, 0x01, 0x9b, 0x40, 0x20, 0x18, 0x20, 0x80, 0x38, 0x86, 0x20,
+  0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x82, 0x03, 0x9b, 0x40, 0x30, 0x40,
+  0x08, 0x38, 0x87, 0x10, 0x86, 0x40, 0x38, 0x84, 0x40, 0x38, 0x84, 0x07,
+  0x9b, 0x40, 0x20, 0x18, 0x20, 0x80, 0x38, 0x86, 0x20, 0x84, 0x40, 0x08,
+  0x88, 0x40, 0x08, 0x82, 0x07, 0x9b, 0x43, 0x28, 0x38, 0x81, 0x30, 0x80,
+  0x20, 0x81, 0x20, 0x92, 0x05, 0x82, 0x05, 0x99, 0x43, 0x20, 0x38, 0x81,
+  0x20, 0x80, 0x20, 0x81, 0x20, 0x92, 0x02, 0x82, 0x02, 0x99, 0x43, 0x28,
+  0x38, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x92, 0x03, 0x82, 0x03, 0x99,
+  0x38, 0x82, 0x40, 0x38, 0x81, 0x10, 0x8c, 0x38, 0x81, 0x38, 0x81, 0x38,
+  0x83, 0x03, 0x82, 0x03, 0x99, 0x43, 0x28, 0x38, 0x81, 0x30, 0x80, 0x20,
+  0x81, 0x20, 0x92, 0x01, 0x82, 0x01, 0x99, 0x43, 0x20, 0x38, 0x81, 0x20,
+  0x80, 0x20, 0x81, 0x20, 0x92, 0x03, 0x82, 0x03, 0x99, 0x20, 0x41, 0x18,
+  0x20, 0x38, 0x81, 0x10, 0x80, 0x10, 0x81, 0x10, 0x87, 0x38, 0x81, 0x38,
+  0x81, 0x38, 0x83, 0x07, 0x82, 0x07, 0x99, 0x43, 0x20, 0x38, 0x81, 0x30,
+  0x80, 0x20, 0x81, 0x20, 0x92, 0x07, 0x82, 0x07, 0x98, 0x40, 0x10, 0x28,
+  0x10, 0x38, 0x80, 0x10, 0x38, 0x20, 0x80, 0x30, 0x20, 0x85, 0x28, 0x80,
+  0x40, 0x08, 0x88, 0x40, 0x08, 0x10, 0x9d, 0x40, 0x18, 0x20, 0x18, 0x38,
+  0x80, 0x18, 0x38, 0x30, 0x80, 0x40, 0x20, 0x85, 0x28, 0x80, 0x40, 0x08,
+  0x88, 0x40, 0x08, 0x28, 0x9d, 0x40, 0x10, 0x28, 0x10, 0x38, 0x80, 0x10,
+  0x38, 0x30, 0x80, 0x40, 0x20, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x20, 0x9f, 0x38, 0x80, 0x38, 0x81, 0x38, 0x10, 0x80, 0x10, 0x86,
+  0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38, 0x82, 0x38, 0x20, 0x9d,
+  0x40, 0x10, 0x28, 0x10, 0x38, 0x80, 0x10, 0x38, 0x20, 0x80, 0x30, 0x20,
+  0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x30, 0x9d, 0x40, 0x18,
+  0x20, 0x18, 0x38, 0x80, 0x18, 0x38, 0x30, 0x80, 0x40, 0x20, 0x85, 0x28,
+  0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x20, 0x9d, 0x40, 0x18, 0x20, 0x18,
+  0x38, 0x80, 0x18, 0x38, 0x10, 0x80, 0x40, 0x10, 0x85, 0x40, 0x38, 0x83,
+  0x40, 0x38, 0x80, 0x40, 0x38, 0x82, 0x38, 0x9e, 0x40, 0x18, 0x20, 0x18,
+  0x38, 0x80, 0x18, 0x38, 0x20, 0x80, 0x30, 0x20, 0x85, 0x28, 0x80, 0x40,
+  0x08, 0x88, 0x40, 0x08, 0xa4, 0x28, 0x80, 0x18, 0x81, 0x46, 0x30, 0x18,
+  0x8b, 0x10, 0x05, 0x84, 0x05, 0x9d, 0x10, 0x80, 0x08, 0x81, 0x46, 0x20,
+  0x08, 0x8b, 0x28, 0x02, 0x84, 0x02, 0x9d, 0x18, 0x80, 0x08, 0x81, 0x46,
+  0x20, 0x08, 0x8b, 0x20, 0x03, 0x84, 0x03, 0x9d, 0x18, 0x80, 0x28, 0x81,
+  0x46, 0x10, 0x28, 0x38, 0x81, 0x45, 0x38, 0x80, 0x38, 0x20, 0x03, 0x84,
+  0x03, 0x9d, 0x08, 0x80, 0x18, 0x81, 0x46, 0x30, 0x18, 0x8b, 0x30, 0x01,
+  0x84, 0x01, 0x9d, 0x18, 0x80, 0x08, 0x81, 0x46, 0x20, 0x08, 0x8b, 0x20,
+  0x03, 0x84, 0x03, 0x9d, 0x38, 0x80, 0x28, 0x81, 0x46, 0x10, 0x28, 0x38,
+  0x81, 0x45, 0x38, 0x80, 0x38, 0x80, 0x07, 0x84, 0x07, 0x9d, 0x38, 0x80,
+  0x18, 0x81, 0x46, 0x30, 0x18, 0x8c, 0x07, 0x84, 0x07, 0x9a, 0x28, 0x81,
+  0x28, 0x81, 0x49, 0x1a, 0x44, 0x02, 0x84, 0x10, 0xa2, 0x10, 0x81, 0x10,
+  0x81, 0x49, 0x0d, 0x44, 0x05, 0x84, 0x28, 0xa2, 0x18, 0x81, 0x18, 0x81,
+  0x49, 0x0c, 0x44, 0x04, 0x84, 0x20, 0xa2, 0x18, 0x81, 0x18, 0x40, 0x38,
+  0x49, 0x2c, 0x04, 0x43, 0x3c, 0x43, 0x38, 0x20, 0xa2, 0x08, 0x81, 0x08,
+  0x81, 0x49, 0x1e, 0x44, 0x06, 0x84, 0x30, 0xa2, 0x18, 0x81, 0x18, 0x81,
+  0x49, 0x0c, 0x44, 0x04, 0x84, 0x20, 0xa2, 0x38, 0x81, 0x41, 0x38, 0x49,
+  0x28, 0x80, 0x48, 0x38, 0xa3, 0x38, 0x81, 0x38, 0x81, 0x49, 0x18, 0xae,
+  0x28, 0x81, 0x10, 0x80, 0x02, 0x03, 0x13, 0x42, 0x03, 0x44, 0x13, 0x42,
+  0x03, 0x13, 0x02, 0x82, 0x10, 0x82, 0x05, 0x82, 0x05, 0x9b, 0x10, 0x81,
+  0x28, 0x80, 0x05, 0x01, 0x29, 0x42, 0x01, 0x44, 0x29, 0x42, 0x01, 0x29,
+  0x05, 0x82, 0x28, 0x82, 0x02, 0x82, 0x02, 0x9b, 0x18, 0x81, 0x20, 0x80,
+  0x04, 0x01, 0x21, 0x42, 0x01, 0x44, 0x21, 0x42, 0x01, 0x21, 0x04, 0x82,
+  0x20, 0x82, 0x03, 0x82, 0x03, 0x9b, 0x18, 0x81, 0x20, 0x38, 0x04, 0x05,
+  0x25, 0x05, 0x40, 0x3d, 0x05, 0x44, 0x25, 0x05, 0x40, 0x3d, 0x05, 0x25,
+  0x04, 0x40, 0x38, 0x80, 0x20, 0x82, 0x03, 0x82, 0x03, 0x9b, 0x08, 0x81,
+  0x30, 0x80, 0x06, 0x03, 0x33, 0x42, 0x03, 0x44, 0x33, 0x42, 0x03, 0x33,
+  0x06, 0x82, 0x30, 0x82, 0x01, 0x82, 0x01, 0x9b, 0x18, 0x81, 0x20, 0x80,
+  0x04, 0x01, 0x21, 0x42, 0x01, 0x44, 0x21, 0x42, 0x01, 0x21, 0x04, 0x82,
+  0x20, 0x82, 0x03, 0x82, 0x03, 0x9b, 0x38, 0x82, 0x38, 0x80, 0x41, 0x05,
+  0x40, 0x3d, 0x46, 0x05, 0x40, 0x3d, 0x40, 0x05, 0x80, 0x40, 0x38, 0x84,
+  0x07, 0x82, 0x07, 0x9b, 0x38, 0x84, 0x4f, 0x03, 0x87, 0x07, 0x82, 0x07,
+  0x9e, 0x10, 0x02, 0x03, 0x40, 0x10, 0x42, 0x06, 0x16, 0x46, 0x06, 0x80,
+  0x10, 0x03, 0x02, 0x81, 0x10, 0x84, 0x05, 0x81, 0x05, 0x9d, 0x28, 0x05,
+  0x01, 0x40, 0x28, 0x42, 0x04, 0x2c, 0x46, 0x04, 0x80, 0x28, 0x01, 0x05,
+  0x81, 0x28, 0x84, 0x02, 0x81, 0x02, 0x9d, 0x20, 0x04, 0x01, 0x40, 0x20,
+  0x42, 0x04, 0x24, 0x46, 0x04, 0x80, 0x20, 0x01, 0x04, 0x81, 0x20, 0x84,
+  0x03, 0x81, 0x03, 0x9d, 0x20, 0x04, 0x3d, 0x18, 0x20, 0x40, 0x02, 0x40,
+  0x3a, 0x22, 0x45, 0x02, 0x3a, 0x38, 0x20, 0x05, 0x04, 0x40, 0x38, 0x20,
+  0x84, 0x03, 0x81, 0x03, 0x9d, 0x30, 0x06, 0x03, 0x40, 0x30, 0x42, 0x06,
+  0x36, 0x46, 0x06, 0x80, 0x30, 0x03, 0x06, 0x81, 0x30, 0x84, 0x01, 0x81,
+  0x01, 0x9d, 0x20, 0x04, 0x01, 0x40, 0x20, 0x42, 0x04, 0x24, 0x46, 0x04,
+  0x80, 0x20, 0x01, 0x04, 0x81, 0x20, 0x84, 0x03, 0x81, 0x03, 0x9f, 0x3d,
+  0x38, 0x80, 0x40, 0x02, 0x40, 0x3a, 0x46, 0x02, 0x3a, 0x38, 0x80, 0x05,
+  0x80, 0x40, 0x38, 0x85, 0x07, 0x81, 0x07, 0x9f, 0x03, 0x81, 0x4b, 0x06,
+  0x81, 0x03, 0x88, 0x07, 0x81, 0x07, 0x9e, 0x41, 0x10, 0x06, 0x81, 0x41,
+  0x10, 0x04, 0x81, 0x04, 0x82, 0x10, 0x16, 0x10, 0x81, 0x41, 0x10, 0x85,
+  0x05, 0x82, 0x05, 0x9c, 0x41, 0x28, 0x04, 0x81, 0x41, 0x28, 0x04, 0x81,
+  0x04, 0x82, 0x28, 0x2c, 0x28, 0x81, 0x41, 0x28, 0x85, 0x02, 0x82, 0x02,
+  0x9c, 0x41, 0x20, 0x04, 0x81, 0x41, 0x20, 0x04, 0x81, 0x04, 0x82, 0x20,
+  0x24, 0x20, 0x81, 0x41, 0x20, 0x85, 0x03, 0x82, 0x03, 0x9c, 0x41, 0x20,
+  0x02, 0x81, 0x41, 0x20, 0x86, 0x20, 0x22, 0x20, 0x81, 0x41, 0x20, 0x85,
+  0x03, 0x82, 0x03, 0x9c, 0x41, 0x30, 0x06, 0x81, 0x41, 0x30, 0x04, 0x81,
+  0x04, 0x82, 0x30, 0x36, 0x30, 0x81, 0x41, 0x30, 0x85, 0x01, 0x82, 0x01,
+  0x9c, 0x41, 0x20, 0x04, 0x81, 0x41, 0x20, 0x04, 0x81, 0x04, 0x82, 0x20,
+  0x24, 0x20, 0x81, 0x41, 0x20, 0x85, 0x03, 0x82, 0x03, 0x9f, 0x02, 0x84,
+  0x02, 0x81, 0x02, 0x83, 0x02, 0x8b, 0x07, 0x82, 0x07, 0x9f, 0x06, 0x84,
+  0x04, 0x81, 0x04, 0x83, 0x06, 0x8b, 0x07, 0x82, 0x07, 0x9e, 0x06, 0x80,
+  0x04, 0x83, 0x04, 0x81, 0x04, 0x84, 0x06, 0xae, 0x04, 0x80, 0x04, 0x83,
+  0x04, 0x81, 0x04, 0x84, 0x04, 0xae, 0x04, 0x80, 0x04, 0x83, 0x04, 0x81,
+  0x04, 0x84, 0x04, 0xae, 0x02, 0x8e, 0x02, 0xae, 0x06, 0x80, 0x04, 0x83,
+  0x04, 0x81, 0x04, 0x84, 0x06, 0xae, 0x04, 0x80, 0x04, 0x83, 0x04, 0x81,
+  0x04, 0x84, 0x04, 0xae, 0x02, 0x80, 0x02, 0x83, 0x02, 0x81, 0x02, 0x84,
+  0x02, 0xae, 0x06, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84, 0x06, 0xb0,
+  0x04, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40, 0x02, 0x83, 0x05, 0x84,
+  0x05, 0x9f, 0x04, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40, 0x05, 0x83,
+  0x02, 0x84, 0x02, 0x9f, 0x04, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40,
+  0x04, 0x83, 0x03, 0x84, 0x03, 0xa8, 0x40, 0x07, 0x87, 0x40, 0x04, 0x83,
+  0x03, 0x84, 0x03, 0x9f, 0x04, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40,
+  0x06, 0x83, 0x01, 0x84, 0x01, 0x9f, 0x04, 0x87, 0x40, 0x05, 0x80, 0x04,
+  0x85, 0x40, 0x04, 0x83, 0x03, 0x84, 0x03, 0x9f, 0x02, 0x87, 0x40, 0x07,
+  0x80, 0x02, 0x8b, 0x07, 0x84, 0x07, 0x9f, 0x04, 0x87, 0x40, 0x05, 0x80,
+  0x04, 0x8b, 0x07, 0x84, 0x07, 0xa7, 0x05, 0x81, 0x05, 0x04, 0x84, 0x02,
+  0x81, 0x02, 0xb1, 0x05, 0x81, 0x05, 0x04, 0x84, 0x05, 0x81, 0x05, 0xb1,
+  0x05, 0x81, 0x05, 0x04, 0x84, 0x04, 0x81, 0x04, 0xb1, 0x42, 0x07, 0x85,
+  0x04, 0x40, 0x07, 0x04, 0xb1, 0x05, 0x81, 0x05, 0x04, 0x84, 0x06, 0x81,
+  0x06, 0xb1, 0x05, 0x81, 0x05, 0x04, 0x84, 0x04, 0x81, 0x04, 0xb1, 0x42,
+  0x07, 0x02, 0x85, 0x40, 0x07, 0xb2, 0x05, 0x81, 0x05, 0x04, 0xb6, 0x04,
+  0x85, 0x28, 0x05, 0x83, 0x02, 0x87, 0x05, 0x82, 0x05, 0xa4, 0x04, 0x85,
+  0x10, 0x05, 0x83, 0x05, 0x87, 0x02, 0x82, 0x02, 0xa4, 0x04, 0x85, 0x18,
+  0x05, 0x83, 0x04, 0x87, 0x03, 0x82, 0x03, 0xab, 0x1f, 0x07, 0x83, 0x04,
+  0x07, 0x86, 0x03, 0x82, 0x03, 0xa4, 0x04, 0x85, 0x08, 0x05, 0x83, 0x06,
+  0x87, 0x01, 0x82, 0x01, 0xa4, 0x04, 0x85, 0x18, 0x05, 0x83, 0x04, 0x87,
+  0x03, 0x82, 0x03, 0xa4, 0x02, 0x85, 0x3f, 0x07, 0x84, 0x07, 0x86, 0x07,
+  0x82, 0x07, 0xa4, 0x04, 0x85, 0x38, 0x05, 0x8c, 0x07, 0x82, 0x07, 0x97,
+  0x40, 0x03, 0x8a, 0x04, 0x84, 0x28, 0x80, 0x28, 0x40, 0x05, 0x03, 0x8b,
+  0x05, 0x99, 0x40, 0x03, 0x8a, 0x04, 0x84, 0x10, 0x80, 0x10, 0x40, 0x05,
+  0x01, 0x8b, 0x02, 0x99, 0x40, 0x03, 0x8a, 0x04, 0x84, 0x18, 0x80, 0x18,
+  0x40, 0x05, 0x01, 0x8b, 0x03, 0x99, 0x40, 0x03, 0x90, 0x18, 0x80, 0x1f,
+  0x40, 0x07, 0x05, 0x80, 0x07, 0x89, 0x03, 0x99, 0x40, 0x03, 0x8a, 0x04,
+  0x84, 0x08, 0x80, 0x08, 0x40, 0x05, 0x03, 0x8b, 0x01, 0x99, 0x40, 0x03,
+  0x8a, 0x04, 0x84, 0x18, 0x80, 0x18, 0x40, 0x05, 0x01, 0x8b, 0x03, 0x99,
+  0x40, 0x03, 0x8a, 0x02, 0x84, 0x38, 0x80, 0x3f, 0x40, 0x07, 0x05, 0x80,
+  0x07, 0x89, 0x07, 0x99, 0x40, 0x03, 0x8a, 0x04, 0x84, 0x38, 0x80, 0x38,
+  0x40, 0x05, 0x03, 0x8b, 0x07, 0x98, 0x42, 0x02, 0x86, 0x04, 0x88, 0x28,
+  0xa9, 0x42, 0x02, 0x86, 0x04, 0x88, 0x10, 0xa9, 0x42, 0x02, 0x86, 0x04,
+  0x88, 0x18, 0xa9, 0x03, 0x40, 0x04, 0x03, 0x90, 0x18, 0x80, 0x42, 0x07,
+  0xa4, 0x42, 0x02, 0x86, 0x04, 0x88, 0x08, 0xa9, 0x42, 0x02, 0x86, 0x04,
+  0x88, 0x18, 0xa9, 0x02, 0x40, 0x05, 0x02, 0x86, 0x02, 0x88, 0x38, 0x80,
+  0x42, 0x07, 0xa4, 0x42, 0x02, 0x86, 0x04, 0x88, 0x38, 0x9e, 0xe4, 0x02,
+  0x00, 0x00, 0xc2, 0x08, 0x00, 0x28, 0x82, 0x38, 0xba, 0x28, 0x82, 0x38,
+  0xba, 0x28, 0x82, 0x38, 0xba, 0x20, 0x82, 0x38, 0x80, 0x40, 0x38, 0xb7,
+  0x28, 0x82, 0x38, 0xba, 0x28, 0x82, 0x38, 0xba, 0x28, 0x82, 0x38, 0x80,
+  0x40, 0x38, 0xb7, 0x28, 0x82, 0x38, 0xb8, 0x18, 0x82, 0x38, 0x80, 0x38,
+  0xb8, 0x18, 0x82, 0x38, 0x80, 0x38, 0xb8, 0x18, 0x82, 0x38, 0x80, 0x38,
+  0xb8, 0x08, 0x82, 0x38, 0xba, 0x18, 0x82, 0x38, 0x80, 0x38, 0xb8, 0x18,
+  0x82, 0x38, 0x80, 0x38, 0xb8, 0x08, 0x82, 0x38, 0xba, 0x18, 0x82, 0x38,
+  0x80, 0x38, 0xc0, 0xff, 0x00, 0x38, 0xc0, 0xbe, 0x00, 0x38, 0xc0, 0x76,
+  0x00, 0x10, 0x82, 0x10, 0x41, 0x38, 0x80, 0x40, 0x10, 0xb4, 0x18, 0x82,
+  0x18, 0x41, 0x38, 0x80, 0x40, 0x18, 0xb4, 0x10, 0x82, 0x10, 0x41, 0x38,
+  0x80, 0x40, 0x10, 0xb9, 0x40, 0x38, 0xb8, 0x10, 0x82, 0x10, 0x41, 0x38,
+  0x80, 0x40, 0x10, 0xb4, 0x18, 0x82, 0x18, 0x41, 0x38, 0x80, 0x40, 0x18,
+  0xb4, 0x18, 0x82, 0x18, 0x40, 0x38, 0x81, 0x40, 0x18, 0xb4, 0x18, 0x82,
+  0x18, 0x41, 0x38, 0x80, 0x40, 0x18, 0xba, 0x40, 0x10, 0xa7, 0x28, 0x94,
+  0x40, 0x28, 0xa7, 0x10, 0x94, 0x40, 0x20, 0xa7, 0x18, 0x94, 0x40, 0x20,
+  0xa7, 0x18, 0x94, 0x40, 0x30, 0xa7, 0x08, 0x94, 0x40, 0x20, 0xa7, 0x18,
+  0xbe, 0x38, 0xbe, 0x38, 0x8f, 0x28, 0x82, 0x28, 0x80, 0x28, 0xa7, 0x28,
+  0x8f, 0x10, 0x82, 0x10, 0x80, 0x10, 0xa7, 0x10, 0x8f, 0x18, 0x82, 0x18,
+  0x80, 0x18, 0xa7, 0x18, 0x8f, 0x18, 0x82, 0x18, 0x80, 0x18, 0xa7, 0x18,
+  0x8f, 0x08, 0x82, 0x08, 0x80, 0x08, 0xa7, 0x08, 0x8f, 0x18, 0x82, 0x18,
+  0x80, 0x18, 0xa7, 0x18, 0x8f, 0x38, 0x82, 0x38, 0x80, 0x38, 0xa7, 0x38,
+  0x8f, 0x38, 0x82, 0x38, 0x80, 0x38, 0xa7, 0x38, 0x91, 0x28, 0x82, 0x28,
+  0x81, 0x10, 0x97, 0x10, 0x89, 0x40, 0x28, 0x80, 0x40, 0x28, 0x8f, 0x10,
+  0x82, 0x10, 0x81, 0x28, 0x97, 0x28, 0x89, 0x40, 0x10, 0x80, 0x40, 0x10,
+  0x8f, 0x18, 0x82, 0x18, 0x81, 0x20, 0x97, 0x20, 0x89, 0x40, 0x18, 0x80,
+  0x40, 0x18, 0x8f, 0x18, 0x82, 0x18, 0x81, 0x20, 0x38, 0x96, 0x20, 0x89,
+  0x40, 0x18, 0x80, 0x40, 0x18, 0x8f, 0x08, 0x82, 0x08, 0x81, 0x30, 0x97,
+  0x30, 0x89, 0x40, 0x08, 0x80, 0x40, 0x08, 0x8f, 0x18, 0x82, 0x18, 0x81,
+  0x20, 0x97, 0x20, 0x89, 0x40, 0x18, 0x80, 0x40, 0x18, 0x8f, 0x38, 0x82,
+  0x38, 0x82, 0x38, 0xa1, 0x40, 0x38, 0x80, 0x40, 0x38, 0x8f, 0x38, 0x82,
+  0x38, 0xa5, 0x40, 0x38, 0x80, 0x40, 0x38, 0x96, 0x10, 0x82, 0x40, 0x10,
+  0x82, 0x10, 0x84, 0x10, 0x82, 0x40, 0x10, 0x82, 0x10, 0x8c, 0x28, 0x98,
+  0x28, 0x82, 0x40, 0x28, 0x82, 0x28, 0x84, 0x28, 0x82, 0x40, 0x28, 0x82,
+  0x28, 0x8c, 0x10, 0x98, 0x20, 0x82, 0x40, 0x20, 0x82, 0x20, 0x84, 0x20,
+  0x82, 0x40, 0x20, 0x82, 0x20, 0x8c, 0x18, 0x98, 0x20, 0x38, 0x80, 0x38,
+  0x40, 0x20, 0x38, 0x80, 0x38, 0x20, 0x84, 0x20, 0x38, 0x80, 0x38, 0x40,
+  0x20, 0x38, 0x80, 0x38, 0x20, 0x8c, 0x18, 0x98, 0x30, 0x82, 0x40, 0x30,
+  0x82, 0x30, 0x84, 0x30, 0x82, 0x40, 0x30, 0x82, 0x30, 0x8c, 0x08, 0x98,
+  0x20, 0x82, 0x40, 0x20, 0x82, 0x20, 0x84, 0x20, 0x82, 0x40, 0x20, 0x82,
+  0x20, 0x8c, 0x18, 0x99, 0x38, 0x80, 0x38, 0x81, 0x38, 0x80, 0x38, 0x86,
+  0x38, 0x80, 0x38, 0x81, 0x38, 0x80, 0x38, 0x8d, 0x38, 0xbe, 0x38, 0x98,
+  0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x85, 0x10, 0x81, 0x10, 0x80,
+  0x10, 0x81, 0x10, 0x8c, 0x28, 0x98, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81,
+  0x28, 0x85, 0x28, 0x81, 0x28, 0x80, 0x28, 0x81, 0x28, 0x8c, 0x10, 0x98,
+  0x20, 0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0x80,
+  0x20, 0x81, 0x20, 0x8c, 0x18, 0x98, 0x20, 0x81, 0x20, 0x81, 0x20, 0x81,
+  0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x8c, 0x18, 0x98,
+  0x30, 0x81, 0x30, 0x81, 0x30, 0x81, 0x30, 0x85, 0x30, 0x81, 0x30, 0x80,
+  0x30, 0x81, 0x30, 0x8c, 0x08, 0x98, 0x20, 0x81, 0x20, 0x81, 0x20, 0x81,
+  0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x8c, 0x18, 0xbe,
+  0x38, 0xbe, 0x38, 0xc4, 0x25, 0x00, 0x28, 0xbe, 0x10, 0xbe, 0x18, 0xbe,
+  0x18, 0xbe, 0x08, 0xbe, 0x18, 0xbe, 0x38, 0xbe, 0x38, 0xbe, 0x28, 0x81,
+  0x28, 0xbb, 0x10, 0x81, 0x10, 0xbb, 0x18, 0x81, 0x18, 0xbb, 0x18, 0x81,
+  0x18, 0xbb, 0x08, 0x81, 0x08, 0xbb, 0x18, 0x81, 0x18, 0xbb, 0x38, 0x81,
+  0x38, 0xbb, 0x38, 0x81, 0x38, 0xb8, 0x41, 0x28, 0x80, 0x28, 0x81, 0x28,
+  0xb7, 0x41, 0x10, 0x80, 0x10, 0x81, 0x10, 0xb7, 0x41, 0x18, 0x80, 0x18,
+  0x81, 0x18, 0xb7, 0x41, 0x18, 0x80, 0x18, 0x81, 0x18, 0xb7, 0x41, 0x08,
+  0x80, 0x08, 0x81, 0x08, 0xb7, 0x41, 0x18, 0x80, 0x18, 0x81, 0x18, 0xb7,
+  0x41, 0x38, 0x80, 0x38, 0x81, 0x38, 0xb7, 0x41, 0x38, 0x80, 0x38, 0x81,
+  0x38, 0xba, 0x28, 0x81, 0x28, 0xbb, 0x10, 0x81, 0x10, 0xbb, 0x18, 0x81,
+  0x18, 0xbb, 0x18, 0x81, 0x18, 0xbb, 0x08, 0x81, 0x08, 0xbb, 0x18, 0x81,
+  0x18, 0xbb, 0x38, 0x81, 0x38, 0xbb, 0x38, 0x81, 0x38, 0x9e, 0x4d, 0x06,
+  0x00, 0x00, 0x89, 0x45, 0x10, 0x8a, 0x28, 0x8c, 0x10, 0x9e, 0x45, 0x10,
+  0x8a, 0x28, 0x8c, 0x28, 0x9e, 0x45, 0x10, 0x8a, 0x28, 0x8c, 0x20, 0x9e,
+  0x18, 0x41, 0x20, 0x41, 0x18, 0x8a, 0x40, 0x38, 0x8a, 0x38, 0x20, 0x9e,
+  0x45, 0x10, 0x8a, 0x28, 0x8c, 0x30, 0x9e, 0x45, 0x10, 0x8a, 0x28, 0x8c,
+  0x20, 0x9e, 0x10, 0x41, 0x28, 0x41, 0x10, 0x8a, 0x40, 0x38, 0x8a, 0x38,
+  0x9f, 0x45, 0x10, 0x8a, 0x28, 0xab, 0x28, 0x41, 0x20, 0x8d, 0x28, 0x82,
+  0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x10, 0x9c, 0x28, 0x41, 0x20, 0x8d,
+  0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x28, 0x9c, 0x28, 0x41,
+  0x20, 0x8d, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x20, 0x9c,
+  0x20, 0x40, 0x30, 0x08, 0x40, 0x38, 0x8b, 0x40, 0x38, 0x82, 0x40, 0x38,
+  0x84, 0x40, 0x38, 0x80, 0x38, 0x20, 0x9c, 0x28, 0x41, 0x20, 0x8d, 0x28,
+  0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x30, 0x9c, 0x28, 0x41, 0x20,
+  0x8d, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x20, 0x9c, 0x28,
+  0x40, 0x30, 0x08, 0x40, 0x38, 0x8b, 0x40, 0x38, 0x82, 0x40, 0x38, 0x84,
+  0x40, 0x38, 0x80, 0x38, 0x9d, 0x28, 0x41, 0x20, 0x8d, 0x28, 0x82, 0x40,
+  0x38, 0x84, 0x40, 0x38, 0x9e, 0x18, 0x82, 0x18, 0x41, 0x20, 0x8b, 0x28,
+  0x8e, 0x10, 0x9a, 0x18, 0x82, 0x18, 0x41, 0x20, 0x8b, 0x28, 0x8e, 0x28,
+  0x9a, 0x18, 0x82, 0x18, 0x41, 0x20, 0x8b, 0x28, 0x8e, 0x20, 0x9a, 0x08,
+  0x82, 0x08, 0x30, 0x40, 0x08, 0x40, 0x38, 0x89, 0x40, 0x38, 0x81, 0x38,
+  0x80, 0x38, 0x83, 0x38, 0x80, 0x38, 0x80, 0x38, 0x20, 0x9a, 0x18, 0x82,
+  0x18, 0x41, 0x20, 0x8b, 0x28, 0x8e, 0x30, 0x9a, 0x18, 0x82, 0x18, 0x41,
+  0x20, 0x8b, 0x28, 0x8e, 0x20, 0x9a, 0x08, 0x82, 0x08, 0x30, 0x40, 0x08,
+  0x40, 0x38, 0x89, 0x40, 0x38, 0x81, 0x38, 0x80, 0x38, 0x83, 0x38, 0x80,
+  0x38, 0x80, 0x38, 0x9b, 0x18, 0x82, 0x18, 0x41, 0x20, 0x8b, 0x28, 0xae,
+  0x44, 0x28, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08,
+  0x10, 0x9e, 0x44, 0x20, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08,
+  0x80, 0x08, 0x28, 0x9e, 0x44, 0x28, 0x89, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x20, 0x9e, 0x38, 0x81, 0x41, 0x38, 0x89, 0x40,
+  0x38, 0x8c, 0x38, 0x20, 0x9e, 0x44, 0x28, 0x89, 0x28, 0x80, 0x08, 0x80,
+  0x08, 0x87, 0x08, 0x80, 0x08, 0x30, 0x9e, 0x44, 0x20, 0x89, 0x28, 0x80,
+  0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x9e, 0x20, 0x40, 0x18,
+  0x41, 0x20, 0x89, 0x40, 0x38, 0x8c, 0x38, 0x9f, 0x44, 0x20, 0x89, 0x28,
+  0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x9a, 0x10, 0x83, 0x28,
+  0x15, 0x40, 0x28, 0x8b, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80,
+  0x08, 0x10, 0x85, 0x28, 0x92, 0x18, 0x83, 0x20, 0x1a, 0x40, 0x20, 0x8b,
+  0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x28, 0x85, 0x10,
+  0x92, 0x10, 0x83, 0x28, 0x13, 0x40, 0x28, 0x8b, 0x28, 0x80, 0x08, 0x80,
+  0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x85, 0x18, 0x97, 0x38, 0x03, 0x80,
+  0x38, 0x8b, 0x40, 0x38, 0x82, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80, 0x40,
+  0x38, 0x81, 0x38, 0x20, 0x85, 0x18, 0x92, 0x10, 0x83, 0x28, 0x11, 0x40,
+  0x28, 0x8b, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x30,
+  0x85, 0x08, 0x92, 0x18, 0x83, 0x20, 0x1b, 0x40, 0x20, 0x8b, 0x28, 0x80,
+  0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x85, 0x18, 0x92, 0x18,
+  0x83, 0x20, 0x1f, 0x18, 0x20, 0x8b, 0x40, 0x38, 0x82, 0x40, 0x38, 0x80,
+  0x40, 0x38, 0x80, 0x40, 0x38, 0x81, 0x38, 0x86, 0x38, 0x92, 0x18, 0x83,
+  0x20, 0x1f, 0x40, 0x20, 0x8b, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08,
+  0x80, 0x08, 0x86, 0x38, 0x98, 0x40, 0x10, 0x81, 0x10, 0x8a, 0x28, 0x8c,
+  0x10, 0x86, 0x28, 0x82, 0x28, 0x94, 0x40, 0x28, 0x81, 0x28, 0x8a, 0x28,
+  0x8c, 0x28, 0x86, 0x10, 0x82, 0x10, 0x94, 0x40, 0x20, 0x81, 0x20, 0x8a,
+  0x28, 0x8c, 0x20, 0x86, 0x18, 0x82, 0x18, 0x94, 0x40, 0x20, 0x81, 0x20,
+  0x8a, 0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80, 0x38, 0x20, 0x86, 0x18,
+  0x82, 0x18, 0x94, 0x40, 0x30, 0x81, 0x30, 0x8a, 0x28, 0x8c, 0x30, 0x86,
+  0x08, 0x82, 0x08, 0x94, 0x40, 0x20, 0x81, 0x20, 0x8a, 0x28, 0x8c, 0x20,
+  0x86, 0x18, 0x82, 0x18, 0xa4, 0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80,
+  0x38, 0x87, 0x38, 0x82, 0x38, 0xa4, 0x28, 0x94, 0x38, 0x82, 0x38, 0x8f,
+  0x28, 0x82, 0x28, 0x82, 0x40, 0x10, 0x8b, 0x18, 0x8a, 0x10, 0x8b, 0x28,
+  0x8f, 0x10, 0x82, 0x10, 0x82, 0x40, 0x28, 0x8b, 0x08, 0x8a, 0x28, 0x8b,
+  0x10, 0x8f, 0x18, 0x82, 0x18, 0x82, 0x40, 0x20, 0x8b, 0x08, 0x8a, 0x20,
+  0x8b, 0x18, 0x8f, 0x18, 0x82, 0x18, 0x82, 0x40, 0x20, 0x8b, 0x28, 0x38,
+  0x88, 0x38, 0x20, 0x8b, 0x18, 0x8f, 0x08, 0x82, 0x08, 0x82, 0x40, 0x30,
+  0x8b, 0x18, 0x8a, 0x30, 0x8b, 0x08, 0x8f, 0x18, 0x82, 0x18, 0x82, 0x40,
+  0x20, 0x8b, 0x08, 0x8a, 0x20, 0x8b, 0x18, 0x8f, 0x38, 0x82, 0x38, 0x90,
+  0x28, 0x38, 0x88, 0x38, 0x8c, 0x38, 0x8f, 0x38, 0x82, 0x38, 0x90, 0x18,
+  0x97, 0x38, 0x91, 0x28, 0x83, 0x40, 0x10, 0x97, 0x40, 0x10, 0x84, 0x40,
+  0x28, 0x80, 0x28, 0x83, 0x40, 0x28, 0x8f, 0x10, 0x83, 0x40, 0x28, 0x97,
+  0x40, 0x28, 0x84, 0x40, 0x10, 0x80, 0x10, 0x83, 0x40, 0x10, 0x8f, 0x18,
+  0x83, 0x40, 0x20, 0x97, 0x40, 0x20, 0x84, 0x40, 0x18, 0x80, 0x18, 0x83,
+  0x40, 0x18, 0x8f, 0x18, 0x83, 0x20, 0x18, 0x38, 0x80, 0x38, 0x94, 0x40,
+  0x20, 0x84, 0x40, 0x18, 0x80, 0x18, 0x83, 0x40, 0x18, 0x8f, 0x08, 0x83,
+  0x40, 0x30, 0x97, 0x40, 0x30, 0x84, 0x40, 0x08, 0x80, 0x08, 0x83, 0x40,
+  0x08, 0x8f, 0x18, 0x83, 0x40, 0x20, 0x97, 0x40, 0x20, 0x84, 0x40, 0x18,
+  0x80, 0x18, 0x83, 0x40, 0x18, 0x8f, 0x38, 0x84, 0x40, 0x38, 0x80, 0x38,
+  0x9b, 0x40, 0x38, 0x80, 0x38, 0x83, 0x40, 0x38, 0x8f, 0x38, 0xa4, 0x40,
+  0x38, 0x80, 0x38, 0x83, 0x40, 0x38, 0x94, 0x40, 0x10, 0x81, 0x10, 0x80,
+  0x10, 0x81, 0x40, 0x10, 0x83, 0x40, 0x10, 0x81, 0x10, 0x80, 0x10, 0x81,
+  0x40, 0x10, 0x8d, 0x28, 0x96, 0x40, 0x28, 0x81, 0x28, 0x80, 0x28, 0x81,
+  0x40, 0x28, 0x83, 0x40, 0x28, 0x81, 0x28, 0x80, 0x28, 0x81, 0x40, 0x28,
+  0x8d, 0x10, 0x96, 0x40, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x40, 0x20,
+  0x83, 0x40, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x40, 0x20, 0x8d, 0x18,
+  0x96, 0x20, 0x18, 0x40, 0x38, 0x18, 0x80, 0x18, 0x40, 0x38, 0x18, 0x20,
+  0x83, 0x20, 0x18, 0x40, 0x38, 0x18, 0x80, 0x18, 0x40, 0x38, 0x18, 0x20,
+  0x8d, 0x18, 0x96, 0x40, 0x30, 0x81, 0x30, 0x80, 0x30, 0x81, 0x40, 0x30,
+  0x83, 0x40, 0x30, 0x81, 0x30, 0x80, 0x30, 0x81, 0x40, 0x30, 0x8d, 0x08,
+  0x96, 0x40, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x40, 0x20, 0x83, 0x40,
+  0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x40, 0x20, 0x8d, 0x18, 0x97, 0x42,
+  0x38, 0x80, 0x42, 0x38, 0x85, 0x42, 0x38, 0x80, 0x42, 0x38, 0x8e, 0x38,
+  0xbe, 0x38, 0x96, 0x40, 0x10, 0x80, 0x40, 0x10, 0x28, 0x40, 0x10, 0x80,
+  0x40, 0x10, 0x84, 0x40, 0x10, 0x80, 0x42, 0x10, 0x80, 0x40, 0x10, 0x89,
+  0x28, 0x82, 0x28, 0x96, 0x40, 0x28, 0x80, 0x40, 0x28, 0x10, 0x40, 0x28,
+  0x80, 0x40, 0x28, 0x84, 0x40, 0x28, 0x80, 0x42, 0x28, 0x80, 0x40, 0x28,
+  0x89, 0x10, 0x82, 0x10, 0x96, 0x40, 0x20, 0x80, 0x40, 0x20, 0x18, 0x40,
+  0x20, 0x80, 0x40, 0x20, 0x84, 0x40, 0x20, 0x80, 0x42, 0x20, 0x80, 0x40,
+  0x20, 0x89, 0x18, 0x82, 0x18, 0x96, 0x40, 0x20, 0x80, 0x40, 0x20, 0x18,
+  0x40, 0x20, 0x80, 0x40, 0x20, 0x84, 0x40, 0x20, 0x80, 0x42, 0x20, 0x80,
+  0x40, 0x20, 0x89, 0x18, 0x82, 0x18, 0x96, 0x40, 0x30, 0x80, 0x40, 0x30,
+  0x08, 0x40, 0x30, 0x80, 0x40, 0x30, 0x84, 0x40, 0x30, 0x80, 0x42, 0x30,
+  0x80, 0x40, 0x30, 0x89, 0x08, 0x82, 0x08, 0x96, 0x40, 0x20, 0x80, 0x40,
+  0x20, 0x18, 0x40, 0x20, 0x80, 0x40, 0x20, 0x84, 0x40, 0x20, 0x80, 0x42,
+  0x20, 0x80, 0x40, 0x20, 0x89, 0x18, 0x82, 0x18, 0x9b, 0x38, 0x9d, 0x38,
+  0x82, 0x38, 0x9b, 0x38, 0x9d, 0x38, 0x82, 0x38, 0xba, 0x28, 0xbe, 0x10,
+  0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x08, 0xbe, 0x18, 0xbe, 0x38, 0xbe, 0x38,
+  0x9d, 0x28, 0x82, 0x28, 0x82, 0x28, 0xb6, 0x10, 0x82, 0x10, 0x82, 0x10,
+  0xb6, 0x18, 0x82, 0x18, 0x82, 0x18, 0xb6, 0x18, 0x82, 0x18, 0x82, 0x18,
+  0xb6, 0x08, 0x82, 0x08, 0x82, 0x08, 0xb6, 0x18, 0x82, 0x18, 0x82, 0x18,
+  0xb6, 0x38, 0x82, 0x38, 0x82, 0x38, 0xb6, 0x38, 0x82, 0x38, 0x82, 0x38,
+  0xbe, 0x28, 0x82, 0x2d, 0x80, 0x05, 0x86, 0x02, 0x80, 0x02, 0xae, 0x10,
+  0x82, 0x15, 0x80, 0x05, 0x86, 0x05, 0x80, 0x05, 0xae, 0x18, 0x82, 0x1d,
+  0x80, 0x05, 0x86, 0x04, 0x80, 0x04, 0xae, 0x18, 0x82, 0x1f, 0x80, 0x07,
+  0x86, 0x04, 0x80, 0x04, 0xae, 0x08, 0x82, 0x0d, 0x80, 0x05, 0x86, 0x06,
+  0x80, 0x06, 0xae, 0x18, 0x82, 0x1d, 0x80, 0x05, 0x86, 0x04, 0x80, 0x04,
+  0xae, 0x38, 0x82, 0x3f, 0x80, 0x07, 0xb8, 0x38, 0x82, 0x3d, 0x80, 0x05,
+  0xb2, 0x28, 0x87, 0x05, 0x28, 0x81, 0x05, 0x84, 0x02, 0x82, 0x02, 0xa7,
+  0x10, 0x87, 0x05, 0x10, 0x81, 0x05, 0x84, 0x05, 0x82, 0x05, 0xa7, 0x18,
+  0x87, 0x05, 0x18, 0x81, 0x05, 0x84, 0x04, 0x82, 0x04, 0xa7, 0x18, 0x87,
+  0x07, 0x1f, 0x80, 0x40, 0x07, 0x84, 0x04, 0x07, 0x80, 0x07, 0x04, 0xa7,
+  0x08, 0x87, 0x05, 0x08, 0x81, 0x05, 0x84, 0x06, 0x82, 0x06, 0xa7, 0x18,
+  0x87, 0x05, 0x18, 0x81, 0x05, 0x84, 0x04, 0x82, 0x04, 0xa7, 0x38, 0x87,
+  0x07, 0x3f, 0x80, 0x40, 0x07, 0x85, 0x07, 0x80, 0x07, 0xa8, 0x38, 0x87,
+  0x05, 0x38, 0x81, 0x05, 0xb4, 0x40, 0x28, 0x80, 0x40, 0x28, 0x80, 0x05,
+  0x80, 0x40, 0x28, 0x07, 0x05, 0x87, 0x02, 0xaa, 0x40, 0x10, 0x80, 0x40,
+  0x10, 0x80, 0x05, 0x80, 0x40, 0x10, 0x07, 0x05, 0x87, 0x05, 0xaa, 0x40,
+  0x18, 0x80, 0x40, 0x18, 0x80, 0x05, 0x80, 0x40, 0x18, 0x07, 0x05, 0x87,
+  0x04, 0xaa, 0x40, 0x18, 0x80, 0x40, 0x18, 0x80, 0x40, 0x07, 0x40, 0x18,
+  0x80, 0x07, 0x83, 0x07, 0x81, 0x07, 0x04, 0xaa, 0x40, 0x08, 0x80, 0x40,
+  0x08, 0x80, 0x05, 0x80, 0x40, 0x08, 0x07, 0x05, 0x87, 0x06, 0xaa, 0x40,
+  0x18, 0x80, 0x40, 0x18, 0x80, 0x05, 0x80, 0x40, 0x18, 0x07, 0x05, 0x87,
+  0x04, 0xaa, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80, 0x40, 0x07, 0x40, 0x38,
+  0x80, 0x07, 0x83, 0x07, 0x81, 0x07, 0xab, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x80, 0x05, 0x80, 0x40, 0x38, 0x07, 0x05, 0xa8, 0x42, 0x02, 0x8c, 0x05,
+  0x28, 0x8b, 0x02, 0x9f, 0x42, 0x02, 0x8c, 0x05, 0x10, 0x8b, 0x05, 0x9f,
+  0x42, 0x02, 0x8c, 0x05, 0x18, 0x8b, 0x04, 0x9f, 0x42, 0x03, 0x8c, 0x07,
+  0x1f, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x04, 0x9f, 0x42, 0x02, 0x8c,
+  0x05, 0x08, 0x8b, 0x06, 0x9f, 0x42, 0x02, 0x8c, 0x05, 0x18, 0x8b, 0x04,
+  0x9f, 0x42, 0x02, 0x8c, 0x07, 0x3f, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07,
+  0xa0, 0x42, 0x02, 0x8c, 0x05, 0x38, 0xa1, 0x72, 0x04, 0x00, 0x00, 0x89,
+  0x10, 0x8f, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x10, 0x9e, 0x10, 0x8f,
+  0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x28, 0x9e, 0x10, 0x8f, 0x28, 0x82,
+  0x38, 0x85, 0x38, 0x82, 0x20, 0x9e, 0x18, 0x38, 0x8e, 0x40, 0x38, 0x82,
+  0x38, 0x85, 0x38, 0x80, 0x38, 0x20, 0x9e, 0x10, 0x8f, 0x28, 0x82, 0x38,
+  0x85, 0x38, 0x82, 0x30, 0x9e, 0x10, 0x8f, 0x28, 0x82, 0x38, 0x85, 0x38,
+  0x82, 0x20, 0x9e, 0x10, 0x38, 0x8e, 0x40, 0x38, 0x82, 0x38, 0x85, 0x38,
+  0x80, 0x38, 0x9f, 0x10, 0x8f, 0x28, 0x82, 0x38, 0x85, 0x38, 0xa2, 0x40,
+  0x20, 0x92, 0x38, 0x85, 0x38, 0xa2, 0x40, 0x20, 0x92, 0x38, 0x85, 0x38,
+  0xa2, 0x40, 0x20, 0x92, 0x38, 0x85, 0x38, 0xa2, 0x40, 0x30, 0x38, 0x91,
+  0x38, 0x85, 0x38, 0xa2, 0x40, 0x20, 0x92, 0x38, 0x85, 0x38, 0xa2, 0x40,
+  0x20, 0x92, 0x38, 0x85, 0x38, 0xa2, 0x40, 0x30, 0x38, 0x91, 0x38, 0x85,
+  0x38, 0xa2, 0x40, 0x20, 0x92, 0x38, 0x85, 0x38, 0xb5, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0xb2, 0x40, 0x08, 0x88, 0x40, 0x08, 0xb2, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0xb4, 0x40, 0x38, 0x84, 0x40, 0x38, 0xb4, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0xb2, 0x40, 0x08, 0x88, 0x40, 0x08, 0xb4, 0x40, 0x38, 0x84,
+  0x40, 0x38, 0xb4, 0x40, 0x08, 0x88, 0x40, 0x08, 0x9d, 0x05, 0xbe, 0x02,
+  0xbe, 0x03, 0xbe, 0x03, 0x96, 0x38, 0x81, 0x38, 0x81, 0x38, 0xa0, 0x01,
+  0xbe, 0x03, 0xbe, 0x07, 0x96, 0x38, 0x81, 0x38, 0x81, 0x38, 0xa0, 0x07,
+  0xbd, 0x05, 0x80, 0x05, 0x81, 0x05, 0x8d, 0x28, 0x80, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0x10, 0x83, 0x28, 0x81, 0x28, 0x93, 0x02, 0x80, 0x02, 0x81,
+  0x02, 0x8d, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x28, 0x83, 0x10,
+  0x81, 0x10, 0x93, 0x03, 0x80, 0x03, 0x81, 0x03, 0x8d, 0x28, 0x80, 0x40,
+  0x08, 0x88, 0x40, 0x08, 0x20, 0x83, 0x18, 0x81, 0x18, 0x93, 0x03, 0x80,
+  0x03, 0x81, 0x03, 0x8d, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x82, 0x38, 0x20, 0x83, 0x18, 0x81, 0x18, 0x93, 0x01, 0x80, 0x01, 0x81,
+  0x01, 0x8d, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x30, 0x83, 0x08,
+  0x81, 0x08, 0x93, 0x03, 0x80, 0x03, 0x81, 0x03, 0x8d, 0x28, 0x80, 0x40,
+  0x08, 0x88, 0x40, 0x08, 0x20, 0x83, 0x18, 0x81, 0x18, 0x93, 0x07, 0x80,
+  0x07, 0x81, 0x07, 0x8d, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x82, 0x38, 0x84, 0x38, 0x81, 0x38, 0x93, 0x07, 0x80, 0x07, 0x81, 0x07,
+  0x8d, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x84, 0x38, 0x81, 0x38,
+  0x94, 0x05, 0x92, 0x28, 0x8b, 0x10, 0x82, 0x28, 0x82, 0x40, 0x28, 0x94,
+  0x02, 0x92, 0x28, 0x8b, 0x28, 0x82, 0x10, 0x82, 0x40, 0x10, 0x94, 0x03,
+  0x92, 0x28, 0x8b, 0x20, 0x82, 0x18, 0x82, 0x40, 0x18, 0x94, 0x03, 0x92,
+  0x40, 0x38, 0x81, 0x45, 0x38, 0x80, 0x38, 0x20, 0x82, 0x18, 0x82, 0x40,
+  0x18, 0x94, 0x01, 0x92, 0x28, 0x8b, 0x30, 0x82, 0x08, 0x82, 0x40, 0x08,
+  0x94, 0x03, 0x92, 0x28, 0x8b, 0x20, 0x82, 0x18, 0x82, 0x40, 0x18, 0x94,
+  0x07, 0x92, 0x40, 0x38, 0x81, 0x45, 0x38, 0x80, 0x38, 0x83, 0x38, 0x82,
+  0x40, 0x38, 0x94, 0x07, 0x92, 0x28, 0x8f, 0x38, 0x82, 0x40, 0x38, 0xa9,
+  0x18, 0x89, 0x10, 0xb3, 0x08, 0x89, 0x28, 0xb3, 0x08, 0x89, 0x20, 0xa6,
+  0x38, 0x8b, 0x28, 0x48, 0x38, 0x20, 0xb3, 0x18, 0x89, 0x30, 0xb3, 0x08,
+  0x89, 0x20, 0xa6, 0x38, 0x8b, 0x28, 0x48, 0x38, 0xb4, 0x18, 0xc0, 0x47,
+  0x00, 0x40, 0x10, 0x83, 0x28, 0x81, 0x40, 0x28, 0x82, 0x40, 0x28, 0xaf,
+  0x40, 0x28, 0x83, 0x10, 0x81, 0x40, 0x10, 0x82, 0x40, 0x10, 0xaf, 0x40,
+  0x20, 0x83, 0x18, 0x81, 0x40, 0x18, 0x82, 0x40, 0x18, 0xad, 0x38, 0x80,
+  0x40, 0x20, 0x83, 0x18, 0x81, 0x40, 0x18, 0x82, 0x40, 0x18, 0xaf, 0x40,
+  0x30, 0x83, 0x08, 0x81, 0x40, 0x08, 0x82, 0x40, 0x08, 0xaf, 0x40, 0x20,
+  0x83, 0x18, 0x81, 0x40, 0x18, 0x82, 0x40, 0x18, 0xad, 0x38, 0x86, 0x38,
+  0x81, 0x40, 0x38, 0x82, 0x40, 0x38, 0xb5, 0x38, 0x81, 0x40, 0x38, 0x82,
+  0x40, 0x38, 0xc2, 0x1c, 0x00, 0x38, 0x81, 0x10, 0x85, 0x10, 0x81, 0x10,
+  0x8b, 0x28, 0x82, 0x40, 0x28, 0x9f, 0x38, 0x81, 0x28, 0x85, 0x28, 0x81,
+  0x28, 0x8b, 0x10, 0x82, 0x40, 0x10, 0x9f, 0x38, 0x81, 0x20, 0x85, 0x20,
+  0x81, 0x20, 0x8b, 0x18, 0x82, 0x40, 0x18, 0x9f, 0x38, 0x81, 0x20, 0x85,
+  0x20, 0x81, 0x20, 0x8b, 0x18, 0x82, 0x40, 0x18, 0x9f, 0x38, 0x81, 0x30,
+  0x85, 0x30, 0x81, 0x30, 0x8b, 0x08, 0x82, 0x40, 0x08, 0x9f, 0x38, 0x81,
+  0x20, 0x85, 0x20, 0x81, 0x20, 0x8b, 0x18, 0x82, 0x40, 0x18, 0x9f, 0x38,
+  0x98, 0x38, 0x82, 0x40, 0x38, 0x9f, 0x38, 0x98, 0x38, 0x82, 0x40, 0x38,
+  0xbb, 0x28, 0x81, 0x28, 0xbb, 0x10, 0x81, 0x10, 0xbb, 0x18, 0x81, 0x18,
+  0xbb, 0x18, 0x81, 0x18, 0xbb, 0x08, 0x81, 0x08, 0xbb, 0x18, 0x81, 0x18,
+  0xbb, 0x38, 0x81, 0x38, 0xbb, 0x38, 0x81, 0x38, 0x9c, 0x40, 0x28, 0x82,
+  0x40, 0x28, 0x81, 0x28, 0x82, 0x40, 0x05, 0x87, 0x40, 0x02, 0xa6, 0x40,
+  0x10, 0x82, 0x40, 0x10, 0x81, 0x10, 0x82, 0x40, 0x05, 0x87, 0x40, 0x05,
+  0xa6, 0x40, 0x18, 0x82, 0x40, 0x18, 0x81, 0x18, 0x82, 0x40, 0x05, 0x87,
+  0x40, 0x04, 0xa6, 0x40, 0x18, 0x82, 0x40, 0x18, 0x81, 0x18, 0x82, 0x40,
+  0x07, 0x87, 0x40, 0x04, 0xa6, 0x40, 0x08, 0x82, 0x40, 0x08, 0x81, 0x08,
+  0x82, 0x40, 0x05, 0x87, 0x40, 0x06, 0xa6, 0x40, 0x18, 0x82, 0x40, 0x18,
+  0x81, 0x18, 0x82, 0x40, 0x05, 0x87, 0x40, 0x04, 0xa6, 0x40, 0x38, 0x82,
+  0x40, 0x38, 0x81, 0x38, 0x82, 0x40, 0x07, 0xb0, 0x40, 0x38, 0x82, 0x40,
+  0x38, 0x81, 0x38, 0x82, 0x40, 0x05, 0xb4, 0x28, 0x82, 0x40, 0x28, 0x81,
+  0x05, 0x81, 0x05, 0x85, 0x02, 0x81, 0x02, 0xa9, 0x10, 0x82, 0x40, 0x10,
+  0x81, 0x05, 0x81, 0x05, 0x85, 0x05, 0x81, 0x05, 0xa9, 0x18, 0x82, 0x40,
+  0x18, 0x81, 0x05, 0x81, 0x05, 0x85, 0x04, 0x81, 0x04, 0xa9, 0x18, 0x82,
+  0x40, 0x18, 0x81, 0x42, 0x07, 0x85, 0x04, 0x40, 0x07, 0x04, 0xa9, 0x08,
+  0x82, 0x40, 0x08, 0x81, 0x05, 0x81, 0x05, 0x85, 0x06, 0x81, 0x06, 0xa9,
+  0x18, 0x82, 0x40, 0x18, 0x81, 0x05, 0x81, 0x05, 0x85, 0x04, 0x81, 0x04,
+  0xa9, 0x38, 0x82, 0x40, 0x38, 0x81, 0x42, 0x07, 0x86, 0x40, 0x07, 0xaa,
+  0x38, 0x82, 0x40, 0x38, 0x81, 0x05, 0x81, 0x05, 0xb2, 0x28, 0x87, 0x07,
+  0x82, 0x05, 0xb1, 0x10, 0x87, 0x07, 0x82, 0x05, 0xb1, 0x18, 0x87, 0x07,
+  0x82, 0x05, 0xb1, 0x18, 0x87, 0x07, 0x81, 0x40, 0x07, 0x84, 0x07, 0xab,
+  0x08, 0x87, 0x07, 0x82, 0x05, 0xb1, 0x18, 0x87, 0x07, 0x82, 0x05, 0xb1,
+  0x38, 0x87, 0x07, 0x81, 0x40, 0x07, 0x84, 0x07, 0xab, 0x38, 0x87, 0x07,
+  0x82, 0x05, 0xaa, 0x40, 0x03, 0x84, 0x28, 0x81, 0x40, 0x28, 0x82, 0x2a,
+  0x28, 0x07, 0x81, 0x07, 0x41, 0x05, 0x03, 0xa6, 0x40, 0x03, 0x84, 0x10,
+  0x81, 0x40, 0x10, 0x82, 0x12, 0x10, 0x07, 0x81, 0x07, 0x41, 0x05, 0x01,
+  0xa6, 0x40, 0x03, 0x84, 0x18, 0x81, 0x40, 0x18, 0x82, 0x1a, 0x18, 0x07,
+  0x81, 0x07, 0x41, 0x05, 0x01, 0xa6, 0x40, 0x03, 0x84, 0x18, 0x81, 0x40,
+  0x18, 0x82, 0x40, 0x18, 0x83, 0x41, 0x07, 0x05, 0x07, 0xa5, 0x40, 0x03,
+  0x84, 0x08, 0x81, 0x40, 0x08, 0x82, 0x0a, 0x08, 0x07, 0x81, 0x07, 0x41,
+  0x05, 0x03, 0xa6, 0x40, 0x03, 0x84, 0x18, 0x81, 0x40, 0x18, 0x82, 0x1a,
+  0x18, 0x07, 0x81, 0x07, 0x41, 0x05, 0x01, 0xa6, 0x40, 0x03, 0x84, 0x38,
+  0x81, 0x40, 0x38, 0x82, 0x40, 0x38, 0x83, 0x41, 0x07, 0x05, 0x07, 0xa5,
+  0x40, 0x03, 0x84, 0x38, 0x81, 0x40, 0x38, 0x82, 0x3a, 0x38, 0x07, 0x81,
+  0x07, 0x41, 0x05, 0x03, 0xb6, 0x07, 0xbe, 0x07, 0xbe, 0x07, 0xae, 0x40,
+  0x07, 0x8d, 0x07, 0x83, 0x42, 0x07, 0xb6, 0x07, 0xbe, 0x07, 0xae, 0x40,
+  0x07, 0x8d, 0x07, 0x83, 0x42, 0x07, 0xb6, 0x07, 0xa2, 0x0c, 0x08, 0x00,
+  0x00, 0x41, 0x08, 0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10, 0x20, 0x8c,
+  0x05, 0x96, 0x41, 0x08, 0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10, 0x20,
+  0x8c, 0x02, 0x96, 0x41, 0x08, 0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10,
+  0x20, 0x8c, 0x03, 0xa1, 0x18, 0x42, 0x38, 0x97, 0x03, 0x96, 0x41, 0x08,
+  0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10, 0x20, 0x8c, 0x01, 0x96, 0x41,
+  0x08, 0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10, 0x20, 0x8c, 0x03, 0x96,
+  0x41, 0x08, 0x86, 0x08, 0x18, 0x42, 0x38, 0x85, 0x10, 0x82, 0x10, 0x8c,
+  0x07, 0x96, 0x41, 0x08, 0x86, 0x08, 0x18, 0x89, 0x20, 0x81, 0x10, 0x20,
+  0x8c, 0x07, 0x96, 0x41, 0x30, 0x86, 0x40, 0x30, 0x10, 0x87, 0x10, 0x82,
+  0x10, 0x20, 0x8c, 0x05, 0x96, 0x41, 0x30, 0x86, 0x40, 0x30, 0x10, 0x87,
+  0x10, 0x82, 0x10, 0x20, 0x8c, 0x02, 0x96, 0x41, 0x30, 0x86, 0x40, 0x30,
+  0x10, 0x87, 0x10, 0x82, 0x10, 0x20, 0x8c, 0x03, 0x96, 0x41, 0x28, 0x86,
+  0x40, 0x28, 0x18, 0x40, 0x38, 0x98, 0x03, 0x96, 0x41, 0x30, 0x86, 0x40,
+  0x30, 0x10, 0x87, 0x10, 0x82, 0x10, 0x20, 0x8c, 0x01, 0x96, 0x41, 0x30,
+  0x86, 0x40, 0x30, 0x10, 0x87, 0x10, 0x82, 0x10, 0x20, 0x8c, 0x03, 0x96,
+  0x41, 0x20, 0x86, 0x40, 0x20, 0x10, 0x40, 0x38, 0x8a, 0x10, 0x8c, 0x07,
+  0x96, 0x41, 0x30, 0x86, 0x40, 0x30, 0x10, 0x87, 0x10, 0x82, 0x10, 0x20,
+  0x8c, 0x07, 0x96, 0x41, 0x30, 0x81, 0x05, 0x83, 0x43, 0x30, 0x10, 0x86,
+  0x10, 0x20, 0xa6, 0x41, 0x30, 0x81, 0x02, 0x83, 0x43, 0x30, 0x10, 0x86,
+  0x10, 0x20, 0xa6, 0x41, 0x30, 0x81, 0x03, 0x83, 0x43, 0x30, 0x10, 0x86,
+  0x10, 0x20, 0xa6, 0x41, 0x28, 0x81, 0x03, 0x83, 0x43, 0x28, 0x18, 0xaf,
+  0x41, 0x30, 0x81, 0x01, 0x83, 0x43, 0x30, 0x10, 0x86, 0x10, 0x20, 0xa6,
+  0x41, 0x30, 0x81, 0x03, 0x83, 0x43, 0x30, 0x10, 0x86, 0x10, 0x20, 0xa6,
+  0x41, 0x20, 0x81, 0x07, 0x83, 0x43, 0x20, 0x10, 0x87, 0x10, 0xa6, 0x41,
+  0x30, 0x81, 0x07, 0x83, 0x43, 0x30, 0x10, 0x86, 0x10, 0x20, 0xa6, 0x41,
+  0x08, 0x81, 0x05, 0x81, 0x05, 0x80, 0x45, 0x08, 0x81, 0x30, 0x80, 0x20,
+  0x81, 0x20, 0x8b, 0x40, 0x05, 0x80, 0x05, 0x80, 0x40, 0x05, 0x98, 0x02,
+  0x81, 0x02, 0x89, 0x20, 0x80, 0x20, 0x81, 0x20, 0x8b, 0x40, 0x02, 0x80,
+  0x02, 0x80, 0x40, 0x02, 0x93, 0x41, 0x08, 0x81, 0x03, 0x81, 0x03, 0x80,
+  0x45, 0x08, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x8b, 0x40, 0x03, 0x80,
+  0x03, 0x80, 0x40, 0x03, 0x93, 0x41, 0x08, 0x81, 0x03, 0x81, 0x03, 0x80,
+  0x45, 0x08, 0x81, 0x10, 0x90, 0x40, 0x03, 0x80, 0x03, 0x80, 0x40, 0x03,
+  0x93, 0x41, 0x08, 0x81, 0x01, 0x81, 0x01, 0x80, 0x45, 0x08, 0x81, 0x30,
+  0x80, 0x20, 0x81, 0x20, 0x8b, 0x40, 0x01, 0x80, 0x01, 0x80, 0x40, 0x01,
+  0x98, 0x03, 0x81, 0x03, 0x89, 0x20, 0x80, 0x20, 0x81, 0x20, 0x8b, 0x40,
+  0x03, 0x80, 0x03, 0x80, 0x40, 0x03, 0x93, 0x41, 0x10, 0x81, 0x07, 0x81,
+  0x07, 0x80, 0x45, 0x10, 0x81, 0x10, 0x80, 0x10, 0x81, 0x10, 0x8b, 0x40,
+  0x07, 0x80, 0x07, 0x80, 0x40, 0x07, 0x98, 0x07, 0x81, 0x07, 0x89, 0x30,
+  0x80, 0x20, 0x81, 0x20, 0x8b, 0x40, 0x07, 0x80, 0x07, 0x80, 0x40, 0x07,
+  0x93, 0x41, 0x08, 0x40, 0x05, 0x80, 0x05, 0x81, 0x05, 0x45, 0x08, 0x82,
+  0x30, 0x20, 0x98, 0x28, 0x92, 0x40, 0x02, 0x80, 0x02, 0x81, 0x02, 0x89,
+  0x40, 0x20, 0x98, 0x10, 0x8f, 0x41, 0x08, 0x40, 0x03, 0x80, 0x03, 0x81,
+  0x03, 0x45, 0x08, 0x82, 0x40, 0x20, 0x98, 0x18, 0x8f, 0x41, 0x08, 0x40,
+  0x03, 0x80, 0x03, 0x81, 0x03, 0x45, 0x08, 0x82, 0x10, 0x99, 0x18, 0x8f,
+  0x41, 0x08, 0x40, 0x01, 0x80, 0x01, 0x81, 0x01, 0x45, 0x08, 0x82, 0x30,
+  0x20, 0x98, 0x08, 0x92, 0x40, 0x03, 0x80, 0x03, 0x81, 0x03, 0x89, 0x40,
+  0x20, 0x98, 0x18, 0x8f, 0x41, 0x10, 0x40, 0x07, 0x80, 0x07, 0x81, 0x07,
+  0x45, 0x10, 0x82, 0x40, 0x10, 0x98, 0x38, 0x92, 0x40, 0x07, 0x80, 0x07,
+  0x81, 0x07, 0x89, 0x30, 0x20, 0x98, 0x38, 0x8f, 0x41, 0x38, 0x81, 0x05,
+  0x81, 0x05, 0x80, 0x44, 0x38, 0x81, 0x18, 0x81, 0x46, 0x30, 0x8a, 0x05,
+  0x83, 0x28, 0x82, 0x28, 0x8d, 0x41, 0x08, 0x81, 0x02, 0x81, 0x02, 0x80,
+  0x44, 0x08, 0x81, 0x08, 0x81, 0x46, 0x20, 0x8a, 0x02, 0x83, 0x10, 0x82,
+  0x10, 0x8d, 0x41, 0x08, 0x81, 0x03, 0x81, 0x03, 0x80, 0x44, 0x08, 0x81,
+  0x08, 0x81, 0x46, 0x20, 0x8a, 0x03, 0x83, 0x18, 0x82, 0x18, 0x8d, 0x41,
+  0x18, 0x81, 0x03, 0x81, 0x03, 0x80, 0x44, 0x18, 0x81, 0x28, 0x81, 0x46,
+  0x10, 0x8a, 0x03, 0x83, 0x18, 0x82, 0x18, 0x8d, 0x41, 0x18, 0x81, 0x01,
+  0x81, 0x01, 0x80, 0x44, 0x18, 0x81, 0x18, 0x81, 0x46, 0x30, 0x8a, 0x01,
+  0x83, 0x08, 0x82, 0x08, 0x92, 0x03, 0x81, 0x03, 0x88, 0x08, 0x81, 0x46,
+  0x20, 0x8a, 0x03, 0x83, 0x18, 0x82, 0x18, 0x8d, 0x41, 0x20, 0x81, 0x07,
+  0x81, 0x07, 0x80, 0x44, 0x20, 0x81, 0x28, 0x81, 0x46, 0x10, 0x8a, 0x07,
+  0x83, 0x38, 0x82, 0x38, 0x8d, 0x41, 0x20, 0x81, 0x07, 0x81, 0x07, 0x80,
+  0x44, 0x20, 0x81, 0x18, 0x81, 0x46, 0x30, 0x8a, 0x07, 0x83, 0x38, 0x82,
+  0x38, 0x8d, 0x41, 0x38, 0x81, 0x05, 0x83, 0x43, 0x38, 0x83, 0x49, 0x1a,
+  0x44, 0x02, 0x83, 0x05, 0x96, 0x41, 0x08, 0x81, 0x02, 0x83, 0x43, 0x08,
+  0x83, 0x49, 0x0d, 0x44, 0x05, 0x83, 0x02, 0x96, 0x41, 0x08, 0x81, 0x03,
+  0x83, 0x43, 0x08, 0x83, 0x49, 0x0c, 0x44, 0x04, 0x83, 0x03, 0x96, 0x41,
+  0x18, 0x81, 0x03, 0x83, 0x43, 0x18, 0x81, 0x40, 0x38, 0x49, 0x2c, 0x44,
+  0x04, 0x83, 0x03, 0x96, 0x41, 0x18, 0x81, 0x01, 0x83, 0x43, 0x18, 0x83,
+  0x49, 0x1e, 0x44, 0x06, 0x83, 0x01, 0x9b, 0x03, 0x8c, 0x49, 0x0c, 0x44,
+  0x04, 0x83, 0x03, 0x96, 0x41, 0x20, 0x81, 0x07, 0x83, 0x43, 0x20, 0x81,
+  0x40, 0x38, 0x49, 0x28, 0x89, 0x07, 0x96, 0x41, 0x20, 0x81, 0x07, 0x83,
+  0x43, 0x20, 0x83, 0x49, 0x18, 0x89, 0x07, 0xa4, 0x10, 0x82, 0x02, 0x03,
+  0x13, 0x42, 0x03, 0x43, 0x13, 0x42, 0x03, 0x13, 0x03, 0x02, 0x80, 0x10,
+  0x84, 0x28, 0x84, 0x28, 0x9a, 0x28, 0x82, 0x05, 0x01, 0x29, 0x42, 0x01,
+  0x43, 0x29, 0x42, 0x01, 0x29, 0x01, 0x05, 0x80, 0x28, 0x84, 0x10, 0x84,
+  0x10, 0x9a, 0x20, 0x82, 0x04, 0x01, 0x21, 0x42, 0x01, 0x43, 0x21, 0x42,
+  0x01, 0x21, 0x01, 0x04, 0x80, 0x20, 0x84, 0x18, 0x84, 0x18, 0x9a, 0x20,
+  0x38, 0x81, 0x04, 0x05, 0x25, 0x05, 0x40, 0x3d, 0x05, 0x43, 0x25, 0x05,
+  0x40, 0x3d, 0x05, 0x25, 0x05, 0x04, 0x38, 0x20, 0x84, 0x18, 0x84, 0x18,
+  0x9a, 0x30, 0x82, 0x06, 0x03, 0x33, 0x42, 0x03, 0x43, 0x33, 0x42, 0x03,
+  0x33, 0x03, 0x06, 0x80, 0x30, 0x84, 0x08, 0x84, 0x08, 0x9a, 0x20, 0x82,
+  0x04, 0x01, 0x21, 0x42, 0x01, 0x43, 0x21, 0x42, 0x01, 0x21, 0x01, 0x04,
+  0x80, 0x20, 0x84, 0x18, 0x84, 0x18, 0x9b, 0x38, 0x82, 0x41, 0x05, 0x40,
+  0x3d, 0x45, 0x05, 0x40, 0x3d, 0x41, 0x05, 0x80, 0x38, 0x85, 0x38, 0x84,
+  0x38, 0x9f, 0x4f, 0x03, 0x87, 0x38, 0x84, 0x38, 0x9a, 0x10, 0x81, 0x02,
+  0x13, 0x40, 0x10, 0x40, 0x06, 0x16, 0x43, 0x06, 0x40, 0x16, 0x40, 0x06,
+  0x16, 0x40, 0x10, 0x03, 0x02, 0xa7, 0x28, 0x81, 0x05, 0x29, 0x40, 0x28,
+  0x40, 0x04, 0x2c, 0x43, 0x04, 0x40, 0x2c, 0x40, 0x04, 0x2c, 0x40, 0x28,
+  0x01, 0x05, 0xa7, 0x20, 0x81, 0x04, 0x21, 0x40, 0x20, 0x40, 0x04, 0x24,
+  0x43, 0x04, 0x40, 0x24, 0x40, 0x04, 0x24, 0x40, 0x20, 0x01, 0x04, 0xa7,
+  0x20, 0x40, 0x38, 0x04, 0x25, 0x20, 0x18, 0x3a, 0x02, 0x22, 0x43, 0x02,
+  0x22, 0x1a, 0x3a, 0x02, 0x22, 0x20, 0x18, 0x3d, 0x04, 0xa7, 0x30, 0x81,
+  0x06, 0x33, 0x40, 0x30, 0x40, 0x06, 0x36, 0x43, 0x06, 0x40, 0x36, 0x40,
+  0x06, 0x36, 0x40, 0x30, 0x03, 0x06, 0xa7, 0x20, 0x81, 0x04, 0x21, 0x40,
+  0x20, 0x40, 0x04, 0x24, 0x43, 0x04, 0x40, 0x24, 0x40, 0x04, 0x24, 0x40,
+  0x20, 0x01, 0x04, 0xa8, 0x40, 0x38, 0x80, 0x05, 0x80, 0x38, 0x3a, 0x46,
+  0x02, 0x40, 0x3a, 0x40, 0x02, 0x80, 0x38, 0x3d, 0xac, 0x03, 0x81, 0x4b,
+  0x06, 0x81, 0x03, 0x9a, 0x41, 0x03, 0x86, 0x42, 0x03, 0x41, 0x13, 0x81,
+  0x10, 0x16, 0x10, 0x83, 0x04, 0x81, 0x14, 0x40, 0x10, 0x81, 0x06, 0x41,
+  0x10, 0x86, 0x28, 0x82, 0x28, 0x8d, 0x41, 0x04, 0x86, 0x42, 0x04, 0x41,
+  0x2c, 0x81, 0x28, 0x2c, 0x28, 0x83, 0x04, 0x81, 0x2c, 0x40, 0x28, 0x81,
+  0x04, 0x41, 0x28, 0x86, 0x10, 0x82, 0x10, 0x8d, 0x41, 0x05, 0x86, 0x42,
+  0x05, 0x41, 0x25, 0x81, 0x20, 0x24, 0x20, 0x83, 0x04, 0x81, 0x24, 0x40,
+  0x20, 0x81, 0x04, 0x41, 0x20, 0x86, 0x18, 0x82, 0x18, 0x8d, 0x41, 0x05,
+  0x86, 0x42, 0x05, 0x41, 0x25, 0x81, 0x20, 0x22, 0x20, 0x86, 0x41, 0x20,
+  0x81, 0x02, 0x41, 0x20, 0x86, 0x18, 0x82, 0x18, 0x8d, 0x41, 0x07, 0x86,
+  0x42, 0x07, 0x41, 0x37, 0x81, 0x30, 0x36, 0x30, 0x83, 0x04, 0x81, 0x34,
+  0x40, 0x30, 0x81, 0x06, 0x41, 0x30, 0x86, 0x08, 0x82, 0x08, 0x8d, 0x41,
+  0x05, 0x86, 0x42, 0x05, 0x41, 0x25, 0x81, 0x20, 0x24, 0x20, 0x83, 0x04,
+  0x81, 0x24, 0x40, 0x20, 0x81, 0x04, 0x41, 0x20, 0x86, 0x18, 0x82, 0x18,
+  0x8d, 0x41, 0x01, 0x86, 0x45, 0x01, 0x82, 0x02, 0x84, 0x02, 0x81, 0x02,
+  0x83, 0x02, 0x89, 0x38, 0x82, 0x38, 0x8d, 0x41, 0x01, 0x86, 0x45, 0x01,
+  0x82, 0x06, 0x84, 0x04, 0x81, 0x04, 0x83, 0x06, 0x89, 0x38, 0x82, 0x38,
+  0x8d, 0x41, 0x03, 0x86, 0x40, 0x03, 0x2b, 0x42, 0x03, 0x81, 0x06, 0x80,
+  0x04, 0x83, 0x04, 0x81, 0x04, 0x84, 0x06, 0x8a, 0x28, 0x8f, 0x41, 0x04,
+  0x86, 0x40, 0x04, 0x14, 0x42, 0x04, 0x81, 0x04, 0x80, 0x04, 0x83, 0x04,
+  0x81, 0x04, 0x84, 0x04, 0x8a, 0x10, 0x8f, 0x41, 0x05, 0x86, 0x40, 0x05,
+  0x1d, 0x42, 0x05, 0x81, 0x04, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84,
+  0x04, 0x8a, 0x18, 0x8f, 0x41, 0x05, 0x86, 0x40, 0x05, 0x1d, 0x42, 0x05,
+  0x81, 0x02, 0x8e, 0x02, 0x8a, 0x18, 0x8f, 0x41, 0x07, 0x86, 0x40, 0x07,
+  0x0f, 0x42, 0x07, 0x81, 0x06, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84,
+  0x06, 0x8a, 0x08, 0x8f, 0x41, 0x05, 0x86, 0x40, 0x05, 0x1d, 0x42, 0x05,
+  0x81, 0x04, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84, 0x04, 0x8a, 0x18,
+  0x8f, 0x41, 0x01, 0x86, 0x40, 0x01, 0x39, 0x42, 0x01, 0x81, 0x02, 0x80,
+  0x02, 0x83, 0x02, 0x81, 0x02, 0x84, 0x02, 0x8a, 0x38, 0x8f, 0x41, 0x01,
+  0x86, 0x40, 0x01, 0x39, 0x42, 0x01, 0x81, 0x06, 0x80, 0x04, 0x83, 0x04,
+  0x81, 0x04, 0x84, 0x06, 0x8a, 0x38, 0x9a, 0x28, 0x80, 0x28, 0x81, 0x28,
+  0x83, 0x04, 0x28, 0x89, 0x04, 0xa8, 0x10, 0x80, 0x10, 0x81, 0x10, 0x83,
+  0x04, 0x10, 0x89, 0x04, 0xa8, 0x18, 0x80, 0x18, 0x81, 0x18, 0x83, 0x04,
+  0x18, 0x89, 0x04, 0x9d, 0x41, 0x02, 0x86, 0x02, 0x1a, 0x02, 0x1a, 0x40,
+  0x02, 0x1a, 0x84, 0x18, 0xb3, 0x08, 0x80, 0x08, 0x81, 0x08, 0x83, 0x04,
+  0x08, 0x89, 0x04, 0xa8, 0x18, 0x80, 0x18, 0x81, 0x18, 0x83, 0x04, 0x18,
+  0x89, 0x04, 0x9d, 0x41, 0x02, 0x86, 0x02, 0x3a, 0x02, 0x3a, 0x40, 0x02,
+  0x3a, 0x83, 0x02, 0x38, 0x89, 0x02, 0xa8, 0x38, 0x80, 0x38, 0x81, 0x38,
+  0x83, 0x04, 0x38, 0x89, 0x04, 0xa9, 0x28, 0x86, 0x28, 0x81, 0x02, 0x28,
+  0x02, 0x86, 0x04, 0xa9, 0x10, 0x86, 0x10, 0x81, 0x02, 0x10, 0x02, 0x86,
+  0x04, 0xa9, 0x18, 0x86, 0x18, 0x81, 0x02, 0x18, 0x02, 0x86, 0x04, 0x9d,
+  0x41, 0x02, 0x86, 0x40, 0x02, 0x1a, 0x42, 0x02, 0x82, 0x18, 0x82, 0x18,
+  0xb2, 0x08, 0x86, 0x08, 0x81, 0x02, 0x08, 0x02, 0x86, 0x04, 0xa9, 0x18,
+  0x86, 0x18, 0x81, 0x02, 0x18, 0x02, 0x86, 0x04, 0x9d, 0x41, 0x02, 0x86,
+  0x40, 0x02, 0x3a, 0x42, 0x02, 0x82, 0x38, 0x82, 0x38, 0x87, 0x02, 0xa9,
+  0x38, 0x86, 0x38, 0x81, 0x02, 0x38, 0x02, 0x86, 0x04, 0x9d, 0x41, 0x02,
+  0x86, 0x02, 0x42, 0x03, 0x40, 0x02, 0x83, 0x02, 0x82, 0x02, 0x81, 0x07,
+  0xa2, 0x41, 0x02, 0x86, 0x02, 0x42, 0x03, 0x40, 0x02, 0x83, 0x02, 0x82,
+  0x02, 0x81, 0x07, 0xa2, 0x41, 0x02, 0x86, 0x02, 0x42, 0x03, 0x40, 0x02,
+  0x83, 0x02, 0x82, 0x02, 0x81, 0x07, 0xad, 0x42, 0x03, 0x8c, 0x07, 0xa2,
+  0x41, 0x02, 0x86, 0x02, 0x42, 0x03, 0x40, 0x02, 0x83, 0x02, 0x82, 0x02,
+  0x81, 0x07, 0xa2, 0x41, 0x02, 0x86, 0x02, 0x42, 0x03, 0x40, 0x02, 0x83,
+  0x02, 0x82, 0x02, 0x81, 0x07, 0xad, 0x42, 0x03, 0x8c, 0x07, 0xa2, 0x41,
+  0x02, 0x86, 0x02, 0x42, 0x03, 0x40, 0x02, 0x83, 0x02, 0x82, 0x02, 0x81,
+  0x07, 0xa2, 0x41, 0x02, 0x86, 0x02, 0x03, 0x81, 0x40, 0x03, 0x02, 0x81,
+  0x28, 0x82, 0x40, 0x02, 0x2c, 0x02, 0x81, 0x07, 0xa1, 0x41, 0x02, 0x86,
+  0x02, 0x03, 0x81, 0x40, 0x03, 0x02, 0x81, 0x10, 0x82, 0x40, 0x02, 0x14,
+  0x02, 0x81, 0x07, 0xa1, 0x41, 0x02, 0x86, 0x02, 0x03, 0x81, 0x40, 0x03,
+  0x02, 0x81, 0x18, 0x82, 0x40, 0x02, 0x1c, 0x02, 0x81, 0x07, 0xac, 0x03,
+  0x40, 0x07, 0x40, 0x03, 0x82, 0x18, 0x84, 0x18, 0xa5, 0x41, 0x02, 0x86,
+  0x02, 0x03, 0x81, 0x40, 0x03, 0x02, 0x81, 0x08, 0x82, 0x40, 0x02, 0x0c,
+  0x02, 0x81, 0x07, 0xa1, 0x41, 0x02, 0x86, 0x02, 0x03, 0x81, 0x40, 0x03,
+  0x02, 0x81, 0x18, 0x82, 0x40, 0x02, 0x1c, 0x02, 0x81, 0x07, 0xac, 0x03,
+  0x40, 0x07, 0x40, 0x03, 0x82, 0x38, 0x84, 0x3a, 0xa5, 0x41, 0x02, 0x86,
+  0x02, 0x03, 0x81, 0x40, 0x03, 0x02, 0x81, 0x38, 0x82, 0x40, 0x02, 0x3c,
+  0x02, 0x81, 0x07, 0xa1, 0x41, 0x01, 0x86, 0x01, 0x83, 0x40, 0x02, 0x82,
+  0x02, 0x80, 0x04, 0x81, 0x40, 0x02, 0x80, 0x07, 0xa2, 0x41, 0x01, 0x86,
+  0x01, 0x83, 0x40, 0x02, 0x82, 0x02, 0x80, 0x04, 0x81, 0x40, 0x02, 0x80,
+  0x07, 0xa2, 0x41, 0x01, 0x86, 0x01, 0x83, 0x40, 0x02, 0x82, 0x02, 0x80,
+  0x04, 0x81, 0x40, 0x02, 0x80, 0x07, 0xae, 0x07, 0x80, 0x07, 0x40, 0x03,
+  0x8a, 0x07, 0xa2, 0x41, 0x01, 0x86, 0x01, 0x83, 0x40, 0x02, 0x82, 0x02,
+  0x80, 0x04, 0x81, 0x40, 0x02, 0x80, 0x07, 0xa2, 0x41, 0x01, 0x86, 0x01,
+  0x83, 0x40, 0x02, 0x82, 0x02, 0x80, 0x04, 0x81, 0x40, 0x02, 0x80, 0x07,
+  0xa2, 0x41, 0x01, 0x86, 0x01, 0x80, 0x07, 0x80, 0x07, 0x40, 0x02, 0x84,
+  0x02, 0x84, 0x07, 0xa2, 0x41, 0x01, 0x86, 0x01, 0x83, 0x40, 0x02, 0x82,
+  0x02, 0x80, 0x04, 0x81, 0x40, 0x02, 0x80, 0x07, 0xa2, 0x84, 0x06, 0x00,
+  0x00, 0x8a, 0x18, 0x88, 0x10, 0x82, 0x10, 0x80, 0x28, 0x82, 0x40, 0x38,
+  0x83, 0x05, 0x40, 0x38, 0x05, 0x81, 0x10, 0x9e, 0x18, 0x88, 0x10, 0x82,
+  0x10, 0x80, 0x28, 0x82, 0x40, 0x38, 0x83, 0x02, 0x40, 0x38, 0x02, 0x81,
+  0x28, 0x9e, 0x18, 0x88, 0x10, 0x82, 0x10, 0x80, 0x28, 0x82, 0x40, 0x38,
+  0x83, 0x03, 0x40, 0x38, 0x03, 0x81, 0x20, 0x9e, 0x18, 0x42, 0x38, 0x8a,
+  0x40, 0x38, 0x82, 0x40, 0x38, 0x82, 0x03, 0x80, 0x38, 0x3b, 0x80, 0x38,
+  0x20, 0x9e, 0x18, 0x88, 0x10, 0x82, 0x10, 0x80, 0x28, 0x82, 0x40, 0x38,
+  0x83, 0x01, 0x40, 0x38, 0x01, 0x81, 0x30, 0x9e, 0x18, 0x88, 0x10, 0x82,
+  0x10, 0x80, 0x28, 0x82, 0x40, 0x38, 0x83, 0x03, 0x40, 0x38, 0x03, 0x81,
+  0x20, 0x9e, 0x18, 0x42, 0x38, 0x8a, 0x40, 0x38, 0x82, 0x40, 0x38, 0x82,
+  0x07, 0x80, 0x38, 0x3f, 0x80, 0x38, 0x9f, 0x18, 0x88, 0x10, 0x82, 0x10,
+  0x80, 0x28, 0x82, 0x40, 0x38, 0x83, 0x07, 0x40, 0x38, 0x07, 0x97, 0x05,
+  0x89, 0x10, 0x8b, 0x10, 0x80, 0x28, 0x81, 0x05, 0x83, 0x05, 0x82, 0x40,
+  0x05, 0x81, 0x10, 0x94, 0x02, 0x89, 0x10, 0x8b, 0x10, 0x80, 0x28, 0x81,
+  0x02, 0x83, 0x02, 0x82, 0x40, 0x02, 0x81, 0x28, 0x94, 0x03, 0x89, 0x10,
+  0x8b, 0x10, 0x80, 0x28, 0x81, 0x03, 0x83, 0x03, 0x82, 0x40, 0x03, 0x81,
+  0x20, 0x94, 0x03, 0x89, 0x18, 0x40, 0x38, 0x8b, 0x40, 0x38, 0x80, 0x03,
+  0x38, 0x80, 0x38, 0x80, 0x03, 0x81, 0x38, 0x03, 0x3b, 0x80, 0x38, 0x20,
+  0x94, 0x01, 0x89, 0x10, 0x8b, 0x10, 0x80, 0x28, 0x81, 0x01, 0x83, 0x01,
+  0x82, 0x40, 0x01, 0x81, 0x30, 0x94, 0x03, 0x89, 0x10, 0x8b, 0x10, 0x80,
+  0x28, 0x81, 0x03, 0x83, 0x03, 0x82, 0x40, 0x03, 0x81, 0x20, 0x94, 0x07,
+  0x89, 0x10, 0x40, 0x38, 0x8b, 0x40, 0x38, 0x80, 0x07, 0x38, 0x80, 0x38,
+  0x80, 0x07, 0x81, 0x38, 0x07, 0x3f, 0x80, 0x38, 0x95, 0x07, 0x89, 0x10,
+  0x8b, 0x10, 0x80, 0x28, 0x81, 0x07, 0x83, 0x07, 0x82, 0x40, 0x07, 0x97,
+  0x05, 0x82, 0x05, 0x88, 0x10, 0x86, 0x10, 0x82, 0x28, 0x80, 0x08, 0x80,
+  0x08, 0x87, 0x08, 0x80, 0x08, 0x10, 0x94, 0x02, 0x82, 0x02, 0x88, 0x10,
+  0x86, 0x10, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08,
+  0x28, 0x94, 0x03, 0x82, 0x03, 0x88, 0x10, 0x86, 0x10, 0x82, 0x28, 0x80,
+  0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x94, 0x03, 0x82, 0x03,
+  0x88, 0x18, 0x8a, 0x40, 0x38, 0x8c, 0x38, 0x20, 0x94, 0x01, 0x82, 0x01,
+  0x88, 0x10, 0x86, 0x10, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08,
+  0x80, 0x08, 0x30, 0x94, 0x03, 0x82, 0x03, 0x88, 0x10, 0x86, 0x10, 0x82,
+  0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x94, 0x07,
+  0x82, 0x07, 0x88, 0x10, 0x8a, 0x40, 0x38, 0x8c, 0x38, 0x95, 0x07, 0x82,
+  0x07, 0x88, 0x10, 0x86, 0x10, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87,
+  0x08, 0x80, 0x08, 0x99, 0x05, 0x94, 0x28, 0x05, 0x08, 0x80, 0x08, 0x05,
+  0x80, 0x05, 0x81, 0x40, 0x05, 0x80, 0x08, 0x80, 0x0d, 0x15, 0x98, 0x02,
+  0x94, 0x28, 0x02, 0x08, 0x80, 0x08, 0x02, 0x80, 0x02, 0x81, 0x40, 0x02,
+  0x80, 0x08, 0x80, 0x0a, 0x2a, 0x98, 0x03, 0x94, 0x28, 0x03, 0x08, 0x80,
+  0x08, 0x03, 0x80, 0x03, 0x81, 0x40, 0x03, 0x80, 0x08, 0x80, 0x0b, 0x23,
+  0x98, 0x03, 0x94, 0x38, 0x3b, 0x82, 0x3b, 0x38, 0x03, 0x40, 0x38, 0x03,
+  0x3b, 0x38, 0x81, 0x3b, 0x23, 0x98, 0x01, 0x94, 0x28, 0x01, 0x08, 0x80,
+  0x08, 0x01, 0x80, 0x01, 0x81, 0x40, 0x01, 0x80, 0x08, 0x80, 0x09, 0x31,
+  0x98, 0x03, 0x94, 0x28, 0x03, 0x08, 0x80, 0x08, 0x03, 0x80, 0x03, 0x81,
+  0x40, 0x03, 0x80, 0x08, 0x80, 0x0b, 0x23, 0x98, 0x07, 0x94, 0x38, 0x3f,
+  0x82, 0x3f, 0x38, 0x07, 0x40, 0x38, 0x07, 0x3f, 0x38, 0x81, 0x3f, 0x07,
+  0x98, 0x07, 0x94, 0x28, 0x07, 0x08, 0x80, 0x08, 0x07, 0x80, 0x07, 0x81,
+  0x40, 0x07, 0x80, 0x08, 0x80, 0x0f, 0x07, 0x94, 0x05, 0x82, 0x41, 0x05,
+  0x93, 0x28, 0x8c, 0x10, 0x95, 0x02, 0x82, 0x41, 0x02, 0x93, 0x28, 0x8c,
+  0x28, 0x95, 0x03, 0x82, 0x41, 0x03, 0x93, 0x28, 0x8c, 0x20, 0x95, 0x03,
+  0x82, 0x41, 0x03, 0x93, 0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80, 0x38,
+  0x20, 0x95, 0x01, 0x82, 0x41, 0x01, 0x93, 0x28, 0x8c, 0x30, 0x95, 0x03,
+  0x82, 0x41, 0x03, 0x93, 0x28, 0x8c, 0x20, 0x95, 0x07, 0x82, 0x41, 0x07,
+  0x93, 0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80, 0x38, 0x96, 0x07, 0x82,
+  0x41, 0x07, 0x93, 0x28, 0xa7, 0x05, 0x89, 0x28, 0x8b, 0x18, 0x05, 0x83,
+  0x05, 0x82, 0x40, 0x05, 0x10, 0x9a, 0x02, 0x89, 0x20, 0x8b, 0x08, 0x02,
+  0x83, 0x02, 0x82, 0x40, 0x02, 0x28, 0x9a, 0x03, 0x89, 0x28, 0x8b, 0x08,
+  0x03, 0x83, 0x03, 0x82, 0x40, 0x03, 0x20, 0x9a, 0x03, 0x89, 0x38, 0x8b,
+  0x28, 0x3b, 0x83, 0x03, 0x82, 0x03, 0x3b, 0x20, 0x9a, 0x01, 0x89, 0x28,
+  0x8b, 0x18, 0x01, 0x83, 0x01, 0x82, 0x40, 0x01, 0x30, 0x9a, 0x03, 0x89,
+  0x20, 0x8b, 0x08, 0x03, 0x83, 0x03, 0x82, 0x40, 0x03, 0x20, 0x9a, 0x07,
+  0x89, 0x20, 0x8b, 0x28, 0x3f, 0x83, 0x07, 0x82, 0x07, 0x3f, 0x9b, 0x07,
+  0x89, 0x20, 0x8b, 0x18, 0x07, 0x83, 0x07, 0x82, 0x40, 0x07, 0x97, 0x05,
+  0x82, 0x05, 0x88, 0x28, 0x94, 0x05, 0x81, 0x15, 0x97, 0x02, 0x82, 0x02,
+  0x88, 0x20, 0x94, 0x02, 0x81, 0x2a, 0x97, 0x03, 0x82, 0x03, 0x88, 0x28,
+  0x94, 0x03, 0x81, 0x23, 0x97, 0x03, 0x82, 0x03, 0x88, 0x40, 0x38, 0x93,
+  0x03, 0x81, 0x23, 0x97, 0x01, 0x82, 0x01, 0x88, 0x28, 0x94, 0x01, 0x81,
+  0x31, 0x97, 0x03, 0x82, 0x03, 0x88, 0x20, 0x94, 0x03, 0x81, 0x23, 0x97,
+  0x07, 0x82, 0x07, 0x88, 0x20, 0x38, 0x93, 0x07, 0x81, 0x07, 0x97, 0x07,
+  0x82, 0x07, 0x88, 0x20, 0x94, 0x07, 0x81, 0x07, 0x97, 0x05, 0x8c, 0x10,
+  0x8d, 0x10, 0x82, 0x40, 0x10, 0x82, 0x10, 0x98, 0x02, 0x8c, 0x28, 0x8d,
+  0x28, 0x82, 0x40, 0x28, 0x82, 0x28, 0x98, 0x03, 0x8c, 0x20, 0x8d, 0x20,
+  0x82, 0x40, 0x20, 0x82, 0x20, 0x98, 0x03, 0x8c, 0x20, 0x38, 0x80, 0x38,
+  0x8a, 0x20, 0x38, 0x80, 0x38, 0x40, 0x20, 0x38, 0x80, 0x38, 0x20, 0x98,
+  0x01, 0x8c, 0x30, 0x8d, 0x30, 0x82, 0x40, 0x30, 0x82, 0x30, 0x98, 0x03,
+  0x8c, 0x20, 0x8d, 0x20, 0x82, 0x40, 0x20, 0x82, 0x20, 0x98, 0x07, 0x8d,
+  0x38, 0x80, 0x38, 0x8b, 0x38, 0x80, 0x38, 0x81, 0x38, 0x80, 0x38, 0x99,
+  0x07, 0xc0, 0x4c, 0x00, 0x10, 0x84, 0x10, 0x81, 0x10, 0x85, 0x10, 0x81,
+  0x10, 0x80, 0x10, 0x80, 0x40, 0x10, 0xa6, 0x28, 0x84, 0x28, 0x81, 0x28,
+  0x85, 0x28, 0x81, 0x28, 0x80, 0x28, 0x80, 0x40, 0x28, 0xa6, 0x20, 0x84,
+  0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x80, 0x40, 0x20,
+  0xa6, 0x20, 0x84, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20,
+  0x80, 0x40, 0x20, 0xa6, 0x30, 0x84, 0x30, 0x81, 0x30, 0x85, 0x30, 0x81,
+  0x30, 0x80, 0x30, 0x80, 0x40, 0x30, 0xa6, 0x20, 0x84, 0x20, 0x81, 0x20,
+  0x85, 0x20, 0x81, 0x20, 0x80, 0x20, 0x80, 0x40, 0x20, 0xc0, 0xa0, 0x00,
+  0x28, 0xbe, 0x10, 0xbe, 0x18, 0xbe, 0x18, 0xbe, 0x08, 0xbe, 0x18, 0xbe,
+  0x38, 0xbe, 0x38, 0xbe, 0x28, 0x81, 0x28, 0xbb, 0x10, 0x81, 0x10, 0xbb,
+  0x18, 0x81, 0x18, 0xbb, 0x18, 0x81, 0x18, 0xbb, 0x08, 0x81, 0x08, 0xbb,
+  0x18, 0x81, 0x18, 0xbb, 0x38, 0x81, 0x38, 0xbb, 0x38, 0x81, 0x38, 0xb9,
+  0x40, 0x28, 0x80, 0x28, 0x81, 0x28, 0x86, 0x02, 0x86, 0x05, 0x80, 0x05,
+  0x86, 0x02, 0x80, 0x02, 0x9c, 0x40, 0x10, 0x80, 0x10, 0x81, 0x10, 0x86,
+  0x02, 0x86, 0x05, 0x80, 0x05, 0x86, 0x05, 0x80, 0x05, 0x9c, 0x40, 0x18,
+  0x80, 0x18, 0x81, 0x18, 0x86, 0x02, 0x86, 0x05, 0x80, 0x05, 0x86, 0x04,
+  0x80, 0x04, 0x9c, 0x40, 0x18, 0x80, 0x18, 0x81, 0x18, 0x8e, 0x07, 0x80,
+  0x07, 0x86, 0x04, 0x80, 0x04, 0x9c, 0x40, 0x08, 0x80, 0x08, 0x81, 0x08,
+  0x86, 0x02, 0x86, 0x05, 0x80, 0x05, 0x86, 0x06, 0x80, 0x06, 0x9c, 0x40,
+  0x18, 0x80, 0x18, 0x81, 0x18, 0x86, 0x02, 0x86, 0x05, 0x80, 0x05, 0x86,
+  0x04, 0x80, 0x04, 0x9c, 0x40, 0x38, 0x80, 0x38, 0x81, 0x38, 0x8e, 0x07,
+  0x80, 0x07, 0xa6, 0x40, 0x38, 0x80, 0x38, 0x81, 0x38, 0x86, 0x02, 0x86,
+  0x05, 0x80, 0x05, 0xa8, 0x28, 0x81, 0x28, 0x87, 0x02, 0x80, 0x02, 0x80,
+  0x02, 0x81, 0x05, 0x82, 0x05, 0x84, 0x02, 0x82, 0x02, 0x9d, 0x10, 0x81,
+  0x10, 0x87, 0x02, 0x80, 0x02, 0x80, 0x02, 0x81, 0x05, 0x82, 0x05, 0x84,
+  0x05, 0x82, 0x05, 0x9d, 0x18, 0x81, 0x18, 0x87, 0x02, 0x80, 0x02, 0x80,
+  0x02, 0x81, 0x05, 0x82, 0x05, 0x84, 0x04, 0x82, 0x04, 0x9d, 0x18, 0x81,
+  0x18, 0x8e, 0x40, 0x07, 0x80, 0x40, 0x07, 0x84, 0x04, 0x07, 0x80, 0x07,
+  0x04, 0x9d, 0x08, 0x81, 0x08, 0x87, 0x02, 0x80, 0x02, 0x80, 0x02, 0x81,
+  0x05, 0x82, 0x05, 0x84, 0x06, 0x82, 0x06, 0x9d, 0x18, 0x81, 0x18, 0x87,
+  0x02, 0x80, 0x02, 0x80, 0x02, 0x81, 0x05, 0x82, 0x05, 0x84, 0x04, 0x82,
+  0x04, 0x9d, 0x38, 0x81, 0x38, 0x8e, 0x40, 0x07, 0x80, 0x40, 0x07, 0x85,
+  0x07, 0x80, 0x07, 0x9e, 0x38, 0x81, 0x38, 0x87, 0x02, 0x80, 0x02, 0x80,
+  0x02, 0x81, 0x05, 0x82, 0x05, 0xa7, 0x28, 0x80, 0x42, 0x01, 0x85, 0x02,
+  0x82, 0x06, 0x81, 0x05, 0x83, 0x05, 0x87, 0x02, 0x9d, 0x10, 0x80, 0x42,
+  0x01, 0x85, 0x02, 0x82, 0x06, 0x81, 0x05, 0x83, 0x05, 0x87, 0x05, 0x9d,
+  0x18, 0x80, 0x42, 0x01, 0x85, 0x02, 0x82, 0x06, 0x81, 0x05, 0x83, 0x05,
+  0x87, 0x04, 0x9d, 0x18, 0x80, 0x42, 0x03, 0x8c, 0x40, 0x07, 0x81, 0x40,
+  0x07, 0x83, 0x07, 0x81, 0x07, 0x04, 0x9d, 0x08, 0x80, 0x42, 0x01, 0x85,
+  0x02, 0x82, 0x06, 0x81, 0x05, 0x83, 0x05, 0x87, 0x06, 0x9d, 0x18, 0x80,
+  0x42, 0x01, 0x85, 0x02, 0x82, 0x06, 0x81, 0x05, 0x83, 0x05, 0x87, 0x04,
+  0x9d, 0x38, 0x80, 0x42, 0x03, 0x89, 0x02, 0x81, 0x40, 0x07, 0x81, 0x40,
+  0x07, 0x83, 0x07, 0x81, 0x07, 0x9e, 0x38, 0x80, 0x42, 0x01, 0x85, 0x02,
+  0x82, 0x06, 0x81, 0x05, 0x83, 0x05, 0xa8, 0x01, 0x81, 0x40, 0x01, 0x81,
+  0x04, 0x02, 0x80, 0x02, 0x83, 0x40, 0x02, 0x05, 0x8c, 0x02, 0x9f, 0x01,
+  0x81, 0x40, 0x01, 0x81, 0x06, 0x02, 0x80, 0x02, 0x83, 0x40, 0x02, 0x05,
+  0x8c, 0x05, 0x9f, 0x01, 0x81, 0x40, 0x01, 0x81, 0x06, 0x02, 0x80, 0x02,
+  0x83, 0x40, 0x02, 0x05, 0x8c, 0x04, 0x9f, 0x03, 0x40, 0x07, 0x40, 0x03,
+  0x81, 0x02, 0x88, 0x40, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x04,
+  0x9f, 0x01, 0x81, 0x40, 0x01, 0x81, 0x04, 0x02, 0x80, 0x02, 0x83, 0x40,
+  0x02, 0x05, 0x8c, 0x06, 0x9f, 0x01, 0x81, 0x40, 0x01, 0x81, 0x06, 0x02,
+  0x80, 0x02, 0x83, 0x40, 0x02, 0x05, 0x8c, 0x04, 0x9f, 0x03, 0x40, 0x07,
+  0x40, 0x03, 0x81, 0x02, 0x88, 0x40, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82,
+  0x07, 0xa0, 0x01, 0x81, 0x40, 0x01, 0x81, 0x04, 0x02, 0x80, 0x02, 0x83,
+  0x40, 0x02, 0x05, 0xb1, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80,
+  0x05, 0x8c, 0x02, 0xa3, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80,
+  0x05, 0x8c, 0x05, 0xa3, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80,
+  0x05, 0x8c, 0x04, 0xa0, 0x07, 0x80, 0x07, 0x40, 0x03, 0x8a, 0x40, 0x07,
+  0x8a, 0x07, 0x04, 0xa3, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80,
+  0x05, 0x8c, 0x06, 0xa3, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80,
+  0x05, 0x8c, 0x04, 0xa0, 0x07, 0x80, 0x07, 0x40, 0x03, 0x8a, 0x40, 0x07,
+  0x8a, 0x07, 0xa4, 0x40, 0x03, 0x82, 0x02, 0x83, 0x40, 0x02, 0x80, 0x05,
+  0xa2, 0x47, 0x08, 0x00, 0x00, 0x8a, 0x43, 0x18, 0x38, 0x82, 0x40, 0x10,
+  0x20, 0x82, 0x20, 0x80, 0x28, 0x82, 0x38, 0x83, 0x05, 0x80, 0x38, 0x82,
+  0x10, 0x9e, 0x43, 0x18, 0x38, 0x82, 0x40, 0x10, 0x20, 0x82, 0x20, 0x80,
+  0x28, 0x82, 0x38, 0x83, 0x02, 0x80, 0x38, 0x82, 0x28, 0x9e, 0x43, 0x18,
+  0x38, 0x82, 0x40, 0x10, 0x20, 0x82, 0x20, 0x80, 0x28, 0x82, 0x38, 0x83,
+  0x03, 0x80, 0x38, 0x82, 0x20, 0x9e, 0x18, 0x40, 0x20, 0x40, 0x18, 0x38,
+  0x8a, 0x40, 0x38, 0x82, 0x38, 0x82, 0x03, 0x81, 0x38, 0x80, 0x38, 0x20,
+  0x9e, 0x43, 0x18, 0x38, 0x82, 0x40, 0x10, 0x20, 0x82, 0x20, 0x80, 0x28,
+  0x82, 0x38, 0x83, 0x01, 0x80, 0x38, 0x82, 0x30, 0x9e, 0x43, 0x18, 0x38,
+  0x82, 0x40, 0x10, 0x20, 0x82, 0x20, 0x80, 0x28, 0x82, 0x38, 0x83, 0x03,
+  0x80, 0x38, 0x82, 0x20, 0x9e, 0x18, 0x40, 0x20, 0x40, 0x18, 0x38, 0x84,
+  0x10, 0x82, 0x10, 0x80, 0x40, 0x38, 0x82, 0x38, 0x82, 0x07, 0x81, 0x38,
+  0x80, 0x38, 0x9f, 0x43, 0x18, 0x38, 0x82, 0x40, 0x10, 0x20, 0x82, 0x20,
+  0x80, 0x28, 0x82, 0x38, 0x83, 0x07, 0x80, 0x38, 0x98, 0x05, 0x89, 0x10,
+  0x84, 0x20, 0x81, 0x10, 0x83, 0x20, 0x82, 0x05, 0x80, 0x38, 0x81, 0x05,
+  0x82, 0x3d, 0x98, 0x02, 0x89, 0x10, 0x84, 0x30, 0x81, 0x10, 0x83, 0x20,
+  0x82, 0x02, 0x80, 0x38, 0x81, 0x02, 0x82, 0x3a, 0x98, 0x03, 0x89, 0x10,
+  0x84, 0x30, 0x81, 0x10, 0x83, 0x20, 0x82, 0x03, 0x80, 0x38, 0x81, 0x03,
+  0x82, 0x3b, 0x98, 0x03, 0x89, 0x18, 0x42, 0x38, 0x80, 0x10, 0x8a, 0x03,
+  0x80, 0x38, 0x81, 0x03, 0x82, 0x3b, 0x98, 0x01, 0x89, 0x10, 0x84, 0x20,
+  0x81, 0x10, 0x83, 0x20, 0x82, 0x01, 0x80, 0x38, 0x81, 0x01, 0x82, 0x39,
+  0x98, 0x03, 0x89, 0x10, 0x84, 0x30, 0x81, 0x10, 0x83, 0x20, 0x82, 0x03,
+  0x80, 0x38, 0x81, 0x03, 0x82, 0x3b, 0x98, 0x07, 0x89, 0x10, 0x42, 0x38,
+  0x80, 0x10, 0x86, 0x10, 0x82, 0x07, 0x80, 0x38, 0x81, 0x07, 0x82, 0x3f,
+  0x98, 0x07, 0x89, 0x10, 0x84, 0x20, 0x81, 0x10, 0x83, 0x20, 0x82, 0x07,
+  0x80, 0x38, 0x81, 0x07, 0x82, 0x3f, 0x97, 0x40, 0x05, 0x88, 0x42, 0x10,
+  0x88, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x94, 0x40, 0x02, 0x88,
+  0x42, 0x10, 0x88, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x94, 0x40,
+  0x03, 0x88, 0x42, 0x10, 0x88, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0x94, 0x40, 0x03, 0x88, 0x40, 0x18, 0x40, 0x20, 0x40, 0x38, 0x8e, 0x40,
+  0x38, 0x84, 0x40, 0x38, 0x96, 0x40, 0x01, 0x88, 0x42, 0x10, 0x88, 0x20,
+  0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x94, 0x40, 0x03, 0x88, 0x42, 0x10,
+  0x88, 0x20, 0x84, 0x40, 0x08, 0x88, 0x40, 0x08, 0x94, 0x40, 0x07, 0x88,
+  0x40, 0x10, 0x40, 0x28, 0x40, 0x38, 0x86, 0x10, 0x86, 0x40, 0x38, 0x84,
+  0x40, 0x38, 0x96, 0x40, 0x07, 0x88, 0x42, 0x10, 0x88, 0x20, 0x84, 0x40,
+  0x08, 0x88, 0x40, 0x08, 0x9f, 0x44, 0x20, 0x81, 0x30, 0x80, 0x20, 0x81,
+  0x20, 0x82, 0x05, 0x82, 0x05, 0x80, 0x05, 0x84, 0x05, 0xa1, 0x44, 0x20,
+  0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x82, 0x02, 0x82, 0x02, 0x80, 0x02,
+  0x84, 0x02, 0xa1, 0x44, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x82,
+  0x03, 0x82, 0x03, 0x80, 0x03, 0x84, 0x03, 0xa1, 0x30, 0x41, 0x08, 0x40,
+  0x30, 0x81, 0x10, 0x87, 0x03, 0x82, 0x03, 0x38, 0x03, 0x80, 0x38, 0x81,
+  0x38, 0x03, 0xa1, 0x44, 0x20, 0x81, 0x30, 0x80, 0x20, 0x81, 0x20, 0x82,
+  0x01, 0x82, 0x01, 0x80, 0x01, 0x84, 0x01, 0xa1, 0x44, 0x20, 0x81, 0x20,
+  0x80, 0x20, 0x81, 0x20, 0x82, 0x03, 0x82, 0x03, 0x80, 0x03, 0x84, 0x03,
+  0xa1, 0x30, 0x41, 0x08, 0x40, 0x30, 0x81, 0x10, 0x80, 0x10, 0x81, 0x10,
+  0x82, 0x07, 0x82, 0x07, 0x38, 0x07, 0x80, 0x38, 0x81, 0x38, 0x07, 0xa1,
+  0x44, 0x20, 0x81, 0x30, 0x80, 0x20, 0x81, 0x20, 0x82, 0x07, 0x82, 0x07,
+  0x80, 0x07, 0x84, 0x07, 0x99, 0x41, 0x05, 0x85, 0x42, 0x20, 0x83, 0x30,
+  0x20, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x10, 0x82, 0x05,
+  0x92, 0x41, 0x02, 0x85, 0x42, 0x20, 0x83, 0x40, 0x20, 0x85, 0x28, 0x80,
+  0x40, 0x08, 0x88, 0x40, 0x08, 0x28, 0x82, 0x02, 0x92, 0x41, 0x03, 0x85,
+  0x42, 0x20, 0x83, 0x40, 0x20, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x20, 0x82, 0x03, 0x92, 0x41, 0x03, 0x85, 0x42, 0x30, 0x83, 0x10,
+  0x86, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38, 0x82, 0x38, 0x20,
+  0x82, 0x03, 0x92, 0x41, 0x01, 0x85, 0x42, 0x20, 0x83, 0x30, 0x20, 0x85,
+  0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x30, 0x82, 0x01, 0x92, 0x41,
+  0x03, 0x85, 0x42, 0x20, 0x83, 0x40, 0x20, 0x85, 0x28, 0x80, 0x40, 0x08,
+  0x88, 0x40, 0x08, 0x20, 0x82, 0x03, 0x92, 0x41, 0x07, 0x85, 0x42, 0x30,
+  0x83, 0x40, 0x10, 0x85, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x82, 0x38, 0x83, 0x07, 0x92, 0x41, 0x07, 0x85, 0x42, 0x20, 0x83, 0x30,
+  0x20, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08, 0x83, 0x07, 0xa1,
+  0x18, 0x81, 0x46, 0x30, 0x18, 0x05, 0x83, 0x05, 0x82, 0x05, 0x81, 0x10,
+  0x83, 0x05, 0xa1, 0x08, 0x81, 0x46, 0x20, 0x08, 0x02, 0x83, 0x02, 0x82,
+  0x02, 0x81, 0x28, 0x83, 0x02, 0xa1, 0x08, 0x81, 0x46, 0x20, 0x08, 0x03,
+  0x83, 0x03, 0x82, 0x03, 0x81, 0x20, 0x83, 0x03, 0xa1, 0x28, 0x81, 0x46,
+  0x10, 0x28, 0x3b, 0x81, 0x40, 0x38, 0x3b, 0x41, 0x38, 0x3b, 0x80, 0x38,
+  0x20, 0x83, 0x03, 0xa1, 0x18, 0x81, 0x46, 0x30, 0x18, 0x01, 0x83, 0x01,
+  0x82, 0x01, 0x81, 0x30, 0x83, 0x01, 0xa1, 0x08, 0x81, 0x46, 0x20, 0x08,
+  0x03, 0x83, 0x03, 0x82, 0x03, 0x81, 0x20, 0x83, 0x03, 0xa1, 0x28, 0x81,
+  0x46, 0x10, 0x28, 0x3f, 0x81, 0x40, 0x38, 0x3f, 0x41, 0x38, 0x3f, 0x80,
+  0x38, 0x84, 0x07, 0xa1, 0x18, 0x81, 0x46, 0x30, 0x18, 0x07, 0x83, 0x07,
+  0x82, 0x07, 0x86, 0x07, 0x8f, 0x40, 0x05, 0x8d, 0x28, 0x81, 0x49, 0x1a,
+  0x44, 0x02, 0x80, 0x05, 0x82, 0x10, 0x95, 0x40, 0x02, 0x8d, 0x20, 0x81,
+  0x49, 0x0d, 0x44, 0x05, 0x80, 0x02, 0x82, 0x28, 0x95, 0x40, 0x03, 0x8d,
+  0x28, 0x81, 0x49, 0x0c, 0x44, 0x04, 0x80, 0x03, 0x82, 0x20, 0x95, 0x40,
+  0x03, 0x8d, 0x41, 0x38, 0x49, 0x2c, 0x04, 0x43, 0x3c, 0x38, 0x3b, 0x41,
+  0x38, 0x20, 0x95, 0x40, 0x01, 0x8d, 0x28, 0x81, 0x49, 0x1e, 0x44, 0x06,
+  0x80, 0x01, 0x82, 0x30, 0x95, 0x40, 0x03, 0x8d, 0x20, 0x81, 0x49, 0x0c,
+  0x44, 0x04, 0x80, 0x03, 0x82, 0x20, 0x95, 0x40, 0x07, 0x8d, 0x20, 0x40,
+  0x38, 0x49, 0x28, 0x80, 0x44, 0x38, 0x3f, 0x41, 0x38, 0x96, 0x40, 0x07,
+  0x8d, 0x20, 0x81, 0x49, 0x18, 0x86, 0x07, 0x9a, 0x05, 0x8d, 0x10, 0x80,
+  0x02, 0x03, 0x13, 0x42, 0x03, 0x44, 0x13, 0x42, 0x03, 0x13, 0x02, 0x82,
+  0x10, 0x81, 0x41, 0x05, 0x80, 0x05, 0x80, 0x40, 0x05, 0x8d, 0x02, 0x8d,
+  0x28, 0x80, 0x05, 0x01, 0x29, 0x42, 0x01, 0x44, 0x29, 0x42, 0x01, 0x29,
+  0x05, 0x82, 0x28, 0x81, 0x41, 0x02, 0x80, 0x02, 0x80, 0x40, 0x02, 0x8d,
+  0x03, 0x8d, 0x20, 0x80, 0x04, 0x01, 0x21, 0x42, 0x01, 0x44, 0x21, 0x42,
+  0x01, 0x21, 0x04, 0x82, 0x20, 0x81, 0x41, 0x03, 0x80, 0x03, 0x80, 0x40,
+  0x03, 0x8d, 0x03, 0x8d, 0x20, 0x38, 0x04, 0x05, 0x25, 0x05, 0x40, 0x3d,
+  0x05, 0x44, 0x25, 0x05, 0x40, 0x3d, 0x05, 0x25, 0x04, 0x40, 0x38, 0x80,
+  0x20, 0x81, 0x41, 0x03, 0x80, 0x03, 0x80, 0x40, 0x03, 0x8d, 0x01, 0x8d,
+  0x30, 0x80, 0x06, 0x03, 0x33, 0x42, 0x03, 0x44, 0x33, 0x42, 0x03, 0x33,
+  0x06, 0x82, 0x30, 0x81, 0x41, 0x01, 0x80, 0x01, 0x80, 0x40, 0x01, 0x8d,
+  0x03, 0x8d, 0x20, 0x80, 0x04, 0x01, 0x21, 0x42, 0x01, 0x44, 0x21, 0x42,
+  0x01, 0x21, 0x04, 0x82, 0x20, 0x81, 0x41, 0x03, 0x80, 0x03, 0x80, 0x40,
+  0x03, 0x8d, 0x07, 0x8e, 0x38, 0x80, 0x41, 0x05, 0x40, 0x3d, 0x46, 0x05,
+  0x40, 0x3d, 0x40, 0x05, 0x80, 0x40, 0x38, 0x83, 0x41, 0x07, 0x80, 0x07,
+  0x80, 0x40, 0x07, 0x8d, 0x07, 0x90, 0x4f, 0x03, 0x86, 0x41, 0x07, 0x80,
+  0x07, 0x80, 0x40, 0x07, 0x92, 0x28, 0x88, 0x10, 0x02, 0x03, 0x40, 0x10,
+  0x42, 0x06, 0x16, 0x46, 0x06, 0x80, 0x10, 0x03, 0x02, 0x81, 0x10, 0x9c,
+  0x10, 0x88, 0x28, 0x05, 0x01, 0x40, 0x28, 0x42, 0x04, 0x2c, 0x46, 0x04,
+  0x80, 0x28, 0x01, 0x05, 0x81, 0x28, 0x9c, 0x18, 0x88, 0x20, 0x04, 0x01,
+  0x40, 0x20, 0x42, 0x04, 0x24, 0x46, 0x04, 0x80, 0x20, 0x01, 0x04, 0x81,
+  0x20, 0x9c, 0x18, 0x88, 0x20, 0x04, 0x3d, 0x18, 0x20, 0x40, 0x02, 0x40,
+  0x3a, 0x22, 0x45, 0x02, 0x3a, 0x38, 0x20, 0x05, 0x04, 0x40, 0x38, 0x20,
+  0x9c, 0x08, 0x88, 0x30, 0x06, 0x03, 0x40, 0x30, 0x42, 0x06, 0x36, 0x46,
+  0x06, 0x80, 0x30, 0x03, 0x06, 0x81, 0x30, 0x9c, 0x18, 0x88, 0x20, 0x04,
+  0x01, 0x40, 0x20, 0x42, 0x04, 0x24, 0x46, 0x04, 0x80, 0x20, 0x01, 0x04,
+  0x81, 0x20, 0x9c, 0x38, 0x8a, 0x3d, 0x38, 0x80, 0x40, 0x02, 0x40, 0x3a,
+  0x46, 0x02, 0x3a, 0x38, 0x80, 0x05, 0x80, 0x40, 0x38, 0x9d, 0x38, 0x8a,
+  0x03, 0x81, 0x4b, 0x06, 0x81, 0x03, 0xa0, 0x28, 0x81, 0x28, 0x86, 0x41,
+  0x10, 0x06, 0x81, 0x41, 0x10, 0x04, 0x81, 0x04, 0x82, 0x10, 0x16, 0x10,
+  0x81, 0x41, 0x10, 0x85, 0x05, 0x95, 0x10, 0x81, 0x10, 0x86, 0x41, 0x28,
+  0x04, 0x81, 0x41, 0x28, 0x04, 0x81, 0x04, 0x82, 0x28, 0x2c, 0x28, 0x81,
+  0x41, 0x28, 0x85, 0x02, 0x95, 0x18, 0x81, 0x18, 0x86, 0x41, 0x20, 0x04,
+  0x81, 0x41, 0x20, 0x04, 0x81, 0x04, 0x82, 0x20, 0x24, 0x20, 0x81, 0x41,
+  0x20, 0x85, 0x03, 0x95, 0x18, 0x81, 0x18, 0x86, 0x41, 0x20, 0x02, 0x81,
+  0x41, 0x20, 0x86, 0x20, 0x22, 0x20, 0x81, 0x41, 0x20, 0x85, 0x03, 0x95,
+  0x08, 0x81, 0x08, 0x86, 0x41, 0x30, 0x06, 0x81, 0x41, 0x30, 0x04, 0x81,
+  0x04, 0x82, 0x30, 0x36, 0x30, 0x81, 0x41, 0x30, 0x85, 0x01, 0x95, 0x18,
+  0x81, 0x18, 0x86, 0x41, 0x20, 0x04, 0x81, 0x41, 0x20, 0x04, 0x81, 0x04,
+  0x82, 0x20, 0x24, 0x20, 0x81, 0x41, 0x20, 0x85, 0x03, 0x95, 0x38, 0x81,
+  0x38, 0x89, 0x02, 0x84, 0x02, 0x81, 0x02, 0x83, 0x02, 0x8b, 0x07, 0x95,
+  0x38, 0x81, 0x38, 0x89, 0x06, 0x84, 0x04, 0x81, 0x04, 0x83, 0x06, 0x8b,
+  0x07, 0x98, 0x28, 0x88, 0x06, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84,
+  0x06, 0x8a, 0x05, 0x98, 0x10, 0x88, 0x04, 0x80, 0x04, 0x83, 0x04, 0x81,
+  0x04, 0x84, 0x04, 0x8a, 0x02, 0x98, 0x18, 0x88, 0x04, 0x80, 0x04, 0x83,
+  0x04, 0x81, 0x04, 0x84, 0x04, 0x8a, 0x03, 0x98, 0x18, 0x88, 0x02, 0x8e,
+  0x02, 0x8a, 0x03, 0x98, 0x08, 0x88, 0x06, 0x80, 0x04, 0x83, 0x04, 0x81,
+  0x04, 0x84, 0x06, 0x8a, 0x01, 0x98, 0x18, 0x88, 0x04, 0x80, 0x04, 0x83,
+  0x04, 0x81, 0x04, 0x84, 0x04, 0x8a, 0x03, 0x98, 0x38, 0x88, 0x02, 0x80,
+  0x02, 0x83, 0x02, 0x81, 0x02, 0x84, 0x02, 0x8a, 0x07, 0x98, 0x38, 0x88,
+  0x06, 0x80, 0x04, 0x83, 0x04, 0x81, 0x04, 0x84, 0x06, 0x8a, 0x07, 0x91,
+  0x40, 0x28, 0x81, 0x40, 0x28, 0x80, 0x41, 0x28, 0x85, 0x04, 0x81, 0x06,
+  0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40, 0x02, 0x97, 0x40, 0x10, 0x81,
+  0x40, 0x10, 0x80, 0x41, 0x10, 0x85, 0x06, 0x81, 0x06, 0x87, 0x40, 0x05,
+  0x80, 0x04, 0x85, 0x40, 0x05, 0x97, 0x40, 0x18, 0x81, 0x40, 0x18, 0x80,
+  0x41, 0x18, 0x85, 0x06, 0x81, 0x06, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85,
+  0x40, 0x04, 0x97, 0x40, 0x18, 0x81, 0x40, 0x18, 0x80, 0x41, 0x18, 0x85,
+  0x02, 0x8a, 0x40, 0x07, 0x87, 0x40, 0x04, 0x97, 0x40, 0x08, 0x81, 0x40,
+  0x08, 0x80, 0x41, 0x08, 0x85, 0x04, 0x81, 0x06, 0x87, 0x40, 0x05, 0x80,
+  0x04, 0x85, 0x40, 0x06, 0x97, 0x40, 0x18, 0x81, 0x40, 0x18, 0x80, 0x41,
+  0x18, 0x85, 0x06, 0x81, 0x06, 0x87, 0x40, 0x05, 0x80, 0x04, 0x85, 0x40,
+  0x04, 0x97, 0x40, 0x38, 0x81, 0x40, 0x38, 0x80, 0x41, 0x38, 0x85, 0x02,
+  0x81, 0x02, 0x87, 0x40, 0x07, 0x80, 0x02, 0x9f, 0x40, 0x38, 0x81, 0x40,
+  0x38, 0x80, 0x41, 0x38, 0x85, 0x04, 0x81, 0x06, 0x87, 0x40, 0x05, 0x80,
+  0x04, 0xa6, 0x28, 0x85, 0x06, 0x82, 0x40, 0x02, 0x86, 0x05, 0x81, 0x05,
+  0x04, 0x84, 0x02, 0x81, 0x02, 0x9d, 0x10, 0x85, 0x06, 0x82, 0x40, 0x02,
+  0x86, 0x05, 0x81, 0x05, 0x04, 0x84, 0x05, 0x81, 0x05, 0x9d, 0x18, 0x85,
+  0x06, 0x82, 0x40, 0x02, 0x86, 0x05, 0x81, 0x05, 0x04, 0x84, 0x04, 0x81,
+  0x04, 0x9d, 0x18, 0x85, 0x06, 0x8b, 0x42, 0x07, 0x85, 0x04, 0x40, 0x07,
+  0x04, 0x9d, 0x08, 0x85, 0x06, 0x82, 0x40, 0x02, 0x86, 0x05, 0x81, 0x05,
+  0x04, 0x84, 0x06, 0x81, 0x06, 0x9d, 0x18, 0x85, 0x06, 0x82, 0x40, 0x02,
+  0x86, 0x05, 0x81, 0x05, 0x04, 0x84, 0x04, 0x81, 0x04, 0x9d, 0x38, 0x85,
+  0x06, 0x8b, 0x42, 0x07, 0x02, 0x85, 0x40, 0x07, 0x9e, 0x38, 0x85, 0x06,
+  0x82, 0x40, 0x02, 0x86, 0x05, 0x81, 0x05, 0x04, 0xa3, 0x28, 0x81, 0x28,
+  0x8e, 0x04, 0x86, 0x05, 0x83, 0x02, 0x9e, 0x10, 0x81, 0x10, 0x8e, 0x04,
+  0x86, 0x05, 0x83, 0x05, 0x9e, 0x18, 0x81, 0x18, 0x8e, 0x04, 0x86, 0x05,
+  0x83, 0x04, 0x9e, 0x18, 0x81, 0x18, 0x95, 0x40, 0x07, 0x83, 0x04, 0x07,
+  0x9d, 0x08, 0x81, 0x08, 0x8e, 0x04, 0x86, 0x05, 0x83, 0x06, 0x9e, 0x18,
+  0x81, 0x18, 0x8e, 0x04, 0x86, 0x05, 0x83, 0x04, 0x9e, 0x38, 0x81, 0x38,
+  0x8e, 0x02, 0x85, 0x40, 0x07, 0x84, 0x07, 0x9d, 0x38, 0x81, 0x38, 0x8e,
+  0x04, 0x86, 0x05, 0xa3, 0x28, 0x84, 0x40, 0x01, 0x80, 0x06, 0x81, 0x04,
+  0x02, 0x82, 0x40, 0x02, 0x04, 0x87, 0x40, 0x05, 0x03, 0xa0, 0x10, 0x84,
+  0x40, 0x01, 0x80, 0x06, 0x81, 0x06, 0x02, 0x82, 0x40, 0x02, 0x04, 0x87,
+  0x40, 0x05, 0x01, 0xa0, 0x18, 0x84, 0x40, 0x01, 0x80, 0x06, 0x81, 0x06,
+  0x02, 0x82, 0x40, 0x02, 0x04, 0x87, 0x40, 0x05, 0x01, 0xa0, 0x18, 0x84,
+  0x40, 0x03, 0x80, 0x04, 0x81, 0x02, 0x8d, 0x41, 0x07, 0x05, 0x80, 0x07,
+  0x9e, 0x08, 0x84, 0x40, 0x01, 0x80, 0x06, 0x81, 0x04, 0x02, 0x82, 0x40,
+  0x02, 0x04, 0x87, 0x40, 0x05, 0x03, 0xa0, 0x18, 0x84, 0x40, 0x01, 0x80,
+  0x06, 0x81, 0x06, 0x02, 0x82, 0x40, 0x02, 0x04, 0x87, 0x40, 0x05, 0x01,
+  0xa0, 0x38, 0x84, 0x40, 0x03, 0x80, 0x04, 0x81, 0x02, 0x85, 0x02, 0x86,
+  0x41, 0x07, 0x05, 0x80, 0x07, 0x9e, 0x38, 0x84, 0x40, 0x01, 0x80, 0x06,
+  0x81, 0x04, 0x02, 0x82, 0x40, 0x02, 0x04, 0x87, 0x40, 0x05, 0x03, 0xa5,
+  0x42, 0x03, 0x86, 0x04, 0xb3, 0x42, 0x03, 0x86, 0x04, 0xb3, 0x42, 0x03,
+  0x86, 0x04, 0xb3, 0x03, 0x40, 0x04, 0x03, 0x92, 0x42, 0x07, 0xa4, 0x42,
+  0x03, 0x86, 0x04, 0xb3, 0x42, 0x03, 0x86, 0x04, 0xb3, 0x03, 0x40, 0x04,
+  0x03, 0x86, 0x02, 0x8a, 0x42, 0x07, 0xa4, 0x42, 0x03, 0x86, 0x04, 0xa8,
+  0x8e, 0x04, 0x00, 0x00, 0x8f, 0x20, 0x82, 0x10, 0xba, 0x20, 0x82, 0x10,
+  0xba, 0x20, 0x82, 0x10, 0xba, 0x20, 0xbe, 0x20, 0x82, 0x10, 0xba, 0x20,
+  0x82, 0x10, 0xba, 0x20, 0xbe, 0x20, 0x82, 0x10, 0xbc, 0x20, 0xbe, 0x30,
+  0xbe, 0x30, 0xbb, 0x40, 0x38, 0x80, 0x10, 0xbe, 0x20, 0xbe, 0x30, 0xbb,
+  0x40, 0x38, 0x80, 0x10, 0xbe, 0x20, 0xac, 0x05, 0x89, 0x10, 0x8a, 0x05,
+  0xa7, 0x02, 0x89, 0x10, 0x8a, 0x02, 0xa7, 0x03, 0x89, 0x10, 0x8a, 0x03,
+  0xa7, 0x03, 0x89, 0x18, 0x8a, 0x03, 0xa7, 0x01, 0x89, 0x10, 0x8a, 0x01,
+  0xa7, 0x03, 0x89, 0x10, 0x8a, 0x03, 0xa7, 0x07, 0x89, 0x10, 0x8a, 0x07,
+  0xa7, 0x07, 0x89, 0x10, 0x8a, 0x07, 0xbd, 0x05, 0x80, 0x05, 0xbc, 0x02,
+  0x80, 0x02, 0xbc, 0x03, 0x80, 0x03, 0xb4, 0x38, 0x86, 0x03, 0x80, 0x03,
+  0xbc, 0x01, 0x80, 0x01, 0xbc, 0x03, 0x80, 0x03, 0xb4, 0x38, 0x86, 0x07,
+  0x80, 0x07, 0xbc, 0x07, 0x80, 0x07, 0xa7, 0x05, 0x88, 0x20, 0x82, 0x20,
+  0x86, 0x05, 0x92, 0x05, 0x82, 0x05, 0x90, 0x02, 0x88, 0x20, 0x82, 0x20,
+  0x86, 0x02, 0x92, 0x02, 0x82, 0x02, 0x90, 0x03, 0x88, 0x20, 0x82, 0x20,
+  0x86, 0x03, 0x92, 0x03, 0x82, 0x03, 0x90, 0x03, 0x88, 0x30, 0x40, 0x38,
+  0x80, 0x30, 0x86, 0x03, 0x92, 0x03, 0x82, 0x03, 0x90, 0x01, 0x88, 0x20,
+  0x82, 0x20, 0x86, 0x01, 0x92, 0x01, 0x82, 0x01, 0x90, 0x03, 0x88, 0x20,
+  0x82, 0x20, 0x86, 0x03, 0x92, 0x03, 0x82, 0x03, 0x90, 0x07, 0x88, 0x30,
+  0x40, 0x38, 0x80, 0x30, 0x86, 0x07, 0x92, 0x07, 0x82, 0x07, 0x90, 0x07,
+  0x88, 0x20, 0x82, 0x20, 0x86, 0x07, 0x92, 0x07, 0x82, 0x07, 0x9b, 0x40,
+  0x28, 0x9a, 0x05, 0x82, 0x05, 0x80, 0x05, 0x9b, 0x40, 0x20, 0x9a, 0x02,
+  0x82, 0x02, 0x80, 0x02, 0x9b, 0x40, 0x28, 0x9a, 0x03, 0x82, 0x03, 0x80,
+  0x03, 0x9b, 0x40, 0x38, 0x9a, 0x03, 0x82, 0x03, 0x80, 0x03, 0x9b, 0x40,
+  0x28, 0x9a, 0x01, 0x82, 0x01, 0x80, 0x01, 0x9b, 0x40, 0x20, 0x9a, 0x03,
+  0x82, 0x03, 0x80, 0x03, 0x9b, 0x40, 0x20, 0x9a, 0x07, 0x82, 0x07, 0x80,
+  0x07, 0x9b, 0x40, 0x20, 0x9a, 0x07, 0x82, 0x07, 0x80, 0x07, 0x8f, 0x05,
+  0xbe, 0x02, 0xbe, 0x03, 0xbe, 0x03, 0xbe, 0x01, 0xbe, 0x03, 0xbe, 0x07,
+  0xbe, 0x07, 0xc0, 0x4e, 0x00, 0x10, 0x96, 0x05, 0x10, 0x80, 0x43, 0x05,
+  0x80, 0x40, 0x05, 0x9c, 0x28, 0x96, 0x02, 0x28, 0x80, 0x43, 0x02, 0x80,
+  0x40, 0x02, 0x9c, 0x20, 0x96, 0x03, 0x20, 0x80, 0x43, 0x03, 0x80, 0x40,
+  0x03, 0x9c, 0x20, 0x38, 0x95, 0x03, 0x20, 0x80, 0x43, 0x03, 0x80, 0x40,
+  0x03, 0x9c, 0x30, 0x96, 0x01, 0x30, 0x80, 0x43, 0x01, 0x80, 0x40, 0x01,
+  0x9c, 0x20, 0x96, 0x03, 0x20, 0x80, 0x43, 0x03, 0x80, 0x40, 0x03, 0x9d,
+  0x38, 0x95, 0x07, 0x81, 0x43, 0x07, 0x80, 0x40, 0x07, 0xb4, 0x07, 0x81,
+  0x43, 0x07, 0x80, 0x40, 0x07, 0x8e, 0x28, 0x82, 0x28, 0x88, 0x10, 0x82,
+  0x40, 0x10, 0x82, 0x10, 0x84, 0x14, 0x82, 0x40, 0x10, 0x82, 0x10, 0x98,
+  0x10, 0x82, 0x10, 0x88, 0x28, 0x82, 0x40, 0x28, 0x82, 0x28, 0x84, 0x2e,
+  0x82, 0x40, 0x28, 0x82, 0x28, 0x98, 0x18, 0x82, 0x18, 0x88, 0x20, 0x82,
+  0x40, 0x20, 0x82, 0x20, 0x84, 0x26, 0x82, 0x40, 0x20, 0x82, 0x20, 0x98,
+  0x18, 0x82, 0x18, 0x88, 0x20, 0x38, 0x80, 0x38, 0x40, 0x20, 0x38, 0x80,
+  0x38, 0x20, 0x84, 0x22, 0x38, 0x80, 0x38, 0x40, 0x20, 0x38, 0x80, 0x38,
+  0x20, 0x98, 0x08, 0x82, 0x08, 0x88, 0x30, 0x82, 0x40, 0x30, 0x82, 0x30,
+  0x84, 0x34, 0x82, 0x40, 0x30, 0x82, 0x30, 0x98, 0x18, 0x82, 0x18, 0x88,
+  0x20, 0x82, 0x40, 0x20, 0x82, 0x20, 0x84, 0x26, 0x82, 0x40, 0x20, 0x82,
+  0x20, 0x98, 0x38, 0x82, 0x38, 0x89, 0x38, 0x80, 0x38, 0x81, 0x38, 0x80,
+  0x38, 0x85, 0x02, 0x38, 0x80, 0x38, 0x81, 0x38, 0x80, 0x38, 0x99, 0x38,
+  0x82, 0x38, 0x97, 0x04, 0x9f, 0x28, 0x82, 0x28, 0x80, 0x28, 0x88, 0x10,
+  0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x84, 0x02, 0x10, 0x81, 0x10, 0x80,
+  0x10, 0x81, 0x10, 0x05, 0x82, 0x05, 0x80, 0x05, 0x8f, 0x10, 0x82, 0x10,
+  0x80, 0x10, 0x88, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x84, 0x02,
+  0x28, 0x81, 0x28, 0x80, 0x28, 0x81, 0x28, 0x02, 0x82, 0x02, 0x80, 0x02,
+  0x8f, 0x18, 0x82, 0x18, 0x80, 0x18, 0x88, 0x20, 0x81, 0x20, 0x81, 0x20,
+  0x81, 0x20, 0x84, 0x02, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x03,
+  0x82, 0x03, 0x80, 0x03, 0x8f, 0x18, 0x82, 0x18, 0x80, 0x18, 0x88, 0x20,
+  0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0x80, 0x20,
+  0x81, 0x20, 0x03, 0x82, 0x03, 0x80, 0x03, 0x8f, 0x08, 0x82, 0x08, 0x80,
+  0x08, 0x88, 0x30, 0x81, 0x30, 0x81, 0x30, 0x81, 0x30, 0x84, 0x02, 0x30,
+  0x81, 0x30, 0x80, 0x30, 0x81, 0x30, 0x01, 0x82, 0x01, 0x80, 0x01, 0x8f,
+  0x18, 0x82, 0x18, 0x80, 0x18, 0x88, 0x20, 0x81, 0x20, 0x81, 0x20, 0x81,
+  0x20, 0x84, 0x02, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x20, 0x03, 0x82,
+  0x03, 0x80, 0x03, 0x8f, 0x38, 0x82, 0x38, 0x80, 0x38, 0xa1, 0x07, 0x82,
+  0x07, 0x80, 0x07, 0x8f, 0x38, 0x82, 0x38, 0x80, 0x38, 0x97, 0x02, 0x88,
+  0x07, 0x82, 0x07, 0x80, 0x07, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88,
+  0x05, 0x82, 0x05, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88, 0x02, 0x82,
+  0x02, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88, 0x03, 0x82, 0x03, 0xba,
+  0x03, 0x82, 0x03, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88, 0x01, 0x82,
+  0x01, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88, 0x03, 0x82, 0x03, 0xac,
+  0x02, 0x8c, 0x07, 0x82, 0x07, 0xac, 0x06, 0x02, 0x80, 0x40, 0x02, 0x88,
+  0x07, 0x82, 0x07, 0x91, 0x40, 0x28, 0x80, 0x40, 0x28, 0x80, 0x40, 0x28,
+  0x87, 0x04, 0x89, 0x28, 0x80, 0x02, 0xa1, 0x40, 0x10, 0x80, 0x40, 0x10,
+  0x80, 0x40, 0x10, 0x87, 0x06, 0x89, 0x10, 0x80, 0x02, 0xa1, 0x40, 0x18,
+  0x80, 0x40, 0x18, 0x80, 0x40, 0x18, 0x87, 0x06, 0x89, 0x18, 0x80, 0x02,
+  0xa1, 0x40, 0x18, 0x80, 0x40, 0x18, 0x80, 0x40, 0x18, 0x87, 0x02, 0x89,
+  0x18, 0xa3, 0x40, 0x08, 0x80, 0x40, 0x08, 0x80, 0x40, 0x08, 0x87, 0x04,
+  0x89, 0x08, 0x80, 0x02, 0xa1, 0x40, 0x18, 0x80, 0x40, 0x18, 0x80, 0x40,
+  0x18, 0x87, 0x06, 0x89, 0x18, 0x80, 0x02, 0xa1, 0x40, 0x38, 0x80, 0x40,
+  0x38, 0x80, 0x40, 0x38, 0x87, 0x02, 0x89, 0x38, 0xa3, 0x40, 0x38, 0x80,
+  0x40, 0x38, 0x80, 0x40, 0x38, 0x87, 0x04, 0x89, 0x38, 0x80, 0x02, 0xaf,
+  0x06, 0x82, 0x02, 0x87, 0x28, 0x80, 0x07, 0xaf, 0x06, 0x82, 0x02, 0x87,
+  0x10, 0x80, 0x07, 0xaf, 0x06, 0x82, 0x02, 0x87, 0x18, 0x80, 0x07, 0xaf,
+  0x06, 0x8b, 0x18, 0x80, 0x07, 0xaf, 0x06, 0x82, 0x02, 0x87, 0x08, 0x80,
+  0x07, 0xaf, 0x06, 0x82, 0x02, 0x87, 0x18, 0x80, 0x07, 0xaf, 0x06, 0x8b,
+  0x38, 0x80, 0x07, 0xaf, 0x06, 0x82, 0x02, 0x87, 0x38, 0x80, 0x07, 0x9f,
+  0x28, 0x82, 0x28, 0x80, 0x28, 0xb8, 0x10, 0x82, 0x10, 0x80, 0x10, 0xb8,
+  0x18, 0x82, 0x18, 0x80, 0x18, 0xb8, 0x18, 0x82, 0x18, 0x80, 0x18, 0xb8,
+  0x08, 0x82, 0x08, 0x80, 0x08, 0xb8, 0x18, 0x82, 0x18, 0x80, 0x18, 0xb8,
+  0x38, 0x82, 0x38, 0x80, 0x38, 0xb8, 0x38, 0x82, 0x38, 0x80, 0x38, 0xba,
+  0x28, 0x82, 0x28, 0x87, 0x06, 0x84, 0x02, 0x82, 0x41, 0x28, 0x80, 0x28,
+  0x80, 0x40, 0x28, 0xa0, 0x10, 0x82, 0x10, 0x87, 0x06, 0x84, 0x02, 0x82,
+  0x41, 0x10, 0x80, 0x10, 0x80, 0x40, 0x10, 0xa0, 0x18, 0x82, 0x18, 0x87,
+  0x06, 0x84, 0x02, 0x82, 0x41, 0x18, 0x80, 0x18, 0x80, 0x40, 0x18, 0xa0,
+  0x18, 0x82, 0x18, 0x87, 0x04, 0x88, 0x41, 0x18, 0x80, 0x18, 0x80, 0x40,
+  0x18, 0xa0, 0x08, 0x82, 0x08, 0x87, 0x06, 0x84, 0x02, 0x82, 0x41, 0x08,
+  0x80, 0x08, 0x80, 0x40, 0x08, 0xa0, 0x18, 0x82, 0x18, 0x87, 0x06, 0x84,
+  0x02, 0x82, 0x41, 0x18, 0x80, 0x18, 0x80, 0x40, 0x18, 0xa0, 0x38, 0x82,
+  0x38, 0x87, 0x04, 0x88, 0x41, 0x38, 0x80, 0x38, 0x80, 0x40, 0x38, 0xa0,
+  0x38, 0x82, 0x38, 0x87, 0x06, 0x84, 0x02, 0x82, 0x41, 0x38, 0x80, 0x38,
+  0x80, 0x40, 0x38, 0xc2, 0x1e, 0x00, 0xdd, 0x06, 0x00, 0x00, 0x89, 0x45,
+  0x18, 0x8a, 0x28, 0x8c, 0x10, 0x9e, 0x45, 0x18, 0x8a, 0x28, 0x8c, 0x28,
+  0x9e, 0x45, 0x18, 0x8a, 0x28, 0x8c, 0x20, 0x9e, 0x18, 0x41, 0x20, 0x41,
+  0x18, 0x8a, 0x40, 0x38, 0x8a, 0x38, 0x20, 0x9e, 0x45, 0x18, 0x8a, 0x28,
+  0x8c, 0x30, 0x9e, 0x45, 0x18, 0x8a, 0x28, 0x8c, 0x20, 0x9e, 0x18, 0x41,
+  0x20, 0x41, 0x18, 0x8a, 0x40, 0x38, 0x8a, 0x38, 0x9f, 0x45, 0x18, 0x8a,
+  0x28, 0xac, 0x28, 0x40, 0x10, 0x86, 0x05, 0x85, 0x28, 0x82, 0x40, 0x38,
+  0x84, 0x40, 0x38, 0x82, 0x10, 0x9d, 0x28, 0x40, 0x10, 0x86, 0x02, 0x85,
+  0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82, 0x28, 0x9d, 0x28, 0x40,
+  0x10, 0x86, 0x03, 0x85, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82,
+  0x20, 0x9d, 0x20, 0x18, 0x20, 0x40, 0x38, 0x84, 0x03, 0x85, 0x40, 0x38,
+  0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x80, 0x38, 0x20, 0x9d, 0x28, 0x40,
+  0x10, 0x86, 0x01, 0x85, 0x28, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x82,
+  0x30, 0x9d, 0x28, 0x40, 0x10, 0x86, 0x03, 0x85, 0x28, 0x82, 0x40, 0x38,
+  0x84, 0x40, 0x38, 0x82, 0x20, 0x9d, 0x28, 0x10, 0x28, 0x40, 0x38, 0x84,
+  0x07, 0x85, 0x40, 0x38, 0x82, 0x40, 0x38, 0x84, 0x40, 0x38, 0x80, 0x38,
+  0x9e, 0x28, 0x40, 0x10, 0x86, 0x07, 0x85, 0x28, 0x82, 0x40, 0x38, 0x84,
+  0x40, 0x38, 0xa3, 0x41, 0x10, 0x84, 0x05, 0x81, 0x05, 0x82, 0x28, 0x8e,
+  0x10, 0x9f, 0x41, 0x10, 0x84, 0x02, 0x81, 0x02, 0x82, 0x28, 0x8e, 0x28,
+  0x9f, 0x41, 0x10, 0x84, 0x03, 0x81, 0x03, 0x82, 0x28, 0x8e, 0x20, 0x9f,
+  0x18, 0x40, 0x20, 0x40, 0x38, 0x82, 0x03, 0x81, 0x03, 0x82, 0x40, 0x38,
+  0x81, 0x38, 0x80, 0x38, 0x83, 0x38, 0x80, 0x38, 0x80, 0x38, 0x20, 0x9f,
+  0x41, 0x10, 0x84, 0x01, 0x81, 0x01, 0x82, 0x28, 0x8e, 0x30, 0x9f, 0x41,
+  0x10, 0x84, 0x03, 0x81, 0x03, 0x82, 0x28, 0x8e, 0x20, 0x9f, 0x10, 0x40,
+  0x28, 0x40, 0x38, 0x82, 0x07, 0x81, 0x07, 0x82, 0x40, 0x38, 0x81, 0x38,
+  0x80, 0x38, 0x83, 0x38, 0x80, 0x38, 0x80, 0x38, 0xa0, 0x41, 0x10, 0x84,
+  0x07, 0x81, 0x07, 0x82, 0x28, 0xae, 0x44, 0x20, 0x80, 0x40, 0x05, 0x80,
+  0x05, 0x81, 0x05, 0x81, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80,
+  0x08, 0x10, 0x9e, 0x44, 0x20, 0x80, 0x40, 0x02, 0x80, 0x02, 0x81, 0x02,
+  0x81, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x28, 0x9e,
+  0x44, 0x20, 0x80, 0x40, 0x03, 0x80, 0x03, 0x81, 0x03, 0x81, 0x28, 0x80,
+  0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x9e, 0x30, 0x40, 0x08,
+  0x41, 0x30, 0x80, 0x40, 0x03, 0x80, 0x03, 0x81, 0x03, 0x81, 0x40, 0x38,
+  0x8c, 0x38, 0x20, 0x9e, 0x44, 0x20, 0x80, 0x40, 0x01, 0x80, 0x01, 0x81,
+  0x01, 0x81, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x30,
+  0x9e, 0x44, 0x20, 0x80, 0x40, 0x03, 0x80, 0x03, 0x81, 0x03, 0x81, 0x28,
+  0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x20, 0x9e, 0x30, 0x40,
+  0x08, 0x41, 0x30, 0x80, 0x40, 0x07, 0x80, 0x07, 0x81, 0x07, 0x81, 0x40,
+  0x38, 0x8c, 0x38, 0x9f, 0x44, 0x20, 0x80, 0x40, 0x07, 0x80, 0x07, 0x81,
+  0x07, 0x81, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x9f,
+  0x42, 0x20, 0x84, 0x05, 0x81, 0x05, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x15, 0x9e, 0x42, 0x20, 0x84, 0x02, 0x81, 0x02,
+  0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x2a, 0x9e,
+  0x42, 0x20, 0x84, 0x03, 0x81, 0x03, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x23, 0x9e, 0x30, 0x40, 0x08, 0x30, 0x84, 0x03,
+  0x81, 0x03, 0x82, 0x40, 0x38, 0x82, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80,
+  0x40, 0x38, 0x81, 0x38, 0x23, 0x9e, 0x42, 0x20, 0x84, 0x01, 0x81, 0x01,
+  0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x31, 0x9e,
+  0x42, 0x20, 0x84, 0x03, 0x81, 0x03, 0x82, 0x28, 0x80, 0x08, 0x80, 0x08,
+  0x87, 0x08, 0x80, 0x08, 0x23, 0x9e, 0x30, 0x40, 0x08, 0x30, 0x84, 0x07,
+  0x81, 0x07, 0x82, 0x40, 0x38, 0x82, 0x40, 0x38, 0x80, 0x40, 0x38, 0x80,
+  0x40, 0x38, 0x81, 0x38, 0x07, 0x9e, 0x42, 0x20, 0x84, 0x07, 0x81, 0x07,
+  0x82, 0x28, 0x80, 0x08, 0x80, 0x08, 0x87, 0x08, 0x80, 0x08, 0x07, 0x9f,
+  0x40, 0x28, 0x81, 0x28, 0x82, 0x05, 0x86, 0x28, 0x8b, 0x05, 0x10, 0x81,
+  0x05, 0x9d, 0x40, 0x20, 0x81, 0x20, 0x82, 0x02, 0x86, 0x28, 0x8b, 0x02,
+  0x28, 0x81, 0x02, 0x9d, 0x40, 0x28, 0x81, 0x28, 0x82, 0x03, 0x86, 0x28,
+  0x8b, 0x03, 0x20, 0x81, 0x03, 0x9d, 0x40, 0x38, 0x81, 0x38, 0x82, 0x03,
+  0x86, 0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80, 0x3b, 0x20, 0x81, 0x03,
+  0x9d, 0x40, 0x28, 0x81, 0x28, 0x82, 0x01, 0x86, 0x28, 0x8b, 0x01, 0x30,
+  0x81, 0x01, 0x9d, 0x40, 0x20, 0x81, 0x20, 0x82, 0x03, 0x86, 0x28, 0x8b,
+  0x03, 0x20, 0x81, 0x03, 0x9d, 0x40, 0x20, 0x81, 0x20, 0x82, 0x07, 0x86,
+  0x40, 0x38, 0x81, 0x38, 0x85, 0x38, 0x80, 0x3f, 0x82, 0x07, 0x9d, 0x40,
+  0x20, 0x81, 0x20, 0x82, 0x07, 0x86, 0x28, 0x8b, 0x07, 0x82, 0x07, 0xa0,
+  0x40, 0x28, 0x8b, 0x18, 0x8a, 0x10, 0xa4, 0x40, 0x20, 0x8b, 0x08, 0x8a,
+  0x28, 0xa4, 0x40, 0x28, 0x8b, 0x08, 0x8a, 0x20, 0xa4, 0x40, 0x38, 0x8b,
+  0x28, 0x38, 0x88, 0x38, 0x20, 0xa4, 0x40, 0x28, 0x8b, 0x18, 0x8a, 0x30,
+  0xa4, 0x40, 0x20, 0x8b, 0x08, 0x8a, 0x20, 0xa4, 0x40, 0x20, 0x8b, 0x28,
+  0x38, 0x88, 0x38, 0xa5, 0x40, 0x20, 0x8b, 0x18, 0xaf, 0x40, 0x10, 0x8b,
+  0x07, 0x8a, 0x15, 0x10, 0x83, 0x05, 0x9e, 0x40, 0x28, 0x8b, 0x07, 0x8a,
+  0x2a, 0x28, 0x83, 0x02, 0x9e, 0x40, 0x20, 0x8b, 0x07, 0x8a, 0x23, 0x20,
+  0x83, 0x03, 0x9e, 0x20, 0x18, 0x38, 0x80, 0x38, 0x88, 0x07, 0x8a, 0x23,
+  0x20, 0x83, 0x03, 0x9e, 0x40, 0x30, 0x8b, 0x07, 0x8a, 0x31, 0x30, 0x83,
+  0x01, 0x9e, 0x40, 0x20, 0x8b, 0x07, 0x8a, 0x23, 0x20, 0x83, 0x03, 0x9f,
+  0x40, 0x38, 0x80, 0x38, 0x88, 0x07, 0x8a, 0x07, 0x84, 0x07, 0xac, 0x07,
+  0x8a, 0x07, 0x84, 0x07, 0x92, 0x28, 0x8a, 0x40, 0x10, 0x81, 0x10, 0x80,
+  0x10, 0x81, 0x40, 0x10, 0x82, 0x04, 0x40, 0x10, 0x04, 0x80, 0x10, 0x80,
+  0x10, 0x07, 0x80, 0x40, 0x10, 0x99, 0x10, 0x8a, 0x40, 0x28, 0x81, 0x28,
+  0x80, 0x28, 0x81, 0x40, 0x28, 0x82, 0x06, 0x40, 0x28, 0x06, 0x80, 0x28,
+  0x80, 0x28, 0x07, 0x80, 0x40, 0x28, 0x99, 0x18, 0x8a, 0x40, 0x20, 0x81,
+  0x20, 0x80, 0x20, 0x81, 0x40, 0x20, 0x82, 0x06, 0x40, 0x20, 0x06, 0x80,
+  0x20, 0x80, 0x20, 0x07, 0x80, 0x40, 0x20, 0x99, 0x18, 0x8a, 0x20, 0x18,
+  0x40, 0x38, 0x18, 0x80, 0x18, 0x40, 0x38, 0x18, 0x20, 0x82, 0x02, 0x20,
+  0x18, 0x3a, 0x38, 0x18, 0x80, 0x18, 0x3f, 0x38, 0x18, 0x20, 0x99, 0x08,
+  0x8a, 0x40, 0x30, 0x81, 0x30, 0x80, 0x30, 0x81, 0x40, 0x30, 0x82, 0x04,
+  0x40, 0x30, 0x04, 0x80, 0x30, 0x80, 0x30, 0x07, 0x80, 0x40, 0x30, 0x99,
+  0x18, 0x8a, 0x40, 0x20, 0x81, 0x20, 0x80, 0x20, 0x81, 0x40, 0x20, 0x82,
+  0x06, 0x40, 0x20, 0x06, 0x80, 0x20, 0x80, 0x20, 0x07, 0x80, 0x40, 0x20,
+  0x99, 0x38, 0x8b, 0x42, 0x38, 0x80, 0x42, 0x38, 0x83, 0x02, 0x80, 0x38,
+  0x3a, 0x40, 0x38, 0x80, 0x38, 0x3f, 0x40, 0x38, 0x9a, 0x38, 0x98, 0x04,
+  0x81, 0x04, 0x83, 0x07, 0x9a, 0x28, 0x82, 0x28, 0x88, 0x40, 0x10, 0x80,
+  0x40, 0x10, 0x80, 0x40, 0x10, 0x80, 0x40, 0x10, 0x84, 0x10, 0x12, 0x80,
+  0x42, 0x10, 0x80, 0x40, 0x10, 0x80, 0x05, 0x82, 0x05, 0x91, 0x10, 0x82,
+  0x10, 0x88, 0x40, 0x28, 0x80, 0x40, 0x28, 0x80, 0x40, 0x28, 0x80, 0x40,
+  0x28, 0x84, 0x28, 0x2a, 0x80, 0x42, 0x28, 0x80, 0x40, 0x28, 0x80, 0x02,
+  0x82, 0x02, 0x91, 0x18, 0x82, 0x18, 0x88, 0x40, 0x20, 0x80, 0x40, 0x20,
+  0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x84, 0x20, 0x22, 0x80, 0x42, 0x20,
+  0x80, 0x40, 0x20, 0x80, 0x03, 0x82, 0x03, 0x91, 0x18, 0x82, 0x18, 0x88,
+  0x40, 0x20, 0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x84,
+  0x40, 0x20, 0x80, 0x42, 0x20, 0x80, 0x40, 0x20, 0x80, 0x03, 0x82, 0x03,
+  0x91, 0x08, 0x82, 0x08, 0x88, 0x40, 0x30, 0x80, 0x40, 0x30, 0x80, 0x40,
+  0x30, 0x80, 0x40, 0x30, 0x84, 0x30, 0x32, 0x80, 0x42, 0x30, 0x80, 0x40,
+  0x30, 0x80, 0x01, 0x82, 0x01, 0x91, 0x18, 0x82, 0x18, 0x88, 0x40, 0x20,
+  0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x84, 0x20, 0x22,
+  0x80, 0x42, 0x20, 0x80, 0x40, 0x20, 0x80, 0x03, 0x82, 0x03, 0x91, 0x38,
+  0x82, 0x38, 0xa3, 0x07, 0x82, 0x07, 0x91, 0x38, 0x82, 0x38, 0x99, 0x02,
+  0x88, 0x07, 0x82, 0x07, 0xaa, 0x02, 0x06, 0x80, 0x02, 0x06, 0x80, 0x41,
+  0x02, 0x88, 0x05, 0xac, 0x02, 0x06, 0x80, 0x02, 0x06, 0x80, 0x41, 0x02,
+  0x88, 0x02, 0xac, 0x02, 0x06, 0x80, 0x02, 0x06, 0x80, 0x41, 0x02, 0x88,
+  0x03, 0xbe, 0x03, 0xac, 0x02, 0x06, 0x80, 0x02, 0x06, 0x80, 0x41, 0x02,
+  0x88, 0x01, 0xac, 0x02, 0x06, 0x80, 0x02, 0x06, 0x80, 0x41, 0x02, 0x88,
+  0x03, 0xad, 0x02, 0x81, 0x02, 0x8c, 0x07, 0xac, 0x02, 0x06, 0x80, 0x02,
+  0x06, 0x80, 0x41, 0x02, 0x88, 0x07, 0x98, 0x28, 0x92, 0x28, 0x82, 0x28,
+  0x80, 0x02, 0xa4, 0x10, 0x92, 0x10, 0x82, 0x10, 0x80, 0x02, 0xa4, 0x18,
+  0x92, 0x18, 0x82, 0x18, 0x80, 0x02, 0xa4, 0x18, 0x92, 0x18, 0x82, 0x18,
+  0xa6, 0x08, 0x92, 0x08, 0x82, 0x08, 0x80, 0x02, 0xa4, 0x18, 0x92, 0x18,
+  0x82, 0x18, 0x80, 0x02, 0xa4, 0x38, 0x92, 0x38, 0x82, 0x38, 0xa6, 0x38,
+  0x92, 0x38, 0x82, 0x38, 0x80, 0x02, 0xb6, 0x28, 0x82, 0x28, 0x02, 0x2d,
+  0x80, 0x02, 0x86, 0x02, 0x80, 0x02, 0xac, 0x10, 0x82, 0x10, 0x02, 0x15,
+  0x80, 0x02, 0x86, 0x05, 0x80, 0x05, 0xac, 0x18, 0x82, 0x18, 0x02, 0x1d,
+  0x80, 0x02, 0x86, 0x04, 0x80, 0x04, 0xac, 0x18, 0x82, 0x18, 0x80, 0x1f,
+  0x88, 0x04, 0x80, 0x04, 0xac, 0x08, 0x82, 0x08, 0x02, 0x0d, 0x80, 0x02,
+  0x86, 0x06, 0x80, 0x06, 0xac, 0x18, 0x82, 0x18, 0x02, 0x1d, 0x80, 0x02,
+  0x86, 0x04, 0x80, 0x04, 0xac, 0x38, 0x82, 0x38, 0x80, 0x3f, 0xb8, 0x38,
+  0x82, 0x38, 0x02, 0x3d, 0x80, 0x02, 0x9f, 0x28, 0x82, 0x28, 0x96, 0x02,
+  0x82, 0x05, 0x84, 0x02, 0x82, 0x02, 0x94, 0x10, 0x82, 0x10, 0x96, 0x02,
+  0x82, 0x05, 0x84, 0x05, 0x82, 0x05, 0x94, 0x18, 0x82, 0x18, 0x96, 0x02,
+  0x82, 0x05, 0x84, 0x04, 0x82, 0x04, 0x94, 0x18, 0x82, 0x18, 0x97, 0x07,
+  0x80, 0x40, 0x07, 0x84, 0x04, 0x07, 0x80, 0x07, 0x04, 0x94, 0x08, 0x82,
+  0x08, 0x96, 0x02, 0x82, 0x05, 0x84, 0x06, 0x82, 0x06, 0x94, 0x18, 0x82,
+  0x18, 0x96, 0x02, 0x82, 0x05, 0x84, 0x04, 0x82, 0x04, 0x94, 0x38, 0x82,
+  0x38, 0x97, 0x07, 0x80, 0x40, 0x07, 0x85, 0x07, 0x80, 0x07, 0x95, 0x38,
+  0x82, 0x38, 0x96, 0x02, 0x82, 0x05, 0xa0, 0x28, 0x92, 0x28, 0x81, 0x41,
+  0x28, 0x2d, 0x28, 0x80, 0x40, 0x28, 0x05, 0x87, 0x02, 0x96, 0x10, 0x92,
+  0x10, 0x81, 0x41, 0x10, 0x15, 0x10, 0x80, 0x40, 0x10, 0x05, 0x87, 0x05,
+  0x96, 0x18, 0x92, 0x18, 0x81, 0x41, 0x18, 0x1d, 0x18, 0x80, 0x40, 0x18,
+  0x05, 0x87, 0x04, 0x96, 0x18, 0x92, 0x18, 0x81, 0x41, 0x18, 0x40, 0x1f,
+  0x80, 0x18, 0x1f, 0x07, 0x83, 0x07, 0x81, 0x07, 0x04, 0x96, 0x08, 0x92,
+  0x08, 0x81, 0x41, 0x08, 0x0d, 0x08, 0x80, 0x40, 0x08, 0x05, 0x87, 0x06,
+  0x96, 0x18, 0x92, 0x18, 0x81, 0x41, 0x18, 0x1d, 0x18, 0x80, 0x40, 0x18,
+  0x05, 0x87, 0x04, 0x96, 0x38, 0x92, 0x38, 0x81, 0x41, 0x38, 0x40, 0x3f,
+  0x80, 0x38, 0x3f, 0x07, 0x83, 0x07, 0x81, 0x07, 0x97, 0x38, 0x92, 0x38,
+  0x81, 0x41, 0x38, 0x3d, 0x38, 0x80, 0x40, 0x38, 0x05, 0xa8, 0x42, 0x03,
+  0x8c, 0x05, 0x8c, 0x02, 0x9f, 0x42, 0x03, 0x8c, 0x05, 0x8c, 0x05, 0x9f,
+  0x42, 0x03, 0x8c, 0x05, 0x8c, 0x04, 0x9f, 0x42, 0x03, 0x8c, 0x40, 0x07,
+  0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x04, 0x9f, 0x42, 0x03, 0x8c, 0x05,
+  0x8c, 0x06, 0x9f, 0x42, 0x03, 0x8c, 0x05, 0x8c, 0x04, 0x9f, 0x42, 0x03,
+  0x8c, 0x40, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0xa0, 0x42, 0x03,
+  0x8c, 0x05, 0xa2, 0xbc, 0x04, 0x00, 0x00, 0x85, 0x28, 0x82, 0x18, 0x84,
+  0x05, 0x89, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x10, 0x9a, 0x28, 0x82,
+  0x18, 0x84, 0x02, 0x89, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x28, 0x9a,
+  0x28, 0x82, 0x18, 0x84, 0x03, 0x89, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82,
+  0x20, 0x9a, 0x20, 0x82, 0x18, 0x38, 0x83, 0x03, 0x89, 0x40, 0x38, 0x82,
+  0x38, 0x85, 0x38, 0x80, 0x38, 0x20, 0x9a, 0x28, 0x82, 0x18, 0x84, 0x01,
+  0x89, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x30, 0x9a, 0x28, 0x82, 0x18,
+  0x84, 0x03, 0x89, 0x28, 0x82, 0x38, 0x85, 0x38, 0x82, 0x20, 0x9a, 0x28,
+  0x82, 0x18, 0x38, 0x83, 0x07, 0x89, 0x40, 0x38, 0x82, 0x38, 0x85, 0x38,
+  0x80, 0x38, 0x9b, 0x28, 0x82, 0x18, 0x84, 0x07, 0x89, 0x28, 0x82, 0x38,
+  0x85, 0x38, 0x9d, 0x28, 0x80, 0x28, 0x81, 0x28, 0x10, 0x83, 0x05, 0x82,
+  0x05, 0x89, 0x38, 0x85, 0x38, 0x9d, 0x28, 0x80, 0x28, 0x81, 0x28, 0x10,
+  0x83, 0x02, 0x82, 0x02, 0x89, 0x38, 0x85, 0x38, 0x9d, 0x28, 0x80, 0x28,
+  0x81, 0x28, 0x10, 0x83, 0x03, 0x82, 0x03, 0x89, 0x38, 0x85, 0x38, 0x9d,
+  0x20, 0x80, 0x20, 0x81, 0x20, 0x18, 0x38, 0x82, 0x03, 0x82, 0x03, 0x89,
+  0x38, 0x85, 0x38, 0x9d, 0x28, 0x80, 0x28, 0x81, 0x28, 0x10, 0x83, 0x01,
+  0x82, 0x01, 0x89, 0x38, 0x85, 0x38, 0x9d, 0x28, 0x80, 0x28, 0x81, 0x28,
+  0x10, 0x83, 0x03, 0x82, 0x03, 0x89, 0x38, 0x85, 0x38, 0x9d, 0x28, 0x80,
+  0x28, 0x81, 0x28, 0x10, 0x38, 0x82, 0x07, 0x82, 0x07, 0x89, 0x38, 0x85,
+  0x38, 0x9d, 0x28, 0x80, 0x28, 0x81, 0x28, 0x10, 0x83, 0x07, 0x82, 0x07,
+  0x89, 0x38, 0x85, 0x38, 0x9e, 0x18, 0x8c, 0x05, 0x87, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0x9b, 0x18, 0x8c, 0x02, 0x87, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0x9b, 0x18, 0x8c, 0x03, 0x87, 0x40, 0x08, 0x88, 0x40, 0x08, 0x9b, 0x08,
+  0x8c, 0x03, 0x89, 0x40, 0x38, 0x84, 0x40, 0x38, 0x9d, 0x18, 0x8c, 0x01,
+  0x87, 0x40, 0x08, 0x88, 0x40, 0x08, 0x9b, 0x18, 0x8c, 0x03, 0x87, 0x40,
+  0x08, 0x88, 0x40, 0x08, 0x9b, 0x08, 0x8c, 0x07, 0x89, 0x40, 0x38, 0x84,
+  0x40, 0x38, 0x9d, 0x18, 0x8c, 0x07, 0x87, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0xa2, 0x40, 0x05, 0x80, 0x05, 0x83, 0x40, 0x05, 0xb5, 0x40, 0x02, 0x80,
+  0x02, 0x83, 0x40, 0x02, 0xb5, 0x40, 0x03, 0x80, 0x03, 0x83, 0x40, 0x03,
+  0xb5, 0x40, 0x03, 0x80, 0x03, 0x83, 0x40, 0x03, 0x88, 0x38, 0x81, 0x38,
+  0x81, 0x38, 0xa5, 0x40, 0x01, 0x80, 0x01, 0x83, 0x40, 0x01, 0xb5, 0x40,
+  0x03, 0x80, 0x03, 0x83, 0x40, 0x03, 0xb5, 0x40, 0x07, 0x80, 0x07, 0x83,
+  0x40, 0x07, 0x88, 0x38, 0x81, 0x38, 0x81, 0x38, 0xa5, 0x40, 0x07, 0x80,
+  0x07, 0x83, 0x40, 0x07, 0xbc, 0x05, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88,
+  0x40, 0x08, 0x10, 0xa8, 0x02, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x28, 0xa8, 0x03, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0x20, 0xa8, 0x03, 0x85, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x82, 0x38, 0x20, 0xa8, 0x01, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40,
+  0x08, 0x30, 0xa8, 0x03, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0x20, 0xa8, 0x07, 0x85, 0x40, 0x38, 0x83, 0x40, 0x38, 0x80, 0x40, 0x38,
+  0x82, 0x38, 0xa9, 0x07, 0x85, 0x28, 0x80, 0x40, 0x08, 0x88, 0x40, 0x08,
+  0xa5, 0x05, 0x82, 0x05, 0x86, 0x28, 0x8b, 0x10, 0xa5, 0x02, 0x82, 0x02,
+  0x86, 0x28, 0x8b, 0x28, 0xa5, 0x03, 0x82, 0x03, 0x86, 0x28, 0x8b, 0x20,
+  0xa5, 0x03, 0x82, 0x03, 0x86, 0x40, 0x38, 0x81, 0x45, 0x38, 0x80, 0x38,
+  0x20, 0xa5, 0x01, 0x82, 0x01, 0x86, 0x28, 0x8b, 0x30, 0xa5, 0x03, 0x82,
+  0x03, 0x86, 0x28, 0x8b, 0x20, 0xa5, 0x07, 0x82, 0x07, 0x86, 0x40, 0x38,
+  0x81, 0x45, 0x38, 0x80, 0x38, 0xa6, 0x07, 0x82, 0x07, 0x86, 0x28, 0xa7,
+  0x05, 0x89, 0x05, 0x8b, 0x18, 0x89, 0x10, 0x9b, 0x02, 0x89, 0x02, 0x8b,
+  0x08, 0x89, 0x28, 0x9b, 0x03, 0x89, 0x03, 0x8b, 0x08, 0x89, 0x20, 0x9b,
+  0x03, 0x89, 0x3b, 0x8b, 0x28, 0x48, 0x38, 0x20, 0x9b, 0x01, 0x89, 0x01,
+  0x8b, 0x18, 0x89, 0x30, 0x9b, 0x03, 0x89, 0x03, 0x8b, 0x08, 0x89, 0x20,
+  0x9b, 0x07, 0x89, 0x3f, 0x8b, 0x28, 0x48, 0x38, 0x9c, 0x07, 0x89, 0x07,
+  0x8b, 0x18, 0xb9, 0x07, 0x82, 0x07, 0x82, 0x07, 0x84, 0x40, 0x10, 0xaf,
+  0x07, 0x82, 0x07, 0x82, 0x07, 0x84, 0x40, 0x28, 0xaf, 0x07, 0x82, 0x07,
+  0x82, 0x07, 0x84, 0x40, 0x20, 0xaf, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82,
+  0x38, 0x80, 0x40, 0x20, 0xaf, 0x07, 0x82, 0x07, 0x82, 0x07, 0x84, 0x40,
+  0x30, 0xaf, 0x07, 0x82, 0x07, 0x82, 0x07, 0x84, 0x40, 0x20, 0xaf, 0x07,
+  0x82, 0x07, 0x82, 0x07, 0x82, 0x38, 0xb2, 0x07, 0x82, 0x07, 0x82, 0x07,
+  0xb4, 0x04, 0x82, 0x04, 0x80, 0x04, 0x81, 0x04, 0x80, 0x04, 0x81, 0x07,
+  0xb0, 0x06, 0x82, 0x06, 0x80, 0x06, 0x81, 0x06, 0x80, 0x06, 0x81, 0x07,
+  0xb0, 0x06, 0x82, 0x06, 0x80, 0x06, 0x81, 0x06, 0x80, 0x06, 0x81, 0x07,
+  0xb0, 0x02, 0x82, 0x02, 0x80, 0x02, 0x81, 0x02, 0x80, 0x02, 0x81, 0x07,
+  0xb0, 0x04, 0x82, 0x04, 0x80, 0x04, 0x81, 0x04, 0x80, 0x04, 0x81, 0x07,
+  0xb0, 0x06, 0x82, 0x06, 0x80, 0x06, 0x81, 0x06, 0x80, 0x06, 0x81, 0x07,
+  0xb0, 0x02, 0x82, 0x02, 0x80, 0x02, 0x81, 0x02, 0x80, 0x02, 0x81, 0x07,
+  0xb0, 0x04, 0x82, 0x04, 0x80, 0x04, 0x81, 0x04, 0x80, 0x04, 0x81, 0x07,
+  0xad, 0x10, 0x81, 0x10, 0x85, 0x10, 0x81, 0x12, 0xb1, 0x28, 0x81, 0x28,
+  0x85, 0x28, 0x81, 0x2a, 0xb1, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x22,
+  0xb1, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x20, 0xb1, 0x30, 0x81, 0x30,
+  0x85, 0x30, 0x81, 0x32, 0xb1, 0x20, 0x81, 0x20, 0x85, 0x20, 0x81, 0x22,
+  0xc0, 0x7e, 0x00, 0x02, 0xb3, 0x02, 0x82, 0x02, 0x06, 0x40, 0x02, 0x80,
+  0x40, 0x02, 0xb4, 0x02, 0x82, 0x02, 0x06, 0x40, 0x02, 0x80, 0x40, 0x02,
+  0xb4, 0x02, 0x82, 0x02, 0x06, 0x40, 0x02, 0x80, 0x40, 0x02, 0xc0, 0x74,
+  0x00, 0x02, 0x82, 0x02, 0x06, 0x40, 0x02, 0x80, 0x40, 0x02, 0xb4, 0x02,
+  0x82, 0x02, 0x06, 0x40, 0x02, 0x80, 0x40, 0x02, 0xb9, 0x02, 0xb9, 0x02,
+  0x82, 0x02, 0x06, 0x40, 0x02, 0x80, 0x40, 0x02, 0xb8, 0x28, 0x82, 0x40,
+  0x05, 0x87, 0x40, 0x02, 0xaf, 0x10, 0x82, 0x40, 0x05, 0x87, 0x40, 0x05,
+  0xaf, 0x18, 0x82, 0x40, 0x05, 0x87, 0x40, 0x04, 0xaf, 0x18, 0x82, 0x40,
+  0x07, 0x87, 0x40, 0x04, 0xaf, 0x08, 0x82, 0x40, 0x05, 0x87, 0x40, 0x06,
+  0xaf, 0x18, 0x82, 0x40, 0x05, 0x87, 0x40, 0x04, 0xaf, 0x38, 0x82, 0x40,
+  0x07, 0xb9, 0x38, 0x82, 0x40, 0x05, 0xb6, 0x02, 0x28, 0x81, 0x02, 0x28,
+  0x07, 0x81, 0x05, 0x85, 0x02, 0x81, 0x02, 0xab, 0x02, 0x10, 0x81, 0x02,
+  0x10, 0x07, 0x81, 0x05, 0x85, 0x05, 0x81, 0x05, 0xab, 0x02, 0x18, 0x81,
+  0x02, 0x18, 0x07, 0x81, 0x05, 0x85, 0x04, 0x81, 0x04, 0xac, 0x18, 0x82,
+  0x18, 0x42, 0x07, 0x85, 0x04, 0x40, 0x07, 0x04, 0xab, 0x02, 0x08, 0x81,
+  0x02, 0x08, 0x07, 0x81, 0x05, 0x85, 0x06, 0x81, 0x06, 0xab, 0x02, 0x18,
+  0x81, 0x02, 0x18, 0x07, 0x81, 0x05, 0x85, 0x04, 0x81, 0x04, 0xac, 0x38,
+  0x82, 0x38, 0x42, 0x07, 0x86, 0x40, 0x07, 0xac, 0x02, 0x38, 0x81, 0x02,
+  0x38, 0x07, 0x81, 0x05, 0xb7, 0x02, 0x82, 0x07, 0x82, 0x05, 0xb6, 0x02,
+  0x82, 0x07, 0x82, 0x05, 0xb6, 0x02, 0x82, 0x07, 0x82, 0x05, 0xba, 0x07,
+  0x81, 0x40, 0x07, 0x84, 0x07, 0xb0, 0x02, 0x82, 0x07, 0x82, 0x05, 0xb6,
+  0x02, 0x82, 0x07, 0x82, 0x05, 0xba, 0x07, 0x81, 0x40, 0x07, 0x84, 0x07,
+  0xb0, 0x02, 0x82, 0x07, 0x82, 0x05, 0xaa, 0x40, 0x01, 0x87, 0x28, 0x84,
+  0x28, 0x83, 0x41, 0x05, 0x03, 0xa6, 0x40, 0x01, 0x87, 0x10, 0x84, 0x10,
+  0x83, 0x41, 0x05, 0x01, 0xa6, 0x40, 0x01, 0x87, 0x18, 0x84, 0x18, 0x83,
+  0x41, 0x05, 0x01, 0xa6, 0x40, 0x03, 0x87, 0x18, 0x84, 0x18, 0x82, 0x42,
+  0x07, 0x05, 0x07, 0xa5, 0x40, 0x01, 0x87, 0x08, 0x84, 0x08, 0x83, 0x41,
+  0x05, 0x03, 0xa6, 0x40, 0x01, 0x87, 0x18, 0x84, 0x18, 0x83, 0x41, 0x05,
+  0x01, 0xa6, 0x40, 0x03, 0x87, 0x38, 0x84, 0x38, 0x82, 0x42, 0x07, 0x05,
+  0x07, 0xa5, 0x40, 0x01, 0x87, 0x38, 0x84, 0x38, 0x83, 0x41, 0x05, 0x03,
+  0xc0, 0xe6, 0x00, 0x40, 0x07, 0x92, 0x42, 0x07, 0xc0, 0xa6, 0x00, 0x40,
+  0x07, 0x92, 0x42, 0x07, 0xc0, 0x5a, 0x00
+};
+const uint8_t *get_nyan_64x32_anim(uint32_t *size) { *size = sizeof(myanim); return myanim; }
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+#Simple and stupid script to (re)generate the pre-encoded animation data (see leddisplay_anim.h).
+#Needs an Unix-ish environment with ImageMagick, xxd and gcc installed. The encoder must be built
+#for the same display configuration as the firmware, which can be passed in the CONFIG variable
+#(see ../../leddisplay_host/README.md), e.g.:
+#  CONFIG="-DCONFIG_LEDDISPLAY_COLOR_DEPTH=5" ./nyan_64x32_anim.sh
+
+set -e
+
+HOST=../../leddisplay_host
+make -s -C $HOST clean
+make -s -C $HOST CONFIG="$CONFIG"
+
+convert nyan_64x32.gif nyan_64x32-f%02d.rgb
+cat nyan_64x32-f*.rgb | $HOST/leddisplay_host anim 100 > nyan_64x32.lda
+
+OUTF="nyan_64x32_anim.c"
+
+echo '// Auto-generated' > $OUTF
+echo '#include <sdkconfig.h>' >> $OUTF
+echo '#include "nyan_64x32.h"' >> $OUTF
+echo 'static const unsigned char myanim[]={' >> $OUTF
+xxd -i < nyan_64x32.lda >> $OUTF
+echo "};" >> $OUTF
+
+echo 'const uint8_t *get_nyan_64x32_anim(uint32_t *size) { *size = sizeof(myanim); return myanim; }' >> $OUTF
+rm -f *.rgb nyan_64x32.lda
+make -s -C $HOST clean
@@ -588,6 +588,34 @@ static void sLeddisplayTestTask(void *pParam)
         }
 
 
+        /* ***** direct ************************************************************************* */
+
+        INFO("moving stripes (direct)");
+        {
+            int n = 200;
+            while (n--)
+            {
+                leddisplay_direct_t direct;
+                leddisplay_direct_get(&direct);
+                for (int row = 0; row < direct.num_rows; row++)
+                {
+                    for (int bitplane = 0; bitplane < direct.num_bitplanes; bitplane++)
+                    {
+                        const uint8_t *ctrl = &direct.ctrl[bitplane * direct.num_words];
+                        for (int x = 0; x < direct.num_words; x++)
+                        {
+                            // red stripes in the top half, blue in the bottom half (full brightness)
+                            const uint8_t rgb = ((x + n) & 0x08) ? LEDDISPLAY_DIRECT_R1 : LEDDISPLAY_DIRECT_B2;
+                            *leddisplay_direct_lo(&direct, row, bitplane, x) = ctrl[x] | rgb;
+                        }
+                    }
+                }
+                leddisplay_direct_update(1);
+                osSleep(delay / 10);
+            }
+        }
+
+
         /* ***** other ************************************************************************** */
 
         INFO("test frame refresh rate");
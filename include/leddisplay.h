@@ -41,25 +41,37 @@
 
 // configuration (see also leddisplay.c)
 #if CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN || CONFIG_LEDDISPLAY_TYPE_32X16_8SCAN
-#  define LEDDISPLAY_WIDTH                32
-#  define LEDDISPLAY_HEIGHT               16
+#  define LEDDISPLAY_PANEL_WIDTH          32
+#  define LEDDISPLAY_PANEL_HEIGHT         16
 
 #elif CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN || CONFIG_LEDDISPLAY_TYPE_32X32_16SCAN
-#  define LEDDISPLAY_WIDTH                32
-#  define LEDDISPLAY_HEIGHT               32
+#  define LEDDISPLAY_PANEL_WIDTH          32
+#  define LEDDISPLAY_PANEL_HEIGHT         32
 
 #elif CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN || CONFIG_LEDDISPLAY_TYPE_64X32_16SCAN
-#  define LEDDISPLAY_WIDTH                64
-#  define LEDDISPLAY_HEIGHT               32
+#  define LEDDISPLAY_PANEL_WIDTH          64
+#  define LEDDISPLAY_PANEL_HEIGHT         32
 
 #elif CONFIG_LEDDISPLAY_TYPE_64X64_32SCAN
-#  define LEDDISPLAY_WIDTH                64
-#  define LEDDISPLAY_HEIGHT               64
+#  define LEDDISPLAY_PANEL_WIDTH          64
+#  define LEDDISPLAY_PANEL_HEIGHT         64
 
 #else
 #  error This CONFIG_LEDDISPLAY_TYPE is not implemented!
 #endif
 
+// chained panels (see Kconfig)
+#define LEDDISPLAY_CHAIN_LENGTH           CONFIG_LEDDISPLAY_CHAIN_LENGTH
+#define LEDDISPLAY_CHAIN_ROWS             CONFIG_LEDDISPLAY_CHAIN_ROWS
+#define LEDDISPLAY_CHAIN_COLS             (LEDDISPLAY_CHAIN_LENGTH / LEDDISPLAY_CHAIN_ROWS)
+#if (LEDDISPLAY_CHAIN_COLS * LEDDISPLAY_CHAIN_ROWS) != LEDDISPLAY_CHAIN_LENGTH
+#  error CONFIG_LEDDISPLAY_CHAIN_LENGTH must be a multiple of CONFIG_LEDDISPLAY_CHAIN_ROWS!
+#endif
+
+// the display (canvas), i.e. all panels of the chain, the coordinates used in the API
+#define LEDDISPLAY_WIDTH                  (LEDDISPLAY_PANEL_WIDTH * LEDDISPLAY_CHAIN_COLS)
+#define LEDDISPLAY_HEIGHT                 (LEDDISPLAY_PANEL_HEIGHT * LEDDISPLAY_CHAIN_ROWS)
+
 /* *********************************************************************************************** */
 /*!
     \name display functions
@@ -78,15 +90,68 @@
 /*!
     Call this before calling any other leddisplay_*() function.
 
-    \returns #ESP_OK on success, or on error: #ESP_ERR_NO_MEM, #ESP_FAIL
+    \returns #ESP_OK on success, or on error: #ESP_ERR_NO_MEM, #ESP_ERR_INVALID_ARG (GPIOs not
+             configured), #ESP_FAIL
 */
 esp_err_t leddisplay_init(void);
 
 //! shutdown the LED display
 void leddisplay_shutdown(void);
 
+//! suspend the display refresh
+/*!
+    This stops the DMA (and all that depends on it, such as the refresh interrupt) and keeps the
+    display dark, but unlike leddisplay_shutdown() keeps all memory allocated, so that
+    leddisplay_resume() takes only a few register writes. The drawing functions can still be used,
+    the last updated frame is displayed on resume. There are no refreshes while the display is
+    suspended, i.e. leddisplay_wait_vsync() and leddisplay_wait_present() wait until it is resumed
+    (or time out).
+
+    \returns ESP_OK on success, ESP_ERR_INVALID_STATE if the display is suspended already
+*/
+esp_err_t leddisplay_suspend(void);
+
+//! resume the display refresh
+/*!
+    This restarts the DMA with the front buffer (i.e. the last frame updated), which is displayed
+    right away.
+
+    \returns ESP_OK on success, ESP_ERR_INVALID_STATE if the display is not suspended
+*/
+esp_err_t leddisplay_resume(void);
+
+//! low-power mode
+/*!
+    This divides the I2S clock by the largest factor that keeps the refresh rate at or above
+    #CONFIG_LEDDISPLAY_LOW_POWER_REFRESH (or by what the I2S clock divider allows), which cuts the
+    DMA memory bus load, the interrupt load and the power of the output drivers by that factor,
+    with the same brightness. It is meant for static content (e.g. a clock at night), as the
+    lower refresh rate may flicker (in particular in camera footage), and updated frames take
+    longer to show (see leddisplay_stats_t.refresh_rate). It can be switched on and off any time
+    (also while the display is suspended), and the display starts with it off.
+
+    \param[in] enable  non-zero to enable the low-power mode, zero to disable it
+    \returns ESP_OK on success, ESP_ERR_NOT_SUPPORTED with the refresh synchronisation (see
+             #CONFIG_LEDDISPLAY_SYNC_MASTER and #CONFIG_LEDDISPLAY_SYNC_SLAVE)
+*/
+esp_err_t leddisplay_set_low_power(int enable);
+
 //! set global brightness level
-/*
+/*!
+    This only changes the control signals (output enable) in the frame buffer memory, which takes
+    a fraction of the time of rendering a frame, and it applies to the displayed frame from the
+    next refresh on (at the latest), also without any updates. This makes it suitable for
+    brightness ramps (fading, dimming). With #CONFIG_LEDDISPLAY_OE_MCPWM this only changes the
+    width of the output enable pulse, which applies from the next latch on.
+
+    \note This can be called from any task, also while another task draws or renders frames (or
+          while the render task does, see leddisplay_frame_submit()). It waits until the drawing
+          function currently running (e.g. leddisplay_pixel_fill_rgb() or the encoding in
+          leddisplay_frame_update()) is done, and these wait while it changes the
+          brightness, so that all frame buffers get the same control signals. The current limit
+          (see leddisplay_set_current_limit()) changes the brightness in the same way while
+          rendering. It must not be called from an ISR.
+
     \param[in] brightness  global brightness level, range 0..100 [%]
     \returns the previously set global brightness level
 */
@@ -98,6 +163,73 @@ int leddisplay_set_brightness(int brightness);
 */
 int leddisplay_get_brightness(void);
 
+//! set current limit
+/*!
+    With #CONFIG_LEDDISPLAY_CURRENT_EST the driver estimates the supply current of each frame
+    (see leddisplay_stats_t.current_ma) while rendering it with the frame based functions (see
+    leddisplay_frame_update()), or when it is updated after using the pixel based, indexed colour
+    or direct functions (see leddisplay_pixel_update()), and reduces the brightness of frames that
+    would need more than the limit. The brightness set by leddisplay_set_brightness() is the maximum (and what
+    leddisplay_get_brightness() returns). The limit applies from the next frame on.
+
+    \param[in] limit_ma  current limit [mA], 0 for no limit (see #CONFIG_LEDDISPLAY_CURRENT_LIMIT_MA)
+    \returns ESP_OK on success, ESP_ERR_INVALID_ARG for a negative limit, ESP_ERR_NOT_SUPPORTED if
+             #CONFIG_LEDDISPLAY_CURRENT_EST is not enabled
+*/
+esp_err_t leddisplay_set_current_limit(int limit_ma);
+
+//! number of bins in the wake-up latency histogram (see #leddisplay_stats_t)
+#define LEDDISPLAY_STATS_LATENCY_BINS 8
+
+//! display driver statistics
+/*!
+    The measured refresh rate and the refresh period minimum and maximum are for the time since
+    the previous call to leddisplay_get_stats() (or leddisplay_init()). All other counters since
+    leddisplay_init().
+*/
+typedef struct leddisplay_stats_s
+{
+    int      refresh_rate;           //!< calculated refresh rate [Hz] (for all panels of the chain, all sub-frames with #CONFIG_LEDDISPLAY_DITHER_FRAMES, lower in the low-power mode, see leddisplay_set_low_power())
+    int      chain_length;           //!< number of panels in the chain
+    int      lsb_msb_transition_bit; //!< chosen LSB/MSB transition bitplane (see leddisplay.c)
+    int      num_frame_buffers;      //!< number of frame buffers
+    int      desc_count;             //!< number of DMA descriptors per frame buffer (refresh)
+    int      desc_shared_count;      //!< number of those that are shared by all frame buffers (see Kconfig)
+    uint32_t frame_buf_bytes;        //!< memory for one frame buffer (pixel data) [bytes] (PSRAM with #CONFIG_LEDDISPLAY_PSRAM_RING, else DMA memory)
+    uint32_t desc_buf_bytes;         //!< DMA memory for one frame buffer's own (not shared) descriptors [bytes]
+    uint32_t dma_total_bytes;        //!< total DMA memory used (all buffers and descriptors) [bytes]
+    int      ring_rows;              //!< number of row buffers in the ring (#CONFIG_LEDDISPLAY_PSRAM_RING), or 0
+    uint32_t ring_underruns;         //!< number of rows output before they were copied into the ring (displayed with wrong content)
+    int      ring_lead_min;          //!< minimum number of rows that were ready in the ring when the DMA started a row (including that one, ring_rows - 1 at best, 0 if it was too late), since the previous call to leddisplay_get_stats()
+    uint32_t frames_submitted;       //!< number of frames updated (flipped to) so far
+    uint32_t frames_dropped;         //!< number of frames replaced by a newer one before they were displayed, or not accepted by leddisplay_frame_submit()
+    uint32_t frames_presented;       //!< number of frames that have been displayed (see leddisplay_set_present_cb())
+    uint32_t present_latency_max;    //!< maximum time from the update to the presentation of a frame [us] (see leddisplay_present_t.latency)
+    uint32_t encode_time_last;       //!< time it took to render the last frame [us]
+    uint32_t encode_time_max;        //!< maximum time it took to render a frame [us]
+    uint64_t blocked_time;           //!< total time spent waiting for a frame buffer to become available [us]
+    uint32_t refresh_count;          //!< number of refreshes (end of frame interrupts)
+    int      refresh_rate_measured;  //!< measured refresh rate [Hz]
+    uint32_t refresh_period_min;     //!< minimum refresh period [us]
+    uint32_t refresh_period_max;     //!< maximum refresh period [us]
+    int      sync_locked;            //!< non-zero if the refresh is in sync with the master (#CONFIG_LEDDISPLAY_SYNC_SLAVE)
+    int32_t  sync_phase_error;       //!< last difference between the start of the refresh and the master's (positive if late) [us]
+    uint32_t sync_phase_error_max;   //!< maximum (absolute) difference since the previous call to leddisplay_get_stats() [us]
+    int      sync_clock_trim;        //!< current I2S clock adjustment (-63..63, see i2s_parallel.h)
+    uint32_t current_ma;             //!< estimated supply current of the last frame rendered or updated [mA] (#CONFIG_LEDDISPLAY_CURRENT_EST)
+    uint32_t current_ma_max;         //!< maximum of that since the previous call to leddisplay_get_stats() [mA]
+    uint32_t current_limited;        //!< number of frames whose brightness was reduced by the current limit (see leddisplay_set_current_limit())
+    //! latency from the end of frame interrupt until a waiting task runs, bin n counts
+    //! latencies < (16 << n) [us], the last bin counts all longer latencies
+    uint32_t wakeup_latency[LEDDISPLAY_STATS_LATENCY_BINS];
+} leddisplay_stats_t;
+
+//! get display driver statistics
+/*!
+    \param[out] p_stats  the statistics
+*/
+void leddisplay_get_stats(leddisplay_stats_t *p_stats);
+
 //@}
 
 /* *********************************************************************************************** */
@@ -105,7 +237,10 @@ int leddisplay_get_brightness(void);
     \name pixel based functions
 
     These functions operate directly on the internal buffers, which is relatively expensive on CPU
-    usage. At 160MHz CPU speed it takes about 20ms to set all pixels on a 64x32 display.
+    usage. At 160MHz CPU speed it takes about 20ms to set all pixels on a 64x32 display using
+    leddisplay_pixel_xy_rgb(). The span functions (leddisplay_pixel_hline_rgb(),
+    leddisplay_pixel_rect_fill_rgb(), leddisplay_pixel_blit()) are much faster per pixel, and should
+    be used wherever more than a few pixels are drawn (e.g. text, boxes, images).
 
     Example:
 
@@ -141,6 +276,97 @@ void leddisplay_pixel_xy_rgb(uint16_t x_coord, uint16_t y_coord, uint8_t red, ui
 */
 void leddisplay_pixel_fill_rgb(uint8_t red, uint8_t green, uint8_t blue);
 
+//! set a horizontal line of pixels to colour
+/*!
+    The part of the line outside of the display is ignored.
+
+    \param[in] x_coord  x coordinate of the leftmost pixel
+    \param[in] y_coord  y coordinate
+    \param[in] width    number of pixels
+    \param[in] red      red value
+    \param[in] green    green value
+    \param[in] blue     blue value
+*/
+void leddisplay_pixel_hline_rgb(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint8_t red, uint8_t green, uint8_t blue);
+
+//! fill a rectangle of pixels with colour
+/*!
+    The part of the rectangle outside of the display is ignored.
+
+    \param[in] x_coord  x coordinate of the top-left pixel
+    \param[in] y_coord  y coordinate of the top-left pixel
+    \param[in] width    width of the rectangle
+    \param[in] height   height of the rectangle
+    \param[in] red      red value
+    \param[in] green    green value
+    \param[in] blue     blue value
+*/
+void leddisplay_pixel_rect_fill_rgb(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    uint8_t red, uint8_t green, uint8_t blue);
+
+//! set a rectangle of pixels from an image
+/*!
+    The part of the image outside of the display is ignored.
+
+    \param[in] x_coord  x coordinate of the top-left pixel
+    \param[in] y_coord  y coordinate of the top-left pixel
+    \param[in] width    width of the image
+    \param[in] height   height of the image
+    \param[in] p_rgb    the image, RGB values (8 bits per colour) of the pixels row by row
+                        (i.e. width x height x 3 bytes)
+*/
+void leddisplay_pixel_blit(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height, const uint8_t *p_rgb);
+
+//! set a rectangle of pixels from a (partial) buffer of a graphics library, RGB888
+/*!
+    This is for the flush (or "draw bitmap") callbacks of graphics libraries that render into
+    partial buffers (e.g. LVGL with a buffer of a few lines). The pixels are rendered directly
+    into the frame buffer memory (no intermediate leddisplay_frame_t), the display is updated
+    using leddisplay_pixel_update() (e.g. when the library has flushed the last area of a frame).
+    Libraries that only flush the changed areas need #CONFIG_LEDDISPLAY_PIXEL_PERSIST.
+
+\code{.c}
+    static void flushCb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *buf)
+    {
+        leddisplay_pixel_flush_rgb565(area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area),
+            (const uint16_t *)buf, 0);
+        if (lv_disp_flush_is_last(drv))
+        {
+            leddisplay_pixel_update(0);
+        }
+        lv_disp_flush_ready(drv);
+    }
+\endcode
+
+    The part of the rectangle outside of the display is ignored.
+
+    \param[in] x_coord  x coordinate of the top-left pixel
+    \param[in] y_coord  y coordinate of the top-left pixel
+    \param[in] width    width of the rectangle
+    \param[in] height   height of the rectangle
+    \param[in] p_rgb    the pixels, RGB values (8 bits per colour), row by row
+    \param[in] stride   the number of pixels from the start of one row to the next in the buffer,
+                        0 for width
+*/
+void leddisplay_pixel_flush_rgb888(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint8_t *p_rgb, uint16_t stride);
+
+//! set a rectangle of pixels from a (partial) buffer of a graphics library, RGB565
+/*!
+    Like leddisplay_pixel_flush_rgb888().
+
+    \param[in] x_coord   x coordinate of the top-left pixel
+    \param[in] y_coord   y coordinate of the top-left pixel
+    \param[in] width     width of the rectangle
+    \param[in] height    height of the rectangle
+    \param[in] p_rgb565  the pixels, RGB565 values (red in the 5 MSBs, native byte order, i.e.
+                         without LV_COLOR_16_SWAP), row by row
+    \param[in] stride    the number of pixels from the start of one row to the next in the buffer,
+                         0 for width
+*/
+void leddisplay_pixel_flush_rgb565(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint16_t *p_rgb565, uint16_t stride);
+
 //! update display with current frame
 /*!
     Flushes the frame to the display.
@@ -148,7 +374,8 @@ void leddisplay_pixel_fill_rgb(uint8_t red, uint8_t green, uint8_t blue);
     \param[in] block   waits for framebuffer to become available again if non-zero
 
     \note After this function returns the frame memory will be invalid and you will have to draw the
-          next frame fully from scratch.
+          next frame fully from scratch. With #CONFIG_LEDDISPLAY_PIXEL_PERSIST the next frame
+          starts as a copy of the updated one instead, so that only the changes need drawing.
 */
 void leddisplay_pixel_update(int block);
 
@@ -228,6 +455,517 @@ void leddisplay_frame_clear(leddisplay_frame_t *p_frame);
 */
 void leddisplay_frame_update(const leddisplay_frame_t *p_frame);
 
+//! update display with frame, re-rendering only the changed part
+/*!
+    Like leddisplay_frame_update(), but only the part of the frame that intersects the given
+    rectangle is rendered to the display (as well as anything that has become outdated in the
+    frame buffer memory since the last update, e.g. due to using the pixel based functions). The frame must still contain the full (current) display content.
+
+    Rendering is done in units of the display rows that are refreshed in parallel, i.e. a
+    rectangle that covers one pixel will re-render two (or more) full display rows.
+
+    \code{.c}
+    leddisplay_frame_update(&frame);                      // initial full frame
+    leddisplay_frame_xy_rgb(&frame, 10, 5, 0, 255, 0);     // change one pixel
+    leddisplay_frame_update_rect(&frame, 10, 5, 1, 1);     // update display
+    \endcode
+
+    \param[in] p_frame  RGB data for one frame
+    \param[in] x_coord  x coordinate of the changed rectangle
+    \param[in] y_coord  y coordinate of the changed rectangle
+    \param[in] width    width of the changed rectangle
+    \param[in] height   height of the changed rectangle
+*/
+void leddisplay_frame_update_rect(const leddisplay_frame_t *p_frame,
+    uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height);
+
+//! submit frame to the background render task
+/*!
+    Copies the frame and hands it to the render task (see #CONFIG_LEDDISPLAY_RENDER_TASK), which
+    renders it to the display like leddisplay_frame_update(). The frame memory can be re-used
+    (e.g. for drawing the next frame) as soon as this function returns. If the render task is
+    still busy with the previously submitted frame, this waits for up to the given timeout.
+
+\code{.c}
+    static leddisplay_frame_t frame;
+    while (true)
+    {
+        draw_next_frame(&frame);                   // prepare next frame..
+        leddisplay_frame_submit(&frame, -1);       // ..while the previous one is rendered
+    }
+\endcode
+
+    \param[in] p_frame     RGB data for one frame
+    \param[in] timeout_ms  maximum time to wait for the render task [ms], 0 to not wait at all,
+                           or -1 to wait forever
+
+    \returns #ESP_OK on success, #ESP_ERR_TIMEOUT if the render task didn't become available in
+             time, #ESP_ERR_NOT_SUPPORTED if the render task is not enabled
+*/
+esp_err_t leddisplay_frame_submit(const leddisplay_frame_t *p_frame, int timeout_ms);
+
+//! render task events
+typedef enum leddisplay_frame_event_e
+{
+    LEDDISPLAY_FRAME_RENDERED,   //!< submitted frame has been rendered and will be displayed after the current refresh
+    LEDDISPLAY_FRAME_DISPLAYED,  //!< submitted frame is now being displayed
+} leddisplay_frame_event_t;
+
+//! render task event callback
+/*!
+    \param[in] event  the event
+    \param[in] arg    user argument (see leddisplay_set_frame_cb())
+
+    \note This is called from the render task. It should return quickly and must not call any of
+          the frame based functions.
+*/
+typedef void (*leddisplay_frame_cb_t)(leddisplay_frame_event_t event, void *arg);
+
+//! set render task event callback
+/*!
+    The callback can be used to pace the production of frames (e.g. wait for
+    #LEDDISPLAY_FRAME_DISPLAYED before submitting the next frame). The callback and
+    its argument are replaced together, a frame that is already being rendered
+    reports both its events to the previous callback. A frame not yet displayed when the
+    display is shut down (e.g. while suspended) doesn't report #LEDDISPLAY_FRAME_DISPLAYED.
+
+    \param[in] cb   event callback, or NULL to remove the callback
+    \param[in] arg  user argument for the callback
+*/
+void leddisplay_set_frame_cb(leddisplay_frame_cb_t cb, void *arg);
+
+//@}
+
+/* *********************************************************************************************** */
+/*!
+    \name palette (indexed colour) frame functions
+
+    These work like the frame based functions, but the frame holds palette indices (8 or 4 bits
+    per pixel) instead of RGB values, which needs a third or a sixth of the memory. The encoding
+    uses a table of the (brightness corrected) bitplanes of the palette colours, so that it is
+    one table look-up per pixel. The palette can be changed at any time (e.g. for colour cycling),
+    it applies to the next update.
+
+    Example:
+
+\code{.c}
+    #include <leddisplay.h>
+    leddisplay_init();
+    static const uint8_t palette[4][3] = { { 0, 0, 0 }, { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 } };
+    leddisplay_palette_set(&palette[0][0], 0, 4);
+    static leddisplay_frame8_t frame;
+    memset(&frame, 0, sizeof(frame));            // clear frame (i.e. fill with colour 0)
+    frame.yx[5][10] = 2;                         // set green pixel at x=10 / y=5
+    leddisplay_frame8_update(&frame);            // display
+\endcode
+
+    @{
+*/
+
+//! indexed colour frame type, 8 bits per pixel
+typedef union leddisplay_frame8_u
+{
+    //! access pixel (palette index) by coordinates
+    uint8_t yx[LEDDISPLAY_HEIGHT][LEDDISPLAY_WIDTH];
+    //! access pixel (palette index) by index
+    uint8_t ix[LEDDISPLAY_HEIGHT * LEDDISPLAY_WIDTH];
+} leddisplay_frame8_t;
+
+//! indexed colour frame type, 4 bits per pixel (palette index 0..15)
+typedef union leddisplay_frame4_u
+{
+    //! access pixel pairs by coordinates (x / 2), the left pixel in the low nibble
+    uint8_t yx[LEDDISPLAY_HEIGHT][LEDDISPLAY_WIDTH / 2];
+    //! access pixel pairs by index (ix / 2), the left pixel in the low nibble
+    uint8_t ix[LEDDISPLAY_HEIGHT * LEDDISPLAY_WIDTH / 2];
+} leddisplay_frame4_t;
+
+//! set palette colours
+/*!
+    The palette has 256 colours (only the first 16 are used for leddisplay_frame4_t), they are
+    all black after leddisplay_init().
+
+    \param[in] p_rgb  the colours, RGB values (8 bits per colour)
+    \param[in] first  first colour (palette index) to set
+    \param[in] num    number of colours to set (first + num <= 256)
+
+    \returns ESP_OK on success, ESP_ERR_INVALID_ARG for bad parameters, ESP_ERR_NO_MEM if the
+             palette could not be allocated
+*/
+esp_err_t leddisplay_palette_set(const uint8_t *p_rgb, int first, int num);
+
+//! update display with indexed colour frame (8 bits per pixel)
+/*!
+    Like leddisplay_frame_update().
+
+    \param[in] p_frame  palette indices for one frame
+*/
+void leddisplay_frame8_update(const leddisplay_frame8_t *p_frame);
+
+//! set pixel in indexed colour frame (4 bits per pixel)
+/*!
+    \param[in] p_frame  frame
+    \param[in] x_coord  x coordinate
+    \param[in] y_coord  y coordinate
+    \param[in] colour   palette index (0..15)
+*/
+void leddisplay_frame4_xy(leddisplay_frame4_t *p_frame, uint16_t x_coord, uint16_t y_coord, uint8_t colour);
+
+//! update display with indexed colour frame (4 bits per pixel)
+/*!
+    Like leddisplay_frame_update().
+
+    \param[in] p_frame  palette indices for one frame
+*/
+void leddisplay_frame4_update(const leddisplay_frame4_t *p_frame);
+
+//@}
+
+/* *********************************************************************************************** */
+/*!
+    \name direct (zero-copy) functions
+
+    These functions give the application direct access to the frame buffer memory (the bitplanes
+    that the DMA outputs to the display), so that content can be written (or pre-encoded content
+    copied) without any encoding.
+
+    The memory consists of leddisplay_direct_t.num_rows rows, each of num_bitplanes bitplanes
+    (LSB first), each of num_words bus words (one per pixel clock). Row r holds the display rows
+    r (top half) and r + num_rows (bottom half) of all panels of the chain, and the word of chain
+    position x (0 is shifted out first and ends up at the left of the last panel in the chain, see
+    Kconfig) is at index #LEDDISPLAY_DIRECT_WORD_IX(x). Only the low byte of the word (see
+    leddisplay_direct_lo()) must be written: the colour bits (#LEDDISPLAY_DIRECT_R1 etc.) of that
+    bitplane, and the latch and output enable bits from leddisplay_direct_t.ctrl. The rest of the
+    word (if any) is the row address, which is set by the driver.
+
+    Example:
+
+\code{.c}
+    leddisplay_direct_t direct;
+    leddisplay_direct_get(&direct);
+    for (int row = 0; row < direct.num_rows; row++)
+    {
+        for (int bitplane = 0; bitplane < direct.num_bitplanes; bitplane++)
+        {
+            for (int x = 0; x < direct.num_words; x++)
+            {
+                const uint8_t rgb = (x & 1) ? LEDDISPLAY_DIRECT_R1 : LEDDISPLAY_DIRECT_B2; // stripes
+                *leddisplay_direct_lo(&direct, row, bitplane, x) = direct.ctrl[(bitplane * direct.num_words) + x] | rgb;
+            }
+        }
+    }
+    leddisplay_direct_update(0);
+\endcode
+
+    \note The control bits depend on the brightness. leddisplay_set_brightness() updates them in
+          the frame buffer memory (and in leddisplay_direct_t.ctrl), so words written with the
+          control bits obtained before a brightness change have the previous brightness. Unlike the
+          drawing functions, writing the memory directly is not excluded from brightness changes
+          in other tasks (see leddisplay_set_brightness()), so change the brightness from the task
+          that writes the memory.
+
+    @{
+*/
+
+//! colour bits of the low byte of a bus word (see leddisplay_direct_lo())
+#define LEDDISPLAY_DIRECT_R1       0x01  //!< red, top half
+#define LEDDISPLAY_DIRECT_G1       0x02  //!< green, top half
+#define LEDDISPLAY_DIRECT_B1       0x04  //!< blue, top half
+#define LEDDISPLAY_DIRECT_R2       0x08  //!< red, bottom half
+#define LEDDISPLAY_DIRECT_G2       0x10  //!< green, bottom half
+#define LEDDISPLAY_DIRECT_B2       0x20  //!< blue, bottom half
+#define LEDDISPLAY_DIRECT_RGB_MASK 0x3f  //!< all colour bits
+
+//! index of the bus word for a chain position (the I2S Tx FIFO mode 1 outputs words in a different order)
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+#  define LEDDISPLAY_DIRECT_WORD_IX(x) ((x) ^ 2)
+#else
+#  define LEDDISPLAY_DIRECT_WORD_IX(x) ((x) ^ 1)
+#endif
+
+//! frame buffer memory for direct access (see leddisplay_direct_get())
+typedef struct leddisplay_direct_s
+{
+    uint8_t       *mem;            //!< frame buffer memory
+    uint32_t       size;           //!< size of the memory [bytes]
+    int            num_rows;       //!< number of rows (two display rows each, see above)
+    int            num_bitplanes;  //!< number of bitplanes per row (#CONFIG_LEDDISPLAY_COLOR_DEPTH)
+    int            num_words;      //!< number of bus words per bitplane (pixels in the chain)
+    int            word_size;      //!< size of a bus word [bytes]
+    const uint8_t *ctrl;           //!< latch and output enable bits for each bitplane and chain position (num_bitplanes x num_words, not re-ordered)
+} leddisplay_direct_t;
+
+//! low byte of the bus word for a row, bitplane and chain position
+/*!
+    \param[in] p_direct  the frame buffer memory (see leddisplay_direct_get())
+    \param[in] row       row (0..num_rows-1)
+    \param[in] bitplane  bitplane (0..num_bitplanes-1)
+    \param[in] x         chain position (0..num_words-1)
+
+    \returns pointer to the low byte of the bus word
+*/
+static inline uint8_t *leddisplay_direct_lo(const leddisplay_direct_t *p_direct, int row, int bitplane, int x)
+{
+    return &p_direct->mem[((((row * p_direct->num_bitplanes) + bitplane) * p_direct->num_words) +
+        LEDDISPLAY_DIRECT_WORD_IX(x)) * p_direct->word_size];
+}
+
+//! get the frame buffer memory for direct access
+/*!
+    This will block as necessary until the frame buffer memory becomes available. The memory holds
+    an older frame (the one that was last drawn to it), so generally everything has to be written.
+    Rows copied as a whole (e.g. with memcpy()) must have been made for the same configuration and
+    brightness.
+
+    \param[out] p_direct  the frame buffer memory
+*/
+void leddisplay_direct_get(leddisplay_direct_t *p_direct);
+
+//! update display with the directly written frame buffer memory
+/*!
+    \param[in] block  waits for the next frame buffer to become available if non-zero
+
+    \note After this the memory from leddisplay_direct_get() must not be used anymore.
+*/
+void leddisplay_direct_update(int block);
+
+//@}
+
+/* *********************************************************************************************** */
+/*!
+    \name presentation (vsync) functions
+
+    An updated frame (see leddisplay_pixel_update(), leddisplay_frame_update() etc.) is displayed
+    from the start of the next refresh on (it never replaces the frame that is being displayed in
+    the middle of a refresh). An update that comes too late for the next refresh (i.e. within the
+    last few microseconds of the current one) is displayed from the refresh after it. The driver
+    knows which frame buffer the DMA actually started with, and the presentation information below
+    is for the refresh that really displays the frame.
+
+    Example:
+
+\code{.c}
+    static void presentCb(const leddisplay_present_t *p_present, void *arg)
+    {
+        // runs in the interrupt, p_present->time is the time the frame appeared on the display
+    }
+    leddisplay_set_present_cb(presentCb, NULL);
+    draw_next_frame();
+    leddisplay_pixel_update(0);
+    const uint32_t frame = leddisplay_get_frame_number();
+    if (leddisplay_wait_present(frame, 100) == ESP_OK)
+    {
+        leddisplay_present_t present;
+        leddisplay_get_present(&present);
+        printf("frame %u presented after %uus\n", present.frame, present.latency);
+    }
+\endcode
+
+    @{
+*/
+
+//! presentation information
+typedef struct leddisplay_present_s
+{
+    uint32_t frame;    //!< number of the frame (see leddisplay_get_frame_number()), 0 if no frame has been presented yet
+    uint32_t refresh;  //!< number of the refresh that started displaying it (see leddisplay_stats_t.refresh_count)
+    int64_t  time;     //!< time when it started to be displayed (esp_timer_get_time(), within a few tens of microseconds of the start of the refresh) [us]
+    uint32_t latency;  //!< time from the update to the presentation [us]
+} leddisplay_present_t;
+
+//! presentation callback
+/*!
+    \param[in] p_present  the presentation information of the frame that is being displayed now
+    \param[in] arg        user argument (see leddisplay_set_present_cb())
+
+    \note This is called from the I2S interrupt. It must be in IRAM (IRAM_ATTR), return quickly,
+          and must only use ISR safe functions (e.g. vTaskNotifyGiveFromISR()).
+*/
+typedef void (*leddisplay_present_cb_t)(const leddisplay_present_t *p_present, void *arg);
+
+//! set presentation callback
+/*!
+    \param[in] cb   presentation callback, or NULL to remove the callback
+    \param[in] arg  user argument for the callback
+*/
+void leddisplay_set_present_cb(leddisplay_present_cb_t cb, void *arg);
+
+//! get the number of the last updated frame
+/*!
+    \returns the number of the frame updated last (counts all updates, the first frame is 1)
+*/
+uint32_t leddisplay_get_frame_number(void);
+
+//! get the presentation information of the frame that was presented last
+/*!
+    \param[out] p_present  the presentation information
+*/
+void leddisplay_get_present(leddisplay_present_t *p_present);
+
+//! wait for the start of the next refresh (vsync)
+/*!
+    \param[in] timeout_ms  maximum time to wait [ms], or -1 to wait forever
+
+    \returns #ESP_OK on success, #ESP_ERR_TIMEOUT if no refresh started in time
+*/
+esp_err_t leddisplay_wait_vsync(int timeout_ms);
+
+//! wait until a frame (or a later one) has been presented
+/*!
+    \param[in] frame       number of the frame (see leddisplay_get_frame_number())
+    \param[in] timeout_ms  maximum time to wait [ms], or -1 to wait forever
+
+    \returns #ESP_OK on success, #ESP_ERR_TIMEOUT if the frame was not presented in time
+*/
+esp_err_t leddisplay_wait_present(uint32_t frame, int timeout_ms);
+
+//@}
+
+/* *********************************************************************************************** */
+/*!
+    \name multiple displays
+
+    With #CONFIG_LEDDISPLAY_SECOND_DISP the driver drives a second display (chain of panels) on the
+    other I2S peripheral. It has the same configuration (type, chain, colour depth, etc.) as the
+    first one, but its own GPIOs, frame buffers, DMA descriptors, interrupt, statistics and tasks, so
+    that the two displays refresh independently of each other. The functions above are for the
+    first display. Each leddisplay_disp_*() function below does the same as the function without
+    the "disp_" for the display p_disp. The frame-only functions (leddisplay_frame_xy_rgb() etc.)
+    work for any display.
+
+    Example:
+
+\code{.c}
+    leddisplay_t *p_left  = leddisplay_get_disp(0);
+    leddisplay_t *p_right = leddisplay_get_disp(1);
+    leddisplay_disp_init(p_left);
+    leddisplay_disp_init(p_right);
+    leddisplay_disp_frame_update(p_left, &leftFrame);
+    leddisplay_disp_frame_update(p_right, &rightFrame);
+\endcode
+
+    @{
+*/
+
+//! number of displays
+#if CONFIG_LEDDISPLAY_SECOND_DISP
+#  define LEDDISPLAY_NUM_DISPS 2
+#else
+#  define LEDDISPLAY_NUM_DISPS 1
+#endif
+
+//! a display (see leddisplay_get_disp())
+typedef struct leddisplay_s leddisplay_t;
+
+//! get a display
+/*!
+    \param[in] num  number of the display (0 is the one used by the functions without the display
+                    argument, 1 is the second display, see #CONFIG_LEDDISPLAY_SECOND_DISP)
+
+    \returns the display, or NULL if there is no such display
+*/
+leddisplay_t *leddisplay_get_disp(int num);
+
+//! see leddisplay_init()
+esp_err_t leddisplay_disp_init(leddisplay_t *p_disp);
+
+//! see leddisplay_shutdown()
+void leddisplay_disp_shutdown(leddisplay_t *p_disp);
+
+//! see leddisplay_suspend()
+esp_err_t leddisplay_disp_suspend(leddisplay_t *p_disp);
+
+//! see leddisplay_resume()
+esp_err_t leddisplay_disp_resume(leddisplay_t *p_disp);
+
+//! see leddisplay_set_low_power()
+esp_err_t leddisplay_disp_set_low_power(leddisplay_t *p_disp, int enable);
+
+//! see leddisplay_set_brightness()
+int leddisplay_disp_set_brightness(leddisplay_t *p_disp, int brightness);
+
+//! see leddisplay_get_brightness()
+int leddisplay_disp_get_brightness(leddisplay_t *p_disp);
+
+//! see leddisplay_set_current_limit()
+esp_err_t leddisplay_disp_set_current_limit(leddisplay_t *p_disp, int limit_ma);
+
+//! see leddisplay_get_stats()
+void leddisplay_disp_get_stats(leddisplay_t *p_disp, leddisplay_stats_t *p_stats);
+
+//! see leddisplay_pixel_xy_rgb()
+void leddisplay_disp_pixel_xy_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint8_t red,
+    uint8_t green, uint8_t blue);
+
+//! see leddisplay_pixel_fill_rgb()
+void leddisplay_disp_pixel_fill_rgb(leddisplay_t *p_disp, uint8_t red, uint8_t green, uint8_t blue);
+
+//! see leddisplay_pixel_hline_rgb()
+void leddisplay_disp_pixel_hline_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width,
+    uint8_t red, uint8_t green, uint8_t blue);
+
+//! see leddisplay_pixel_rect_fill_rgb()
+void leddisplay_disp_pixel_rect_fill_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord,
+    uint16_t width, uint16_t height, uint8_t red, uint8_t green, uint8_t blue);
+
+//! see leddisplay_pixel_blit()
+void leddisplay_disp_pixel_blit(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width,
+    uint16_t height, const uint8_t *p_rgb);
+
+//! see leddisplay_pixel_flush_rgb888()
+void leddisplay_disp_pixel_flush_rgb888(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord,
+    uint16_t width, uint16_t height, const uint8_t *p_rgb, uint16_t stride);
+
+//! see leddisplay_pixel_flush_rgb565()
+void leddisplay_disp_pixel_flush_rgb565(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord,
+    uint16_t width, uint16_t height, const uint16_t *p_rgb565, uint16_t stride);
+
+//! see leddisplay_pixel_update()
+void leddisplay_disp_pixel_update(leddisplay_t *p_disp, int block);
+
+//! see leddisplay_frame_update()
+void leddisplay_disp_frame_update(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame);
+
+//! see leddisplay_frame_update_rect()
+void leddisplay_disp_frame_update_rect(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame,
+    uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height);
+
+//! see leddisplay_frame_submit()
+esp_err_t leddisplay_disp_frame_submit(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, int timeout_ms);
+
+//! see leddisplay_set_frame_cb()
+void leddisplay_disp_set_frame_cb(leddisplay_t *p_disp, leddisplay_frame_cb_t cb, void *arg);
+
+//! see leddisplay_palette_set()
+esp_err_t leddisplay_disp_palette_set(leddisplay_t *p_disp, const uint8_t *p_rgb, int first, int num);
+
+//! see leddisplay_frame8_update()
+void leddisplay_disp_frame8_update(leddisplay_t *p_disp, const leddisplay_frame8_t *p_frame);
+
+//! see leddisplay_frame4_update()
+void leddisplay_disp_frame4_update(leddisplay_t *p_disp, const leddisplay_frame4_t *p_frame);
+
+//! see leddisplay_direct_get()
+void leddisplay_disp_direct_get(leddisplay_t *p_disp, leddisplay_direct_t *p_direct);
+
+//! see leddisplay_direct_update()
+void leddisplay_disp_direct_update(leddisplay_t *p_disp, int block);
+
+//! see leddisplay_set_present_cb()
+void leddisplay_disp_set_present_cb(leddisplay_t *p_disp, leddisplay_present_cb_t cb, void *arg);
+
+//! see leddisplay_get_frame_number()
+uint32_t leddisplay_disp_get_frame_number(leddisplay_t *p_disp);
+
+//! see leddisplay_get_present()
+void leddisplay_disp_get_present(leddisplay_t *p_disp, leddisplay_present_t *p_present);
+
+//! see leddisplay_wait_vsync()
+esp_err_t leddisplay_disp_wait_vsync(leddisplay_t *p_disp, int timeout_ms);
+
+//! see leddisplay_wait_present()
+esp_err_t leddisplay_disp_wait_present(leddisplay_t *p_disp, uint32_t frame, int timeout_ms);
+
 //@}
 
 /* *********************************************************************************************** */
@@ -0,0 +1,180 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: pre-encoded animations player (see \ref LEDDISPLAY_ANIM)
+
+    \defgroup LEDDISPLAY_ANIM LEDDISPLAY_ANIM
+
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    This plays animations that have been encoded offline into the colour bits of the frame buffer
+    memory (see the direct functions in leddisplay.h), so that playing needs no pixel encoding. The
+    animations are encoded using the host build of the encoder (see examples/leddisplay_host),
+    which must use the same display configuration (type, chain, colour depth and brightness
+    correction) as the target.
+
+    The animation data is read from memory (e.g. an array in the firmware or a memory mapped flash
+    partition) or from a stream (e.g. a file or a network connection). The player needs one byte
+    of RAM per bus word for the decoding state (e.g. 8 kB for a 64x32 display with 8 bits colour
+    depth).
+
+    Format (all values little endian):
+
+    - header (16 bytes):
+      - magic "LDA1" (4 bytes)
+      - number of words per bitplane (uint16_t, leddisplay_direct_t.num_words)
+      - number of rows (uint8_t, leddisplay_direct_t.num_rows)
+      - number of bitplanes (uint8_t, leddisplay_direct_t.num_bitplanes)
+      - number of frames (uint16_t)
+      - frame duration [ms] (uint16_t)
+      - reserved, 0 (uint32_t)
+    - each frame:
+      - size of the data [bytes] (uint32_t), with #LEDDISPLAY_ANIM_KEY_FRAME set for key frames
+      - data: tokens that decode to one value (the #LEDDISPLAY_DIRECT_RGB_MASK bits of the bus
+        word) for each row, bitplane and chain position (in this order, i.e. the same order as the
+        frame buffer memory but with the chain positions not re-ordered), which are XOR-ed onto the
+        values of the previous frame (key frames: onto all zeros)
+    - tokens:
+      - 0x00..0x3f: one value (the token)
+      - 0x40..0x7f, v: ((token & 0x3f) + 2) times value v
+      - 0x80..0xbf: ((token & 0x3f) + 1) times value 0 (i.e. unchanged)
+      - 0xc0..0xff, n, v: ((((token & 0x3f) << 8) | n) + 1) times value v
+
+    The first frame must be a key frame.
+
+    Example:
+
+\code{.c}
+    leddisplay_anim_t anim;
+    if (leddisplay_anim_open_mem(&anim, animData, animSize) == ESP_OK)
+    {
+        uint32_t prevTick = xTaskGetTickCount();
+        while (leddisplay_anim_frame(&anim, 1) == ESP_OK)
+        {
+            vTaskDelayUntil(&prevTick, anim.frame_ms / portTICK_PERIOD_MS);
+        }
+        leddisplay_anim_close(&anim);
+    }
+\endcode
+
+    @{
+*/
+
+#ifndef __LEDDISPLAY_ANIM_H__
+#define __LEDDISPLAY_ANIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <esp_err.h>
+
+#include "leddisplay.h"
+
+//! size of the animation header [bytes]
+#define LEDDISPLAY_ANIM_HEADER_SIZE   16
+
+//! flag for the frame data size of key frames
+#define LEDDISPLAY_ANIM_KEY_FRAME     0x80000000
+
+//! stream read function
+/*!
+    \param[in]  arg    user argument (see leddisplay_anim_open_stream())
+    \param[out] p_buf  buffer to read into
+    \param[in]  size   number of bytes to read (at most)
+
+    \returns the number of bytes read (1..size), or 0 (or less) at the end of the stream (or error)
+*/
+typedef int (*leddisplay_anim_read_t)(void *arg, uint8_t *p_buf, int size);
+
+//! animation player state (see leddisplay_anim_open_mem() etc.)
+typedef struct leddisplay_anim_s
+{
+    int                    num_frames;  //!< number of frames in the animation
+    int                    frame_ms;    //!< frame duration [ms]
+    int                    frame;       //!< number of the next frame (0..num_frames-1, num_frames at the end)
+
+    // (private)
+    const uint8_t         *data;        // memory: the animation data
+    uint32_t               size;        // memory: size of the data
+    leddisplay_anim_read_t read;        // stream: read function
+    void                  *arg;         // stream: read function argument
+    uint8_t                buf[128];    // stream: read buffer (memory: unused)
+    uint32_t               pos;         // memory: read position, stream: position in buf
+    uint32_t               len;         // stream: number of bytes in buf
+    uint8_t               *state;       // current values of all words
+    uint32_t               mmap;        // partition: memory map handle
+    bool                   mmapped;     // partition: memory is mapped
+} leddisplay_anim_t;
+
+//! open an animation in memory
+/*!
+    \param[out] p_anim  animation player state
+    \param[in]  p_data  animation data (must stay valid until leddisplay_anim_close())
+    \param[in]  size    size of the data [bytes]
+
+    \returns ESP_OK on success, ESP_ERR_INVALID_ARG if the data does not look like an animation,
+             ESP_ERR_NOT_SUPPORTED if it is for a different display configuration, ESP_ERR_NO_MEM
+             if the decoding state could not be allocated
+*/
+esp_err_t leddisplay_anim_open_mem(leddisplay_anim_t *p_anim, const void *p_data, uint32_t size);
+
+//! open an animation stored in a flash partition
+/*!
+    The (data type) partition is memory mapped.
+
+    \param[out] p_anim  animation player state
+    \param[in]  label   partition label
+
+    \returns ESP_OK on success, ESP_ERR_NOT_FOUND if there is no such partition, or any of the
+             errors of leddisplay_anim_open_mem()
+*/
+esp_err_t leddisplay_anim_open_partition(leddisplay_anim_t *p_anim, const char *label);
+
+//! open a streamed animation
+/*!
+    \param[out] p_anim  animation player state
+    \param[in]  read    read function
+    \param[in]  arg     user argument for the read function
+
+    \returns ESP_OK on success, or any of the errors of leddisplay_anim_open_mem()
+*/
+esp_err_t leddisplay_anim_open_stream(leddisplay_anim_t *p_anim, leddisplay_anim_read_t read, void *arg);
+
+//! play the next frame
+/*!
+    This decodes the next frame and updates the display with it (see leddisplay_direct_get() and
+    leddisplay_direct_update()). The frame duration is left to the caller.
+
+    \param[in] p_anim  animation player state
+    \param[in] block   waits for the next frame buffer to become available if non-zero (see
+                       leddisplay_direct_update())
+
+    \returns ESP_OK on success, ESP_ERR_NOT_FOUND at the end of the animation, ESP_ERR_INVALID_SIZE
+             on corrupt data (the display is not updated, and the animation must be rewound)
+*/
+esp_err_t leddisplay_anim_frame(leddisplay_anim_t *p_anim, int block);
+
+//! restart the animation from the first frame
+/*!
+    \param[in] p_anim  animation player state
+
+    \returns ESP_OK on success, ESP_ERR_NOT_SUPPORTED for streamed animations
+*/
+esp_err_t leddisplay_anim_rewind(leddisplay_anim_t *p_anim);
+
+//! close the animation, releases the resources
+/*!
+    \param[in] p_anim  animation player state
+*/
+void leddisplay_anim_close(leddisplay_anim_t *p_anim);
+
+//@}
+#endif // __LEDDISPLAY_ANIM_H__
@@ -0,0 +1,94 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: network frame receiver (see \ref LEDDISPLAY_NET)
+
+    \defgroup LEDDISPLAY_NET LEDDISPLAY_NET
+
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    This receives frames using the Distributed Display Protocol (DDP, see
+    http://www.3waylabs.com/ddp/), as sent by many media servers and LED controller applications,
+    on UDP port #CONFIG_LEDDISPLAY_NET_PORT (see #CONFIG_LEDDISPLAY_NET). The data (RGB, 8 bits per
+    colour) is the display (canvas) pixels row by row (i.e. the same as leddisplay_frame_t.ix),
+    and the data offset of the packets is the offset into that.
+
+    The frame buffer rows are rendered as soon as all their pixels have been received, and the
+    display is updated when the packet with the push flag arrives, so that the latency is about
+    one packet and one refresh. The pixels of lost packets keep the value of the previous frame.
+    Packets reordered (by up to 7 packets, see the sequence number in the DDP header) within a
+    frame are no problem, packets that arrive after the push of their frame are dropped.
+
+    The application must not draw to the display while the receiver runs, and must stop it before
+    leddisplay_shutdown(). Packets with the query flag, and packets for other destinations than
+    the default output device (1) or all devices (255) are ignored.
+
+    Example:
+
+\code{.c}
+    leddisplay_init();
+    // ...connect to the network
+    leddisplay_net_start();
+    while (true)
+    {
+        vTaskDelay(10000 / portTICK_PERIOD_MS);
+        leddisplay_net_stats_t stats;
+        leddisplay_net_get_stats(&stats);
+        printf("frames %u (%u incomplete), packets %u (%u lost)\n",
+            stats.frames, stats.frames_incomplete, stats.packets, stats.packets_lost);
+    }
+\endcode
+
+    @{
+*/
+
+#ifndef __LEDDISPLAY_NET_H__
+#define __LEDDISPLAY_NET_H__
+
+#include <stdint.h>
+#include <esp_err.h>
+
+#include "leddisplay.h"
+
+//! start the network receiver
+/*!
+    The network (WiFi or ethernet) must be up, and the display initialised (see leddisplay_init()).
+
+    \returns ESP_OK on success, ESP_ERR_INVALID_STATE if it is already running, ESP_ERR_NO_MEM if
+             the receiver could not be created, ESP_FAIL if the UDP socket could not be opened,
+             ESP_ERR_NOT_SUPPORTED if #CONFIG_LEDDISPLAY_NET is not enabled
+*/
+esp_err_t leddisplay_net_start(void);
+
+//! stop the network receiver
+void leddisplay_net_stop(void);
+
+//! network receiver statistics
+typedef struct leddisplay_net_stats_s
+{
+    uint32_t packets;             //!< number of DDP packets received
+    uint32_t packets_invalid;     //!< number of packets ignored (not DDP, wrong type or destination, query, bad offset)
+    uint32_t packets_lost;        //!< number of packets lost (sequence numbers not seen)
+    uint32_t packets_reordered;   //!< number of packets received out of order (applied)
+    uint32_t packets_late;        //!< number of packets dropped because they arrived after the push of their frame
+    uint32_t frames;              //!< number of frames displayed (push flag received)
+    uint32_t frames_incomplete;   //!< number of frames displayed with not all pixels received
+} leddisplay_net_stats_t;
+
+//! get network receiver statistics
+/*!
+    \param[out] p_stats  the statistics (since leddisplay_net_start())
+*/
+void leddisplay_net_get_stats(leddisplay_net_stats_t *p_stats);
+
+//@}
+#endif // __LEDDISPLAY_NET_H__
@@ -39,33 +39,42 @@
 #include "i2s_parallel.h"
 
 typedef struct {
-    volatile lldesc_t *dmadesc_a, *dmadesc_b;
-    int desccount_a, desccount_b;
+    volatile lldesc_t *dmadesc[I2S_PARALLEL_MAX_BUFFERS];
+    int desccount[I2S_PARALLEL_MAX_BUFFERS];
+    int bufcount;
+    volatile lldesc_t *dmadesc_shared;
+    int desccount_shared;
+    int clkm_div_num;
+    int clkm_div_scale;
     intr_handle_t intr_handle;
+    i2s_parallel_callback_t shift_complete_cb;
+    void *shift_complete_cb_arg;
+    int num;
 } i2s_parallel_state_t;
 
-static i2s_parallel_state_t i2s_state[2] = { { 0 }, { 0 } };
-
-static i2s_parallel_callback_t shiftCompleteCallback;
-
-void i2s_parallel_set_shiftcomplete_cb(i2s_parallel_callback_t f) {
-    shiftCompleteCallback = f;
-}
+static i2s_parallel_state_t i2s_state[2] = { 0 };
 
 static int i2snum(i2s_dev_t *dev) {
     return (dev==&I2S0)?0:1;
 }
 
-// Todo: handle IS20? (this is hard coded for I2S1 only)
+void i2s_parallel_set_shiftcomplete_cb(i2s_dev_t *dev, i2s_parallel_callback_t f, void *arg) {
+    i2s_parallel_state_t *st = &i2s_state[i2snum(dev)];
+    st->shift_complete_cb = f;
+    st->shift_complete_cb_arg = arg;
+}
+
+// each device has its own interrupt, the argument is its state
 static void IRAM_ATTR i2s_isr(void* arg)
 {
-    REG_WRITE(I2S_INT_CLR_REG(1), (REG_READ(I2S_INT_RAW_REG(1)) & 0xffffffc0) | 0x3f);
+    i2s_parallel_state_t *st = (i2s_parallel_state_t *)arg;
+    REG_WRITE(I2S_INT_CLR_REG(st->num), (REG_READ(I2S_INT_RAW_REG(st->num)) & 0xffffffc0) | 0x3f);
 
     // at this point, the previously active buffer is free, go ahead and write to it
 
-    if (shiftCompleteCallback)
+    if (st->shift_complete_cb)
     {
-        if (shiftCompleteCallback() == pdTRUE)
+        if (st->shift_complete_cb(st->shift_complete_cb_arg) == pdTRUE)
         {
             portYIELD_FROM_ISR();
         }
@@ -122,22 +131,38 @@ static void IRAM_ATTR i2s_isr(void* arg)
 //    DEBUG("fill_dma_desc: filled %d descriptors", n);
 //}
 
-// size must be less than DMA_MAX - need to handle breaking long transfer into two descriptors before call
-void i2s_parallel_link_dma_desc(volatile lldesc_t *dmadesc, volatile lldesc_t *prevdmadesc, void *memory, size_t size) {
-    if(size > DMA_MAX) size = DMA_MAX;
-
-    dmadesc->size = size;
-    dmadesc->length = size;
-    dmadesc->buf = memory;
-    dmadesc->eof = 0;
-    dmadesc->sosf = 0;
-    dmadesc->owner = 1;
-    dmadesc->qe.stqe_next = 0;  // will need to set this elsewhere
-    dmadesc->offset = 0;
-
-    // link previous to current
-    if(prevdmadesc)
-        prevdmadesc->qe.stqe_next = (lldesc_t*)dmadesc;
+int i2s_parallel_dma_desc_count(size_t size) {
+    return (size + DMA_MAX - 1) / DMA_MAX;
+}
+
+// buffers larger than DMA_MAX are split into several descriptors (DMA_MAX is a multiple of 4, so
+// all chunks remain word-aligned)
+int i2s_parallel_link_dma_desc(volatile lldesc_t *dmadesc, volatile lldesc_t *prevdmadesc, void *memory, size_t size) {
+    int n = 0;
+    uint8_t *data = (uint8_t *)memory;
+    do {
+        size_t dmalen = size;
+        if(dmalen > DMA_MAX) dmalen = DMA_MAX;
+
+        dmadesc[n].size = dmalen;
+        dmadesc[n].length = dmalen;
+        dmadesc[n].buf = data;
+        dmadesc[n].eof = 0;
+        dmadesc[n].sosf = 0;
+        dmadesc[n].owner = 1;
+        dmadesc[n].qe.stqe_next = 0;  // will need to set this elsewhere
+        dmadesc[n].offset = 0;
+
+        // link previous to current
+        if(prevdmadesc)
+            prevdmadesc->qe.stqe_next = (lldesc_t*)&dmadesc[n];
+        prevdmadesc = &dmadesc[n];
+
+        size -= dmalen;
+        data += dmalen;
+        n++;
+    } while(size > 0);
+    return n;
 }
 
 // FIXME: add error handling (not all pins can be output..)?
@@ -159,26 +184,41 @@ static void fifo_reset(i2s_dev_t *dev) {
     dev->conf.tx_fifo_reset=1; dev->conf.tx_fifo_reset=0;
 }
 
-esp_err_t i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
-    DEBUG("init I2S%d, %dbits, %dHz", i2snum(dev), cfg->bits, cfg->clkspeed_hz);
-    //Figure out which signal numbers to use for routing
-    int sig_data_base, sig_clk;
+int i2s_parallel_data_sig(i2s_dev_t *dev, i2s_parallel_cfg_bits_t bits, int bit) {
     if (dev==&I2S0) {
-        sig_data_base=I2S0O_DATA_OUT0_IDX;
-        sig_clk=I2S0O_WS_OUT_IDX;
+        //The 16-bit values for i2s0 appear on d8...d23 as well (see i2s1 below), but unlike for
+        //i2s1 the 8-bit values appear on d16...d23, not on d0...d7 (that's what the hardware does,
+        //and what other I2S parallel drivers use, too). Users of the signals (e.g. to route one of
+        //the bits to another pad) must therefore use this function rather than assume a mapping.
+        if (bits==I2S_PARALLEL_BITS_16) {
+            return I2S0O_DATA_OUT8_IDX+bit;
+        } else if (bits==I2S_PARALLEL_BITS_8) {
+            return I2S0O_DATA_OUT16_IDX+bit;
+        } else {
+            return I2S0O_DATA_OUT0_IDX+bit;
+        }
     } else {
-        if (cfg->bits==I2S_PARALLEL_BITS_32) {
-            sig_data_base=I2S1O_DATA_OUT0_IDX;
-        } else if (cfg->bits==I2S_PARALLEL_BITS_16) {
+        if (bits==I2S_PARALLEL_BITS_32) {
+            return I2S1O_DATA_OUT0_IDX+bit;
+        } else if (bits==I2S_PARALLEL_BITS_16) {
             //Because of... reasons... the 16-bit values for i2s1 appear on d8...d23
             //DEBUG("Setting up i2s parallel mode in 16 bit mode!");
-            sig_data_base=I2S1O_DATA_OUT8_IDX;
+            return I2S1O_DATA_OUT8_IDX+bit;
         } else { // I2S_PARALLEL_BITS_8
             //DEBUG("Setting up i2s parallel mode in 8 bit mode -> https://www.esp32.com/viewtopic.php?f=17&t=3188 | https://www.esp32.com/viewtopic.php?f=13&t=3256");
-            sig_data_base=I2S1O_DATA_OUT0_IDX;
+            return I2S1O_DATA_OUT0_IDX+bit;
         }
-        sig_clk=I2S1O_WS_OUT_IDX;
     }
+}
+
+esp_err_t i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
+    DEBUG("init I2S%d, %dbits, %dHz, %d buffers", i2snum(dev), cfg->bits, cfg->clkspeed_hz, cfg->bufcount);
+    if ( (cfg->bufcount < 1) || (cfg->bufcount > I2S_PARALLEL_MAX_BUFFERS) ) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    //Figure out which signal numbers to use for routing
+    const int sig_data_base=i2s_parallel_data_sig(dev, cfg->bits, 0);
+    const int sig_clk=(dev==&I2S0) ? I2S0O_WS_OUT_IDX : I2S1O_WS_OUT_IDX;
     
     //Route the signals
     for (int x=0; x<cfg->bits; x++) {
@@ -252,11 +292,17 @@ esp_err_t i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
     
     //Allocate DMA descriptors
     i2s_parallel_state_t *st = &i2s_state[i2snum(dev)];
-
-    st->desccount_a = cfg->desccount_a;
-    st->desccount_b = cfg->desccount_b;
-    st->dmadesc_a = cfg->lldesc_a;
-    st->dmadesc_b = cfg->lldesc_b;
+    st->num = i2snum(dev);
+    st->clkm_div_num = dev->clkm_conf.clkm_div_num;
+    st->clkm_div_scale = 1;
+
+    st->bufcount = cfg->bufcount;
+    for (int i=0; i<cfg->bufcount; i++) {
+        st->desccount[i] = cfg->desccount[i];
+        st->dmadesc[i] = cfg->lldesc[i];
+    }
+    st->dmadesc_shared = cfg->lldesc_shared;
+    st->desccount_shared = cfg->lldesc_shared != NULL ? cfg->desccount_shared : 0;
 
     //Reset FIFO/DMA -> needed? Doesn't dma_reset/fifo_reset do this?
     dev->lc_conf.in_rst=1; dev->lc_conf.out_rst=1; dev->lc_conf.ahbm_rst=1; dev->lc_conf.ahbm_fifo_rst=1;
@@ -265,13 +311,14 @@ esp_err_t i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg) {
     dev->conf.tx_reset=0; dev->conf.tx_fifo_reset=0; dev->conf.rx_fifo_reset=0;
     
     // setup I2S Interrupt
-    SET_PERI_REG_BITS(I2S_INT_ENA_REG(1), I2S_OUT_EOF_INT_ENA_V, 1, I2S_OUT_EOF_INT_ENA_S);
+    SET_PERI_REG_BITS(I2S_INT_ENA_REG(st->num), I2S_OUT_EOF_INT_ENA_V, 1, I2S_OUT_EOF_INT_ENA_S);
     // allocate a level 1 interrupt: lowest priority, as ISR isn't urgent and may take a long time to complete
-    esp_intr_alloc(ETS_I2S1_INTR_SOURCE, (int)(ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL1), i2s_isr, NULL, &st->intr_handle);
+    esp_intr_alloc(dev==&I2S0 ? ETS_I2S0_INTR_SOURCE : ETS_I2S1_INTR_SOURCE, (int)(ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL1),
+        i2s_isr, st, &st->intr_handle);
 
     //Start dma on front buffer
     dev->lc_conf.val=I2S_OUT_DATA_BURST_EN | I2S_OUTDSCR_BURST_EN | I2S_OUT_DATA_BURST_EN;
-    dev->out_link.addr=((uint32_t)(&st->dmadesc_a[0]));
+    dev->out_link.addr=((uint32_t)(&st->dmadesc[0][0]));
     dev->out_link.start=1;
     dev->conf.tx_start=1;
 
@@ -285,21 +332,100 @@ void i2s_parallel_stop(i2s_dev_t *dev)
     dev->conf.tx_start  = 0;
 }
 
-//Flip to a buffer: 0 for bufa, 1 for bufb
+// stop the output, but keep everything else (descriptors, interrupt, clock) for i2s_parallel_resume()
+void i2s_parallel_pause(i2s_dev_t *dev) {
+    dev->conf.tx_start  = 0;
+    dev->out_link.stop  = 1;
+    dev->out_link.start = 0;
+}
+
+// restart the output with the start of a buffer: 0..bufcount-1
+void i2s_parallel_resume(i2s_dev_t *dev, int bufid) {
+    i2s_parallel_state_t *st = &i2s_state[i2snum(dev)];
+    if ( (bufid < 0) || (bufid >= st->bufcount) ) {
+        return;
+    }
+    // drop what's left in the FIFO from before the pause
+    dev->conf.tx_reset=1; dev->conf.tx_reset=0;
+    dma_reset(dev);
+    fifo_reset(dev);
+    dev->lc_conf.val=I2S_OUT_DATA_BURST_EN | I2S_OUTDSCR_BURST_EN | I2S_OUT_DATA_BURST_EN;
+    dev->out_link.stop=0;
+    dev->out_link.addr=((uint32_t)(&st->dmadesc[bufid][0]));
+    dev->out_link.start=1;
+    dev->conf.tx_start=1;
+}
+
+//Flip to a buffer: 0..bufcount-1
 void i2s_parallel_flip_to_buffer(i2s_dev_t *dev, int bufid) {
-    int no=i2snum(dev);
-    lldesc_t *active_dma_chain;
-    if (bufid==0) {
-        active_dma_chain=(lldesc_t*)&i2s_state[no].dmadesc_a[0];
+    i2s_parallel_state_t *st = &i2s_state[i2snum(dev)];
+    if ( (bufid < 0) || (bufid >= st->bufcount) ) {
+        return;
+    }
+    lldesc_t *active_dma_chain=(lldesc_t*)&st->dmadesc[bufid][0];
+
+    // setup linked list to refresh from new buffer (continuously) when the end of the current list
+    // has been reached (this includes a buffer that was flipped to before but hasn't been reached yet,
+    // so that the new buffer replaces it)
+    if (st->desccount_shared > 0) {
+        // all chains continue with the shared descriptors, so there's only one end
+        st->dmadesc_shared[st->desccount_shared-1].qe.stqe_next=active_dma_chain;
     } else {
-        active_dma_chain=(lldesc_t*)&i2s_state[no].dmadesc_b[0];
+        for (int i=0; i<st->bufcount; i++) {
+            st->dmadesc[i][st->desccount[i]-1].qe.stqe_next=active_dma_chain;
+        }
     }
 
-    // setup linked list to refresh from new buffer (continuously) when the end of the current list has been reached
-    i2s_state[no].dmadesc_a[i2s_state[no].desccount_a-1].qe.stqe_next=active_dma_chain;
-    i2s_state[no].dmadesc_b[i2s_state[no].desccount_b-1].qe.stqe_next=active_dma_chain;
-
     // we're still refreshing the previously buffer, so it shouldn't be written to yet
 }
 
+// multiply the clock divider set by i2s_parallel_setup() (the clock speed is divided by scale),
+// this resets the trim (see i2s_parallel_set_clock_trim())
+esp_err_t i2s_parallel_set_clock_div(i2s_dev_t *dev, int scale) {
+    i2s_parallel_state_t *st = &i2s_state[i2snum(dev)];
+    const int div_num = ((st->clkm_div_num + 1) * scale) - 1;
+    if ( (scale < 1) || (div_num > I2S_PARALLEL_CLOCK_DIV_MAX) ) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    st->clkm_div_scale = scale;
+    __typeof__(dev->clkm_conf) clkm_conf;
+    clkm_conf.val = dev->clkm_conf.val;
+    clkm_conf.clkm_div_num = div_num;
+    clkm_conf.clkm_div_b = 63;
+    dev->clkm_conf.val = clkm_conf.val;
+    return ESP_OK;
+}
+
+// this is called from the shift complete callback (i.e. from the ISR)
+void IRAM_ATTR i2s_parallel_set_clock_trim(i2s_dev_t *dev, int trim) {
+    i2s_parallel_state_t *st = &i2s_state[(dev==&I2S0)?0:1]; // not i2snum(), which may not be in IRAM
+    if (trim < -63) trim = -63;
+    if (trim > 63) trim = 63;
+    // the divider set by i2s_parallel_setup() is clkm_div_num + 63/63 (times the scale set by
+    // i2s_parallel_set_clock_div()), change the fractional part (and the integer part for a larger
+    // divider), and write all at once
+    const int div_num = ((st->clkm_div_num + 1) * st->clkm_div_scale) - 1;
+    __typeof__(dev->clkm_conf) clkm_conf;
+    clkm_conf.val = dev->clkm_conf.val;
+    if (trim <= 0) {
+        clkm_conf.clkm_div_num = div_num;
+        clkm_conf.clkm_div_b = 63 + trim;
+    } else {
+        clkm_conf.clkm_div_num = div_num + 1;
+        clkm_conf.clkm_div_b = trim;
+    }
+    dev->clkm_conf.val = clkm_conf.val;
+}
+
+// this is called from the shift complete callback (i.e. from the ISR)
+void IRAM_ATTR i2s_parallel_move_shared_desc(i2s_dev_t *dev, const void *from, size_t size, const void *to) {
+    i2s_parallel_state_t *st = &i2s_state[(dev==&I2S0)?0:1]; // not i2snum(), which may not be in IRAM
+    for (int i=0; i<st->desccount_shared; i++) {
+        const size_t offset = (const uint8_t *)st->dmadesc_shared[i].buf - (const uint8_t *)from;
+        if (offset < size) {
+            st->dmadesc_shared[i].buf = (uint8_t *)to + offset;
+        }
+    }
+}
+
 
@@ -2,13 +2,14 @@
 #define I2S_PARALLEL_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include <esp_err.h>
 #include <soc/i2s_struct.h>
 #include <rom/lldesc.h>
 
 typedef enum {
-    I2S_PARALLEL_BITS_8  =  8, // BUG: Doesn't work.
+    I2S_PARALLEL_BITS_8  =  8, // Note: the bytes of each 32 bit word are output in order 2, 3, 0, 1
     I2S_PARALLEL_BITS_16 = 16,
     I2S_PARALLEL_BITS_32 = 32,
 } i2s_parallel_cfg_bits_t;
@@ -18,24 +19,54 @@ typedef struct {
     size_t size;
 } i2s_parallel_buffer_desc_t;
 
+#define I2S_PARALLEL_MAX_BUFFERS 3
+
 typedef struct {
     int gpio_bus[24];
     int gpio_clk;
     int clkspeed_hz;
     i2s_parallel_cfg_bits_t bits;
-    int desccount_a;
-    int desccount_b;
-    lldesc_t *lldesc_a;
-    lldesc_t *lldesc_b;
+    int bufcount;                                // number of buffers (DMA descriptor chains), max I2S_PARALLEL_MAX_BUFFERS
+    int desccount[I2S_PARALLEL_MAX_BUFFERS];     // number of descriptors in each chain
+    lldesc_t *lldesc[I2S_PARALLEL_MAX_BUFFERS];  // descriptor chains, DMA starts with the first one
+    int desccount_shared;                        // number of shared descriptors (or 0)
+    lldesc_t *lldesc_shared;                     // optional descriptors that all chains continue with (or NULL)
 } i2s_parallel_config_t;
 
 esp_err_t i2s_parallel_setup(i2s_dev_t *dev, const i2s_parallel_config_t *cfg);
+// the GPIO matrix output signal that i2s_parallel_setup() routes a bus bit (0..bits-1) to (the
+// mapping differs between the devices for 8 bits)
+int i2s_parallel_data_sig(i2s_dev_t *dev, i2s_parallel_cfg_bits_t bits, int bit);
 void i2s_parallel_flip_to_buffer(i2s_dev_t *dev, int bufid);
-void i2s_parallel_link_dma_desc(volatile lldesc_t *dmadesc, volatile lldesc_t *prevdmadesc, void *memory, size_t size);
+// move the buffer pointers of the shared descriptors that point into the memory from..from+size to
+// the same place in the memory at to (e.g. to the buffer flipped to)
+void i2s_parallel_move_shared_desc(i2s_dev_t *dev, const void *from, size_t size, const void *to);
+// change the clock divider by trim/63 (-63..63, negative is faster), 0 is the clock speed set by
+// i2s_parallel_setup() (e.g. to keep the output in sync with another device)
+void i2s_parallel_set_clock_trim(i2s_dev_t *dev, int trim);
+// multiply the clock divider (1 = the clock speed set by i2s_parallel_setup()), so that the clock
+// speed is divided by scale, the divider (about 80MHz / the clock speed, times scale) must not
+// exceed I2S_PARALLEL_CLOCK_DIV_MAX
+#define I2S_PARALLEL_CLOCK_DIV_MAX 254
+esp_err_t i2s_parallel_set_clock_div(i2s_dev_t *dev, int scale);
+// the descriptor (with the eof flag set) that caused the last shift complete callback
+static inline lldesc_t *i2s_parallel_eof_desc(i2s_dev_t *dev) {
+    return (lldesc_t *)dev->out_eof_des_addr;
+}
+// number of DMA descriptors needed for a buffer of the given size
+int i2s_parallel_dma_desc_count(size_t size);
+// link DMA descriptors (as many as needed, see i2s_parallel_dma_desc_count()) for a buffer, returns the number of descriptors used
+int i2s_parallel_link_dma_desc(volatile lldesc_t *dmadesc, volatile lldesc_t *prevdmadesc, void *memory, size_t size);
 void i2s_parallel_stop(i2s_dev_t *dev);
+// stop the output, keeping the configuration, the descriptors and the interrupt, and restart it
+// with the first descriptor of a buffer (e.g. the one flipped to last)
+void i2s_parallel_pause(i2s_dev_t *dev);
+void i2s_parallel_resume(i2s_dev_t *dev, int bufid);
 
-typedef int (*i2s_parallel_callback_t)(void);
-void i2s_parallel_set_shiftcomplete_cb(i2s_parallel_callback_t f);
+// called from the device's interrupt (for each descriptor with the eof flag set), returns pdTRUE
+// if a higher priority task has been woken, both devices can be used at the same time
+typedef int (*i2s_parallel_callback_t)(void *arg);
+void i2s_parallel_set_shiftcomplete_cb(i2s_dev_t *dev, i2s_parallel_callback_t f, void *arg);
 
 
 #endif
@@ -119,9 +119,23 @@
 #include <sdkconfig.h>
 #include <esp_log.h>
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <soc/gpio_sig_map.h>
+#if CONFIG_LEDDISPLAY_BUS_8BIT || CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE || CONFIG_LEDDISPLAY_OE_MCPWM
+#  include <soc/gpio_struct.h>
+#endif
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+#  include <driver/periph_ctrl.h>
+#  include <soc/mcpwm_struct.h>
+#  include <soc/gpio_periph.h>
+#  include <soc/io_mux_reg.h>
+#endif
 
 #include "val2pwm.h"
 #include "i2s_parallel.h"
+#include "leddisplay_enc.h"
+#include "leddisplay_priv.h"
 
 #include "leddisplay.h"
 
@@ -138,872 +152,2669 @@
 /* *********************************************************************************************** */
 // some useful macros
 
-#ifdef BIT
-#  undef BIT
-#endif
-#define BIT(bit) (1<<(bit))
 #define STRINGIFY(x) _STRINGIFY(x)
 #define _STRINGIFY(x) #x
 #define NUMOF(x) (sizeof(x)/sizeof(*(x)))
 
 /* *********************************************************************************************** */
-// I2S bus bits (corresponds to the GPIOs)
+// configuration (see also leddisplay.h and leddisplay_enc.h)
 
-// display panel upper half
-#define BIT_R1   BIT(0)   // CONFIG_LEDDISPLAY_R1_GPIO
-#define BIT_G1   BIT(1)   // CONFIG_LEDDISPLAY_G1_GPIO
-#define BIT_B1   BIT(2)   // CONFIG_LEDDISPLAY_B1_GPIO
+#if LEDDISPLAY_NEED_E_GPIO && (CONFIG_LEDDISPLAY_E_GPIO < 0)
+#  error Need CONFIG_LEDDISPLAY_E_GPIO > 0!
+#endif
 
-// display panel lower half
-#define BIT_R2   BIT(3)   // CONFIG_LEDDISPLAY_R2_GPIO
-#define BIT_G2   BIT(4)   // CONFIG_LEDDISPLAY_G2_GPIO
-#define BIT_B2   BIT(5)   // CONFIG_LEDDISPLAY_B2_GPIO
+#if CONFIG_LEDDISPLAY_I2S_FREQ_13MHZ
+#  define I2S_CLOCK_SPEED  13333334
+#elif CONFIG_LEDDISPLAY_I2S_FREQ_16MHZ
+#  define I2S_CLOCK_SPEED  16000000
+#elif CONFIG_LEDDISPLAY_I2S_FREQ_20MHZ
+#  define I2S_CLOCK_SPEED  20000000
+#elif CONFIG_LEDDISPLAY_I2S_FREQ_26MHZ
+#  define I2S_CLOCK_SPEED  26666667
+#else
+#  error This CONFIG_LEDDISPLAY_I2S_FREQ is not implemented!
+#endif
 
-// display panel control signals (latch, output enable)
-#define BIT_LAT  BIT(6)   // CONFIG_LEDDISPLAY_LAT_GPIO
-#define BIT_OE   BIT(7)   // CONFIG_LEDDISPLAY_OE_GPIO
+// the I2S peripherals that output the display data, the second display uses the other one
+#if CONFIG_LEDDISPLAY_I2S_PERIPH_0
+#  define DISP0_I2S_DEV           (&I2S0)
+#  define DISP1_I2S_DEV           (&I2S1)
+#else
+#  define DISP0_I2S_DEV           (&I2S1)
+#  define DISP1_I2S_DEV           (&I2S0)
+#endif
 
-// row address
-#define BIT_A    BIT(8)   // CONFIG_LEDDISPLAY_A_GPIO
-#define BIT_B    BIT(9)   // CONFIG_LEDDISPLAY_B_GPIO
-#define BIT_C    BIT(10)  // CONFIG_LEDDISPLAY_C_GPIO
-#define BIT_D    BIT(11)  // CONFIG_LEDDISPLAY_D_GPIO
-#define BIT_E    BIT(12)  // CONFIG_LEDDISPLAY_E_GPIO
+// the second display has no MCPWM output enable and no refresh synchronisation (see Kconfig)
+#if CONFIG_LEDDISPLAY_SECOND_DISP && (CONFIG_LEDDISPLAY_OE_MCPWM || CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE)
+#  error CONFIG_LEDDISPLAY_SECOND_DISP cannot be used with CONFIG_LEDDISPLAY_OE_MCPWM or CONFIG_LEDDISPLAY_SYNC!
+#endif
 
-// CONFIG_LEDDISPLAY_E_CLK
+#define NUM_FRAME_BUFFERS         CONFIG_LEDDISPLAY_NUM_FRAME_BUFFERS
 
-/* *********************************************************************************************** */
-// configuration (see also leddisplay.h)
+// the first of the sub-frames of a frame buffer (with temporal dithering, see DITHER_FRAMES), which
+// the DMA outputs one after the other, so that they count as one refresh (for flips, statistics,
+// presentation, etc.)
+#define FRAME_BUF(p_disp, fb)     (&(p_disp)->frames[(fb) * DITHER_FRAMES])
 
-#if CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN     // doesn't work
-#  warning CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN does not work
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+// note rows drawn to the current frame buffer (see leddisplay_pixel_update())
+#if CONFIG_LEDDISPLAY_PIXEL_PERSIST
+#  define PERSIST_DRAWN(p_disp, rows) (p_disp)->persist_drawn_rows |= (rows)
+#else
+#  define PERSIST_DRAWN(p_disp, rows) /* nothing */
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_32X16_8SCAN   // tested, works
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+// note rows of the current frame buffer written other than by leddisplay_enc_frame_rows(), whose
+// load must be measured (see s_current_update())
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+#  define LOAD_STALE(p_disp, rows) (p_disp)->frame_load_stale_rows[(p_disp)->current_frame] |= (rows)
+#else
+#  define LOAD_STALE(p_disp, rows) /* nothing */
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN   // doesn't work
-#  warning CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN does not work
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+// the layout of the bus words for the direct functions (see leddisplay.h)
+#if (LEDDISPLAY_DIRECT_R1 != BIT_R1) || (LEDDISPLAY_DIRECT_G1 != BIT_G1) || (LEDDISPLAY_DIRECT_B1 != BIT_B1) || \
+    (LEDDISPLAY_DIRECT_R2 != BIT_R2) || (LEDDISPLAY_DIRECT_G2 != BIT_G2) || (LEDDISPLAY_DIRECT_B2 != BIT_B2) || \
+    (LEDDISPLAY_DIRECT_WORD_IX(1) != BUS_WORD_IX(1)) || (LEDDISPLAY_DIRECT_WORD_IX(2) != BUS_WORD_IX(2))
+#  error LEDDISPLAY_DIRECT_* does not match the bus words!
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_32X32_16SCAN  // tested, works
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+// rows that have DMA descriptors of their own in each frame buffer, the descriptors for the other
+// rows are shared by all frame buffers and are moved to the next frame buffer at the end of the
+// refresh (while the DMA outputs the first row using the own descriptors of that frame buffer)
+#if CONFIG_LEDDISPLAY_SHARED_DESC
+#  define OWN_DESC_ROWS           1
+#else
+#  define OWN_DESC_ROWS           ROWS_PER_FRAME
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN   // doesn't work
-#  warning CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN does not work
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+// with the frame buffers in PSRAM (which the DMA cannot read, see CONFIG_LEDDISPLAY_PSRAM_RING)
+// there is one descriptor chain, whose rows use the row buffers of the ring one after the other
+// (ROWS_PER_FRAME must be a multiple of RING_ROWS for that)
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+#  define RING_ROWS               CONFIG_LEDDISPLAY_PSRAM_RING_ROWS
+#  define NUM_DESC_CHAINS         1
+#  define FRAME_BUF_CAPS          MALLOC_CAP_SPIRAM
+#  if ((RING_ROWS & (RING_ROWS - 1)) != 0) || (RING_ROWS > ROWS_PER_FRAME)
+#    error CONFIG_LEDDISPLAY_PSRAM_RING_ROWS must be a power of two and at most the number of rows!
+#  endif
+#  if CONFIG_LEDDISPLAY_SHARED_DESC
+#    error CONFIG_LEDDISPLAY_SHARED_DESC cannot be used with CONFIG_LEDDISPLAY_PSRAM_RING!
+#  endif
+#else
+#  define NUM_DESC_CHAINS         NUM_FRAME_BUFFERS
+#  define FRAME_BUF_CAPS          MALLOC_CAP_DMA
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_64X32_16SCAN  // tested, works
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+// refresh synchronisation: the slave changes its clock so that half of the phase error is gone
+// after the next refresh (the clock divider is about 80MHz / I2S_CLOCK_SPEED, see
+// i2s_parallel_setup(), a trim of 1 changes the refresh period by 1/63 of that), with a limited
+// slew, and it is in sync if the error is less than 1/32 of the refresh period
+#if CONFIG_LEDDISPLAY_SYNC_SLAVE
+#  define SYNC_CLOCK_DIV          ((80000000 / (I2S_CLOCK_SPEED + 1)) + 1)
+#  define SYNC_TRIM_MAX           16
+#endif
 
-#elif CONFIG_LEDDISPLAY_TYPE_64X64_32SCAN  // not tested
-#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
-#  define LEDDISPLAY_NEED_E_GPIO 1
-#  if CONFIG_LEDDISPLAY_E_GPIO < 0
-#    error Need CONFIG_LEDDISPLAY_E_GPIO > 0!
+// hardware output enable: the MCPWM timer counts at 160MHz (no prescalers) from the rising edge of
+// the latch (sync input, the latch is in the last word of each bitplane), and the OE pulse starts
+// after the latch word and the first word of the next bitplane (which the OE in the data blanks,
+// too, see leddisplay_enc_ctrl_bits()), and ends one word before the next latch at the latest, the
+// brightness value is the pulse width in timer ticks (0..BRIGHTNESS_MAX), without sync the timer
+// period (two latch periods) is the end of it
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+#  define OE_PWM_CLOCK_KHZ        160000
+#  define OE_PWM_TICKS(words)     (((words) * OE_PWM_CLOCK_KHZ) / (I2S_CLOCK_SPEED / 1000))
+#  define OE_PWM_START            OE_PWM_TICKS(2)
+#  define OE_PWM_PERIOD           OE_PWM_TICKS(2 * PIXELS_PER_LATCH)
+#  define BRIGHTNESS_MAX          (OE_PWM_TICKS(PIXELS_PER_LATCH - 1) - OE_PWM_START)
+#  if OE_PWM_PERIOD > 65535
+#    error The chain is too long for CONFIG_LEDDISPLAY_OE_MCPWM!
 #  endif
 #else
-#  error This CONFIG_LEDDISPLAY_TYPE is not implemented!
+#  define BRIGHTNESS_MAX          PIXELS_PER_LATCH
 #endif
 
-#if CONFIG_LEDDISPLAY_I2S_FREQ_13MHZ
-#  define I2S_CLOCK_SPEED  13333334
-#elif CONFIG_LEDDISPLAY_I2S_FREQ_16MHZ
-#  define I2S_CLOCK_SPEED  16000000
-#elif CONFIG_LEDDISPLAY_I2S_FREQ_20MHZ
-#  define I2S_CLOCK_SPEED  20000000
-#elif CONFIG_LEDDISPLAY_I2S_FREQ_26MHZ
-#  define I2S_CLOCK_SPEED  26666667
+// the highest LSB/MSB transition bit that leddisplay_init() may choose (the hardware output enable
+// shows all bitplanes for the same time, so the bitplanes up to the transition bit, which are shown
+// once per row, would not be weighted)
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+#  define TRANSITION_BIT_MAX      0
 #else
-#  error This CONFIG_LEDDISPLAY_I2S_FREQ is not implemented!
+#  define TRANSITION_BIT_MAX      (COLOR_DEPTH_BITS - 1)
 #endif
 
-#define NUM_FRAME_BUFFERS         2
-//#define OE_OFF_CLKS_AFTER_LATCH   1
-#define COLOR_DEPTH_BITS          8
-#define PIXELS_PER_LATCH          ((LEDDISPLAY_WIDTH * LEDDISPLAY_HEIGHT) / LEDDISPLAY_HEIGHT)
-#define ROWS_PER_FRAME            (LEDDISPLAY_HEIGHT / LEDDISPLAY_ROWS_IN_PARALLEL)
+// the output signal of the OE GPIO (see i2s_parallel_setup() and s_oe_pwm_init()), which
+// leddisplay_suspend() replaces by a constant high level (dark)
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+#  define OE_GPIO_SIG(p_disp)     PWM0_OUT0A_IDX
+#elif CONFIG_LEDDISPLAY_BUS_8BIT
+#  define OE_GPIO_SIG(p_disp)     i2s_parallel_data_sig((p_disp)->dev, I2S_PARALLEL_BITS_8, 7) // BIT_OE
+#else
+#  define OE_GPIO_SIG(p_disp)     i2s_parallel_data_sig((p_disp)->dev, I2S_PARALLEL_BITS_16, 7) // BIT_OE
+#endif
+
+// low-power mode: the I2S clock divider (about 80MHz / I2S_CLOCK_SPEED) can be multiplied by up to
+// LOW_POWER_DIV_MAX (see i2s_parallel_set_clock_div()), and with the hardware output enable the OE
+// pulse timing is multiplied by the same, which must fit the MCPWM timer (16 bits)
+#define LOW_POWER_CLOCK_DIV       ((80000000 / (I2S_CLOCK_SPEED + 1)) + 1)
+#if CONFIG_LEDDISPLAY_OE_MCPWM && ((65535 / OE_PWM_PERIOD) < ((I2S_PARALLEL_CLOCK_DIV_MAX + 1) / LOW_POWER_CLOCK_DIV))
+#  define LOW_POWER_DIV_MAX       (65535 / OE_PWM_PERIOD)
+#else
+#  define LOW_POWER_DIV_MAX       ((I2S_PARALLEL_CLOCK_DIV_MAX + 1) / LOW_POWER_CLOCK_DIV)
+#endif
+
+// with the 8 bit bus each row starts with a gap (see leddisplay_enc_row_gap()), the first part of
+// it (one latch period plus what fits into the I2S FIFO, 64 x 32 bits) ends with an interrupt that
+// sets the row address GPIOs, the rest of it is dark and gives the interrupt time to do so
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+#  define ROW_GAP_IRQ_WORDS       (PIXELS_PER_LATCH + 256)
+#  define ROW_GAP_WORDS           ((ROW_GAP_IRQ_WORDS + \
+    ((CONFIG_LEDDISPLAY_ROW_ADDR_MARGIN * (I2S_CLOCK_SPEED / 1000)) + 999) / 1000 + 3) & ~3)
+#endif
 
 /* *********************************************************************************************** */
 
-// RGB data for two rows of pixels, and address and control signals
-typedef struct row_bit_s
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+// GPIO output register values for the row address of a row
+typedef struct row_addr_gpio_s
 {
-    uint16_t pixel[LEDDISPLAY_WIDTH];
-} row_bit_t;
-// Note: sizeof(data) must be multiple of 32 bits, as DMA linked list buffer address pointer must be word-aligned
+    uint32_t set;
+    uint32_t clr;
+    uint32_t set1;
+    uint32_t clr1;
+} row_addr_gpio_t;
+#endif
 
-// row data for each bitplane
-typedef struct row_data_s
+// the GPIOs of a display
+typedef struct disp_gpio_s
 {
-    row_bit_t rowbits[COLOR_DEPTH_BITS];
-} row_data_t;
+    int r1, g1, b1, r2, g2, b2, a, b, c, d, e, lat, oe, clk;
+} disp_gpio_t;
 
-// full frame (display)
-typedef struct frame_s
+static const disp_gpio_t s_disp_gpios[LEDDISPLAY_NUM_DISPS] =
 {
-    row_data_t rowdata[ROWS_PER_FRAME];
-} frame_t;
-
-/* *********************************************************************************************** */
-
-// pixel data (bitplanes) is organized from LSB to MSB sequentially by row, from row 0 to row
-// matrixHeight/matrixRowsInParallel (two rows of pixels are refreshed in parallel)
-static frame_t *s_frames;
+    {
+        .r1  = CONFIG_LEDDISPLAY_R1_GPIO,  .g1 = CONFIG_LEDDISPLAY_G1_GPIO, .b1 = CONFIG_LEDDISPLAY_B1_GPIO,
+        .r2  = CONFIG_LEDDISPLAY_R2_GPIO,  .g2 = CONFIG_LEDDISPLAY_G2_GPIO, .b2 = CONFIG_LEDDISPLAY_B2_GPIO,
+        .a   = CONFIG_LEDDISPLAY_A_GPIO,   .b  = CONFIG_LEDDISPLAY_B_GPIO,  .c  = CONFIG_LEDDISPLAY_C_GPIO,
+        .d   = CONFIG_LEDDISPLAY_D_GPIO,   .e  = CONFIG_LEDDISPLAY_E_GPIO,
+        .lat = CONFIG_LEDDISPLAY_LAT_GPIO, .oe = CONFIG_LEDDISPLAY_OE_GPIO, .clk = CONFIG_LEDDISPLAY_CLK_GPIO,
+    },
+#if CONFIG_LEDDISPLAY_SECOND_DISP
+    {
+        .r1  = CONFIG_LEDDISPLAY_DISP1_R1_GPIO,  .g1 = CONFIG_LEDDISPLAY_DISP1_G1_GPIO, .b1 = CONFIG_LEDDISPLAY_DISP1_B1_GPIO,
+        .r2  = CONFIG_LEDDISPLAY_DISP1_R2_GPIO,  .g2 = CONFIG_LEDDISPLAY_DISP1_G2_GPIO, .b2 = CONFIG_LEDDISPLAY_DISP1_B2_GPIO,
+        .a   = CONFIG_LEDDISPLAY_DISP1_A_GPIO,   .b  = CONFIG_LEDDISPLAY_DISP1_B_GPIO,  .c  = CONFIG_LEDDISPLAY_DISP1_C_GPIO,
+        .d   = CONFIG_LEDDISPLAY_DISP1_D_GPIO,   .e  = CONFIG_LEDDISPLAY_DISP1_E_GPIO,
+        .lat = CONFIG_LEDDISPLAY_DISP1_LAT_GPIO, .oe = CONFIG_LEDDISPLAY_DISP1_OE_GPIO, .clk = CONFIG_LEDDISPLAY_DISP1_CLK_GPIO,
+    },
+#endif
+};
 
-static uint32_t s_current_frame;
-static int s_lsb_msb_transition_bit;
+// a display (see leddisplay_get_disp()), the functions below work on the one they are given, and the
+// I2S interrupt gets it as the callback argument (so it must be in internal RAM)
+struct leddisplay_s
+{
+    // number of the display, the I2S peripheral that outputs its data, and its GPIOs
+    int num;
+    i2s_dev_t *dev;
+    const disp_gpio_t *gpio;
+
+    // pixel data (bitplanes) is organized from LSB to MSB sequentially by row, from row 0 to row
+    // matrixHeight/matrixRowsInParallel (two rows of pixels are refreshed in parallel)
+    frame_t *frames;
+
+    // frame buffer that is currently being drawn to (back buffer), the one that is being displayed
+    // (front buffer), and the one that will be displayed as soon as the front buffer has been
+    // refreshed completely (or -1), the latter two change in the I2S interrupt
+    int current_frame;
+    volatile int front_frame;
+    volatile int pending_frame;
+    portMUX_TYPE frames_mux;
+
+    // frame buffers that were pending but have been replaced by a newer one since the last refresh
+    // interrupt (bit mask), the DMA may have started one of them nevertheless (if the flip to the
+    // newer one came too late), so they are not free until the next interrupt tells which one it started
+    volatile uint32_t retired_frames;
+
+    int lsb_msb_transition_bit;
+
+    // rows (bit mask of frame_t.rowdata[] indices) of each frame buffer that do not match the last
+    // frame rendered using the frame based API (see leddisplay_frame_update_rect())
+    uint32_t frame_stale_rows[NUM_FRAME_BUFFERS];
+
+    // the palette (bitplanes of the colours) for the indexed colour frames, allocated on first use
+    palette_bits_t *palette;
+
+#if CONFIG_LEDDISPLAY_PIXEL_PERSIST
+    // rows of each frame buffer that do not match the last updated frame, and the rows drawn to the
+    // current frame buffer since the last update (see leddisplay_pixel_update())
+    uint32_t persist_rows[NUM_FRAME_BUFFERS];
+    uint32_t persist_drawn_rows;
+#endif
 
-// DMA memory linked list descriptors
-lldesc_t *s_dmadesc_a;
-lldesc_t *s_dmadesc_b;
+    // DMA memory linked list descriptors (one chain per frame buffer, which continue with the shared
+    // descriptors, if any, see OWN_DESC_ROWS, or one chain for the ring, see NUM_DESC_CHAINS)
+    lldesc_t *dmadesc[NUM_DESC_CHAINS];
+    lldesc_t *dmadesc_shared;
+
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    // the ring of row buffers in DMA memory, the number of the row (counting all rows of all
+    // refreshes) that each row buffer has been filled with, the row that the DMA is outputting now,
+    // and the next row to fill (the interrupt wakes up the ring task at the start of each row, which
+    // then fills the row buffers ahead of the DMA, see s_ring_fill())
+    row_data_t *ring;
+    volatile uint32_t ring_tag[RING_ROWS];
+    volatile uint32_t ring_seq;
+    uint32_t ring_fill_seq;
+    TaskHandle_t ring_task;
+#  if !CONFIG_LEDDISPLAY_BUS_8BIT
+    // the last descriptor of the last row (i.e. the end of a refresh)
+    const lldesc_t *ring_last_desc;
+#  endif
+#endif
 
-// brightness level (value for data calculation, and percent used in API)
-static int s_brightness_val;
-static int s_brightness_percent;
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    // the row gap (used by all rows of all frame buffers), the row that is being output, and the
+    // GPIO output register values for the row address of each row
+    bus_word_t *row_gap;
+    int row_addr_row;
+    row_addr_gpio_t row_addr_gpio[ROWS_PER_FRAME];
+#endif
 
-// flush complete semaphore
-SemaphoreHandle_t s_shift_complete_sem;
-static IRAM_ATTR int s_shift_complete_sem_cb(void)
-{
-    static BaseType_t xHigherPriorityTaskWoken;
-    xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(s_shift_complete_sem, &xHigherPriorityTaskWoken );
-    return xHigherPriorityTaskWoken;
-}
+    // statistics (see leddisplay_get_stats()), counters are protected by frames_mux
+    leddisplay_stats_t stats;
+
+    // number and update time of the frame in each frame buffer, the last presentation, and the
+    // presentation callback (see leddisplay_set_present_cb()), protected by frames_mux
+    uint32_t frame_number[NUM_FRAME_BUFFERS];
+    int64_t frame_update_time[NUM_FRAME_BUFFERS];
+    leddisplay_present_t present;
+    leddisplay_present_cb_t present_cb;
+    void *present_cb_arg;
+
+    // time of the last end of frame interrupt [us], and reference count and time for the measured
+    // refresh rate, which start over with the first refresh after leddisplay_resume()
+    int64_t eof_time;
+    uint32_t eof_ref_count;
+    int64_t eof_ref_time;
+    bool eof_restart;
+
+    // the DMA is stopped (see leddisplay_suspend()), protected by frames_mux
+    bool suspended;
+
+    // refresh rate at the full I2S clock speed, and the clock divider scale (low-power mode, see
+    // leddisplay_set_low_power())
+    int refresh_rate_full;
+    int clock_div;
+
+    // brightness level (value for data calculation, and percent used in API)
+    int brightness_val;
+    int brightness_percent;
+
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    // the brightness value set by leddisplay_set_brightness(), and the highest one that the current
+    // limit allows for the frames displayed (brightness_val is the lower of the two), see
+    // s_current_update()
+    int brightness_set_val;
+    int brightness_limit_val;
+    int current_limit_ma;
+
+    // load (see leddisplay_enc_frame_rows()) of the rows of each frame buffer, and of all rows,
+    // and the rows whose load is not known yet (see LOAD_STALE())
+    uint32_t frame_load_rows[NUM_FRAME_BUFFERS][ROWS_PER_FRAME];
+    uint32_t frame_load[NUM_FRAME_BUFFERS];
+    uint32_t frame_load_stale_rows[NUM_FRAME_BUFFERS];
+#endif
 
-void leddisplay_pixel_update(int block)
-{
-    i2s_parallel_flip_to_buffer(&I2S1, s_current_frame);
-    s_current_frame = (s_current_frame + 1) % NUM_FRAME_BUFFERS;
+    // control signals templates
+    ctrl_bits_t ctrl_bits;
 
-    // wait until buffer is no longer used (I2S will continue using buffer until it's done and only
-    // then switch to the new one)
-    if (block != 0)
-    {
-        xSemaphoreTake(s_shift_complete_sem, portMAX_DELAY);
-    }
-    // 100 / portTICK_PERIOD_MS
-}
+    // held while the brightness (and the control signals templates) change, and while encoding into
+    // the frame buffers, so that the control signals written and patched are always the same
+    SemaphoreHandle_t ctrl_mutex;
 
-esp_err_t leddisplay_init(void)
-{
-    esp_err_t res = ESP_OK;
+    // flush complete semaphore
+    SemaphoreHandle_t shift_complete_sem;
 
-    INFO(STRINGIFY(LEDDISPLAY_WIDTH) "x" STRINGIFY(LEDDISPLAY_HEIGHT) " (" STRINGIFY(COLOR_DEPTH_BITS) "bits)");
-
-    DEBUG("GPIOs:"
-        " R1="  STRINGIFY(CONFIG_LEDDISPLAY_R1_GPIO)
-        " G1="  STRINGIFY(CONFIG_LEDDISPLAY_G1_GPIO)
-        " B1="  STRINGIFY(CONFIG_LEDDISPLAY_B1_GPIO)
-        " R2="  STRINGIFY(CONFIG_LEDDISPLAY_R2_GPIO)
-        " G2="  STRINGIFY(CONFIG_LEDDISPLAY_G2_GPIO)
-        " B2="  STRINGIFY(CONFIG_LEDDISPLAY_B2_GPIO)
-        " A="   STRINGIFY(CONFIG_LEDDISPLAY_A_GPIO)
-        " B="   STRINGIFY(CONFIG_LEDDISPLAY_B_GPIO)
-        " C="   STRINGIFY(CONFIG_LEDDISPLAY_C_GPIO)
-        " D="   STRINGIFY(CONFIG_LEDDISPLAY_D_GPIO)
-#if LEDDISPLAY_NEED_E_GPIO
-        " E="   STRINGIFY(CONFIG_LEDDISPLAY_E_GPIO)
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+    StaticSemaphore_t ctrl_mutex_buf;
+    StaticSemaphore_t shift_complete_sem_buf;
 #endif
-        " LAT=" STRINGIFY(CONFIG_LEDDISPLAY_LAT_GPIO)
-        " OE="  STRINGIFY(CONFIG_LEDDISPLAY_OE_GPIO)
-        " CLK=" STRINGIFY(CONFIG_LEDDISPLAY_CLK_GPIO));
 
-    // set default brightness 75%
-    leddisplay_set_brightness(75);
+#if CONFIG_LEDDISPLAY_RENDER_TASK
+    // copy of the submitted frame to render
+    leddisplay_frame_t *render_frame;
 
-    // allocate memory for the frame buffers, initialise frame buffers
-    if (res == ESP_OK)
-    {
-        DEBUG("frame buffers: size=%u (available total=%u, largest=%u)", NUM_FRAME_BUFFERS * sizeof(frame_t),
-            heap_caps_get_free_size(MALLOC_CAP_DMA), heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
-        s_frames = (frame_t *)heap_caps_malloc(NUM_FRAME_BUFFERS * sizeof(frame_t), MALLOC_CAP_DMA);
-        if (s_frames == NULL)
-        {
-            WARNING("framebuf alloc");
-            res = ESP_ERR_NO_MEM;
-        }
-        // clear frame buffers
-        else
-        {
-            const int old_brightness = leddisplay_set_brightness(0);
+    // given when the render task is ready to accept a new frame
+    SemaphoreHandle_t render_free_sem;
+#  if CONFIG_SUPPORT_STATIC_ALLOCATION
+    StaticSemaphore_t render_free_sem_buf;
+#  endif
 
-            s_current_frame = 1;
-            leddisplay_pixel_fill_rgb(0, 0, 0);
-            s_current_frame = 0;
-            leddisplay_pixel_fill_rgb(0, 0, 0);
+    TaskHandle_t render_task;
 
-            leddisplay_set_brightness(old_brightness);
-        }
-    }
+    // set to stop the render task, which gives render_done_sem when it ends
+    volatile bool render_stop;
+    SemaphoreHandle_t render_done_sem;
+#  if CONFIG_SUPPORT_STATIC_ALLOCATION
+    StaticSemaphore_t render_done_sem_buf;
+#  endif
 
-    // calculate the lowest LSBMSB_TRANSITION_BIT value that will fit in memory and achieves the minimal refresh rate
-    int numDescriptorsPerRow = 0;
-    int refreshRate = 0;
-    bool ramOkay = false;
-    bool refreshOkay = false;
-    if (res == ESP_OK)
-    {
-        int largestBlockFree = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
-        int totalFree        = heap_caps_get_free_size(MALLOC_CAP_DMA);
+    // frame callback (see leddisplay_set_frame_cb()), protected by frames_mux
+    leddisplay_frame_cb_t render_cb;
+    void *render_cb_arg;
+#endif
+};
 
-        s_lsb_msb_transition_bit = 0;
+static leddisplay_t s_disps[LEDDISPLAY_NUM_DISPS] =
+{
+    { .num = 0, .dev = DISP0_I2S_DEV, .gpio = &s_disp_gpios[0], .frames_mux = portMUX_INITIALIZER_UNLOCKED },
+#if CONFIG_LEDDISPLAY_SECOND_DISP
+    { .num = 1, .dev = DISP1_I2S_DEV, .gpio = &s_disp_gpios[1], .frames_mux = portMUX_INITIALIZER_UNLOCKED },
+#endif
+};
 
-        while (1)
-        {
-            ramOkay = false;
-            refreshOkay = false;
+static inline void s_ctrl_lock(leddisplay_t *p_disp)
+{
+    xSemaphoreTake(p_disp->ctrl_mutex, portMAX_DELAY);
+}
 
-            // calculate memory requirements for this value of s_lsb_msb_transition_bit
-            numDescriptorsPerRow = 1;
-            for (int i = s_lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
-            {
-                numDescriptorsPerRow += (1 << (i - s_lsb_msb_transition_bit - 1));
-            }
-            int ramRequired = numDescriptorsPerRow * ROWS_PER_FRAME * NUM_FRAME_BUFFERS * sizeof(lldesc_t);
+static inline void s_ctrl_unlock(leddisplay_t *p_disp)
+{
+    xSemaphoreGive(p_disp->ctrl_mutex);
+}
 
-            // calculate achievable refresh rate for this value of s_lsb_msb_transition_bit
-            int psPerClock = 1000000000000UL / I2S_CLOCK_SPEED;
-            int nsPerLatch = (PIXELS_PER_LATCH * psPerClock) / 1000;
-            // add time to shift out LSBs + LSB-MSB transition bit - this ignores fractions...
-            int nsPerRow = COLOR_DEPTH_BITS * nsPerLatch;
-            // add time to shift out MSBs
-            for (int i = s_lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
-            {
-                nsPerRow += (1 << (i - s_lsb_msb_transition_bit - 1)) * (COLOR_DEPTH_BITS - i) * nsPerLatch;
-            }
-            int nsPerFrame = nsPerRow * ROWS_PER_FRAME;
-            refreshRate = 1000000000UL / nsPerFrame;
+#if CONFIG_LEDDISPLAY_SYNC_MASTER
+// the level of the sync GPIO (toggled at the start of each refresh)
+static bool s_sync_level;
 
-            // check if that satisfies our requirements
-            if ( (ramRequired < largestBlockFree) && (ramRequired < (totalFree - CONFIG_LEDDISPLAY_PRESERVE_RAM_SIZE)) )
-            {
-                ramOkay = true;
-            }
-            if (refreshRate >= CONFIG_LEDDISPLAY_MIN_FRAME_RATE)
-            {
-                refreshOkay = true;
-            }
+static IRAM_ATTR void s_sync_refresh(leddisplay_t *p_disp, const int64_t now, const uint32_t period)
+{
+    s_sync_level = !s_sync_level;
+#  if CONFIG_LEDDISPLAY_SYNC_GPIO < 32
+    *(s_sync_level ? &GPIO.out_w1ts : &GPIO.out_w1tc) = (uint32_t)1 << CONFIG_LEDDISPLAY_SYNC_GPIO;
+#  else
+    *(s_sync_level ? &GPIO.out1_w1ts.val : &GPIO.out1_w1tc.val) = (uint32_t)1 << (CONFIG_LEDDISPLAY_SYNC_GPIO - 32);
+#  endif
+}
+#endif
 
-            // log summary
-            DEBUG("lsb_msb_transition_bit=%d: ramRequired=%u available=%u largest=%u %s, refreshRate=%d %s",
-                s_lsb_msb_transition_bit, ramRequired, totalFree, largestBlockFree, ramOkay ? ":-)" : ":-(",
-                refreshRate, refreshOkay ? ":-)" : ":-(");
+#if CONFIG_LEDDISPLAY_SYNC_SLAVE
+// time of the last edge of the master's sync signal (start of its refresh) [us]
+static volatile int64_t s_sync_master_time;
 
-            // stop if we're satisfied
-            if (ramOkay && refreshOkay)
-            {
-                break;
-            }
-            // try again if we can do more
-            if ( s_lsb_msb_transition_bit < (COLOR_DEPTH_BITS - 1) )
-            {
-                s_lsb_msb_transition_bit++;
-            }
-            // give up
-            else
-            {
-                break;
-            }
-        }
+static IRAM_ATTR void s_sync_master_isr(void *arg)
+{
+    s_sync_master_time = esp_timer_get_time();
+}
 
-        // are we happy?
-        if (ramOkay && refreshOkay)
+// adjust the clock for the phase error of the refresh that starts now, must be called with
+// frames_mux held
+static IRAM_ATTR void s_sync_refresh(leddisplay_t *p_disp, const int64_t now, const uint32_t period)
+{
+    const int64_t master_time = s_sync_master_time;
+    const int64_t since = now - master_time;
+    int trim = 0;
+    bool locked = false;
+    if ( (period > 0) && (master_time != 0) && (since < (2 * (int64_t)period)) )
+    {
+        int32_t error = since;
+        if (error > (int32_t)(period / 2))
         {
-            DEBUG("finally: lsb_msb_transition_bit=%d/%d, rows=%d, RAM=%d, refresh=%d", s_lsb_msb_transition_bit, COLOR_DEPTH_BITS - 1,
-                ROWS_PER_FRAME, NUM_FRAME_BUFFERS * numDescriptorsPerRow * ROWS_PER_FRAME * sizeof(lldesc_t), refreshRate);
+            error -= period;
         }
-        // give up if we could not meet the RAM and refresh rate requirements
-        else
+        trim = -(error * (63 * SYNC_CLOCK_DIV)) / (2 * (int32_t)period);
+        if (trim > SYNC_TRIM_MAX)
         {
-            if (!ramOkay)
-            {
-                WARNING("desc alloc");
-                res = ESP_ERR_NO_MEM;
-            }
-            if (!refreshOkay)
-            {
-                WARNING("refresh");
-                res = ESP_FAIL;
-            }
+            trim = SYNC_TRIM_MAX;
         }
-    }
-
-    // malloc the DMA linked list descriptors that i2s_parallel will need
-    int desccount = numDescriptorsPerRow * ROWS_PER_FRAME;
-    if (res == ESP_OK)
-    {
-        s_dmadesc_a = (lldesc_t *)heap_caps_malloc(desccount * sizeof(lldesc_t), MALLOC_CAP_DMA);
-        if (s_dmadesc_a == NULL)
+        else if (trim < -SYNC_TRIM_MAX)
         {
-            WARNING("desc a alloc");
-            res = ESP_ERR_NO_MEM;
+            trim = -SYNC_TRIM_MAX;
         }
-        s_dmadesc_b = (lldesc_t *)heap_caps_malloc(desccount * sizeof(lldesc_t), MALLOC_CAP_DMA);
-        if (s_dmadesc_b == NULL)
+        const uint32_t abs_error = error < 0 ? -error : error;
+        locked = abs_error < (period / 32);
+        p_disp->stats.sync_phase_error = error;
+        if (abs_error > p_disp->stats.sync_phase_error_max)
         {
-            WARNING("desc b alloc");
-            res = ESP_ERR_NO_MEM;
+            p_disp->stats.sync_phase_error_max = abs_error;
         }
     }
-
-    //heap_caps_print_heap_info(MALLOC_CAP_DMA);
-
-    // fill DMA linked lists for both frames
-    if (res == ESP_OK)
+    if (trim != p_disp->stats.sync_clock_trim)
     {
-        lldesc_t *prevdmadesca = NULL;
-        lldesc_t *prevdmadescb = NULL;
-        int currentDescOffset = 0;
-        for (int j = 0; j < ROWS_PER_FRAME; j++)
-        {
-            // first set of data is LSB through MSB, single pass - all color bits are displayed once, which takes care of everything below and inlcluding LSBMSB_TRANSITION_BIT
-            // TODO: size must be less than DMA_MAX - worst case for SmartMatrix Library: 16-bpp with 256 pixels per row would exceed this, need to break into two
-            i2s_parallel_link_dma_desc(&s_dmadesc_a[currentDescOffset], prevdmadesca, &(s_frames[0].rowdata[j].rowbits[0].pixel), sizeof(row_bit_t) * COLOR_DEPTH_BITS);
-            prevdmadesca = &s_dmadesc_a[currentDescOffset];
-            i2s_parallel_link_dma_desc(&s_dmadesc_b[currentDescOffset], prevdmadescb, &(s_frames[1].rowdata[j].rowbits[0].pixel), sizeof(row_bit_t) * COLOR_DEPTH_BITS);
-            prevdmadescb = &s_dmadesc_b[currentDescOffset];
-            currentDescOffset++;
-            //DEBUG("row %d:", j);
-
-            for (int i = s_lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
-            {
-                // binary time division setup: we need 2 of bit (LSBMSB_TRANSITION_BIT + 1) four of (LSBMSB_TRANSITION_BIT + 2), etc
-                // because we sweep through to MSB each time, it divides the number of times we have to sweep in half (saving linked list RAM)
-                // we need 2^(i - LSBMSB_TRANSITION_BIT - 1) == 1 << (i - LSBMSB_TRANSITION_BIT - 1) passes from i to MSB
-                //DEBUG("buffer %d: repeat %d times, size: %d, from %d - %d", nextBufdescIndex, 1<<(i - LSBMSB_TRANSITION_BIT - 1), (COLOR_DEPTH_BITS - i), i, COLOR_DEPTH_BITS-1);
-                for (int k = 0; k < (1 << (i - s_lsb_msb_transition_bit - 1)); k++)
-                {
-                    i2s_parallel_link_dma_desc(&s_dmadesc_a[currentDescOffset], prevdmadesca, &(s_frames[0].rowdata[j].rowbits[i].pixel), sizeof(row_bit_t) * (COLOR_DEPTH_BITS - i));
-                    prevdmadesca = &s_dmadesc_a[currentDescOffset];
-                    i2s_parallel_link_dma_desc(&s_dmadesc_b[currentDescOffset], prevdmadescb, &(s_frames[1].rowdata[j].rowbits[i].pixel), sizeof(row_bit_t) * (COLOR_DEPTH_BITS - i));
-                    prevdmadescb = &s_dmadesc_b[currentDescOffset];
-                    currentDescOffset++;
-                    //DEBUG("i %d, j %d, k %d", i, j, k);
-                }
-            }
-        }
-        // end markers
-        s_dmadesc_a[desccount - 1].eof = 1;
-        s_dmadesc_b[desccount - 1].eof = 1;
-        s_dmadesc_a[desccount - 1].qe.stqe_next = (lldesc_t *)&s_dmadesc_a[0];
-        s_dmadesc_b[desccount - 1].qe.stqe_next = (lldesc_t *)&s_dmadesc_b[0];
+        i2s_parallel_set_clock_trim(p_disp->dev, trim);
+        p_disp->stats.sync_clock_trim = trim;
     }
-
-    // flush complete semaphore
-    if (res == ESP_OK)
-    {
-#if CONFIG_SUPPORT_STATIC_ALLOCATION
-        static StaticSemaphore_t sem;
-        s_shift_complete_sem = xSemaphoreCreateBinaryStatic(&sem);
-#else
-        s_shift_complete_sem = xSemaphoreCreateBinary();
+    p_disp->stats.sync_locked = locked ? 1 : 0;
+}
 #endif
-        i2s_parallel_set_shiftcomplete_cb(s_shift_complete_sem_cb);
-    }
 
-    // initialise parallel I2S
-    if (res == ESP_OK)
-    {
-        i2s_parallel_config_t cfg =
-        {
-            .gpio_bus =
-            {
-                CONFIG_LEDDISPLAY_R1_GPIO,   //  0 BIT_R1
-                CONFIG_LEDDISPLAY_G1_GPIO,   //  1 BIT_G1
-                CONFIG_LEDDISPLAY_B1_GPIO,   //  2 BIT_B1
-                CONFIG_LEDDISPLAY_R2_GPIO,   //  3 BIT_R2
-                CONFIG_LEDDISPLAY_G2_GPIO,   //  4 BIT_G2
-                CONFIG_LEDDISPLAY_B2_GPIO,   //  5 BIT_B2
-                CONFIG_LEDDISPLAY_LAT_GPIO,  //  6 BIT_LAT
-                CONFIG_LEDDISPLAY_OE_GPIO,   //  7 BIT_OE
-                CONFIG_LEDDISPLAY_A_GPIO,    //  8 BIT_A
-                CONFIG_LEDDISPLAY_B_GPIO,    //  9 BIT_B
-                CONFIG_LEDDISPLAY_C_GPIO,    // 10 BIT_C
-                CONFIG_LEDDISPLAY_D_GPIO,    // 11 BIT_D
-#if LEDDISPLAY_NEED_E_GPIO
-                CONFIG_LEDDISPLAY_E_GPIO,    // 12 BIT_E
+// the refresh interrupt of a display (the callback argument)
+static IRAM_ATTR int s_shift_complete_sem_cb(void *arg)
+{
+    leddisplay_t *p_disp = (leddisplay_t *)arg;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    // the interrupt comes from the first descriptor of a frame buffer (the start of a refresh, and
+    // the frame buffer that the DMA is outputting now), and with the 8 bit bus or the ring also
+    // from the other rows
+    const lldesc_t *eof_desc = i2s_parallel_eof_desc(p_disp->dev);
+    bool refresh = false;
+    int refresh_fb = -1;
+#if CONFIG_LEDDISPLAY_PSRAM_RING && !CONFIG_LEDDISPLAY_BUS_8BIT
+    // a row has been output, and the next one starts, the last row is the end of a refresh
+    refresh = eof_desc == p_disp->ring_last_desc;
 #else
-                -1,
-#endif
-                -1,                          // 13
-                -1,                          // 14
-                -1,                          // 15
-            },
-            .gpio_clk    = CONFIG_LEDDISPLAY_CLK_GPIO,
-            .clkspeed_hz = I2S_CLOCK_SPEED,
-            .bits        = I2S_PARALLEL_BITS_16,
-            .desccount_a = desccount,
-            .desccount_b = desccount,
-            .lldesc_a    = s_dmadesc_a,
-            .lldesc_b    = s_dmadesc_b,
-        };
-
-        esp_err_t res2 = i2s_parallel_setup(&I2S1, &cfg);
-        if (res2 != ESP_OK)
+    for (int fb = 0; fb < NUM_DESC_CHAINS; fb++)
+    {
+        if (eof_desc == p_disp->dmadesc[fb])
         {
-            WARNING("i2s fail (%d, %s)", res, esp_err_to_name(res));
-            res = ESP_FAIL;
+            refresh = true;
+            refresh_fb = fb;
         }
     }
+#endif
 
-    if (res == ESP_OK)
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    // count the row that starts now (which is the first row of a refresh after the last row),
+    // check that it made it into the ring in time, and let the ring task refill the row buffer of
+    // the previous row
+    uint32_t seq = p_disp->ring_seq + 1;
+    if (refresh)
     {
-        INFO("init done");
+        seq = (seq + (ROWS_PER_FRAME - 1)) & ~(uint32_t)(ROWS_PER_FRAME - 1);
     }
-    // clean up on error
-    else
+    p_disp->ring_seq = seq;
+    if (p_disp->ring_tag[seq % RING_ROWS] != seq)
     {
-        WARNING("init fail: %s (%d)", esp_err_to_name(res), res);
-        leddisplay_shutdown();
+        portENTER_CRITICAL_ISR(&p_disp->frames_mux);
+        p_disp->stats.ring_underruns++;
+        portEXIT_CRITICAL_ISR(&p_disp->frames_mux);
     }
-    return res;
-}
+    vTaskNotifyGiveFromISR(p_disp->ring_task, &xHigherPriorityTaskWoken);
+#endif
 
-void leddisplay_shutdown(void)
-{
-    INFO("shutdown");
-    i2s_parallel_stop(&I2S1);
-    if (s_frames != NULL)
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    if (refresh)
     {
-        heap_caps_free(s_frames);
-        s_frames = NULL;
+        p_disp->row_addr_row = 0;
     }
-    if (s_dmadesc_a != NULL)
+    else if (p_disp->row_addr_row < (ROWS_PER_FRAME - 1))
     {
-        heap_caps_free(s_dmadesc_a);
-        s_dmadesc_a = NULL;
+        p_disp->row_addr_row++;
     }
-    if (s_dmadesc_b != NULL)
+    const row_addr_gpio_t *p_gpio = &p_disp->row_addr_gpio[p_disp->row_addr_row];
+    GPIO.out_w1ts = p_gpio->set;
+    GPIO.out_w1tc = p_gpio->clr;
+    GPIO.out1_w1ts.val = p_gpio->set1;
+    GPIO.out1_w1tc.val = p_gpio->clr1;
+#endif
+    if (!refresh)
     {
-        heap_caps_free(s_dmadesc_b);
-        s_dmadesc_b = NULL;
+        return xHigherPriorityTaskWoken;
     }
-#if CONFIG_SUPPORT_STATIC_ALLOCATION
-#else
-    vSemaphoreDelete(s_shift_complete_sem);
-#endif
-
-
-}
 
-/* *********************************************************************************************** */
-
-int leddisplay_set_brightness(int brightness)
-{
-    const int last_brightness_percent = s_brightness_percent;
+    const int64_t now = esp_timer_get_time();
 
-    if (brightness <= 0)
+    // the frame buffer that the DMA started with is the front buffer now (the pending one, unless
+    // the flip came too late for this refresh), the previous front buffer is free (with the ring
+    // the ring task does this, see s_ring_fill()), unless this interrupt came in too late to be
+    // handled before leddisplay_suspend() (which does this for the stopped DMA)
+    portENTER_CRITICAL_ISR(&p_disp->frames_mux);
+    if (p_disp->suspended)
     {
-        s_brightness_val = 0;
-        s_brightness_percent = 0;
+        portEXIT_CRITICAL_ISR(&p_disp->frames_mux);
+        return xHigherPriorityTaskWoken;
     }
-    else if (brightness >= 100)
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    refresh_fb = p_disp->front_frame;
+#else
+    if (refresh_fb != p_disp->front_frame)
     {
-        s_brightness_val = LEDDISPLAY_WIDTH;
-        s_brightness_percent = 100;
+#  if CONFIG_LEDDISPLAY_SHARED_DESC
+        // the DMA is outputting the first row of the new frame buffer now, the other rows must come
+        // from it as well
+        i2s_parallel_move_shared_desc(p_disp->dev, FRAME_BUF(p_disp, p_disp->front_frame), sizeof(frame_t), FRAME_BUF(p_disp, refresh_fb));
+#  endif
+        p_disp->front_frame = refresh_fb;
     }
-    else
+    if (refresh_fb == p_disp->pending_frame)
     {
-        s_brightness_percent = brightness;
-
-        // scale brightness percent to value for this display: 0..100% --> 0..LEDDISPLAY_WIDTH
-        const int brightness_val = ((((1000 * LEDDISPLAY_WIDTH) * brightness) + 500) / 1000) / 100;
-
-#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT
+        p_disp->pending_frame = -1;
+    }
+    // (a replaced frame that the DMA started is displayed after all)
+    else if ((p_disp->retired_frames & BIT(refresh_fb)) != 0)
+    {
+        p_disp->stats.frames_dropped--;
+    }
+    p_disp->retired_frames = 0;
+#endif
 
-        const int f = 256 / LEDDISPLAY_WIDTH;
-        s_brightness_val = val2pwm(brightness_val * f) / f;
+    // the first refresh (after leddisplay_init() or leddisplay_resume()) has no previous one
+    const bool first = (p_disp->stats.refresh_count == 0) || p_disp->eof_restart;
+    p_disp->eof_restart = false;
 
-#elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    // keep in sync with other displays
+#if CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE
+    s_sync_refresh(p_disp, now, !first ? (uint32_t)(now - p_disp->eof_time) : 0);
+#endif
 
-        const int f = 256 / LEDDISPLAY_WIDTH;
-        const int lut = val2pwm(brightness_val * f) / f;
-        if (lut <= 0)
+    // measure refresh
+    if (!first)
+    {
+        const uint32_t period = now - p_disp->eof_time;
+        if ( (p_disp->stats.refresh_period_min == 0) || (period < p_disp->stats.refresh_period_min) )
         {
-            s_brightness_val = 1;
+            p_disp->stats.refresh_period_min = period;
         }
-        else
+        if (period > p_disp->stats.refresh_period_max)
         {
-            s_brightness_val = lut;
+            p_disp->stats.refresh_period_max = period;
         }
-
-#else
-        s_brightness_val = brightness_val;
-#endif
     }
+    else
+    {
+        p_disp->eof_ref_time = now;
+        p_disp->eof_ref_count = p_disp->stats.refresh_count + 1;
+    }
+    p_disp->eof_time = now;
+    p_disp->stats.refresh_count++;
 
-    return last_brightness_percent;
+    // a new frame is being displayed now
+    const bool present = p_disp->frame_number[refresh_fb] != p_disp->present.frame;
+    if (present)
+    {
+        p_disp->present.frame   = p_disp->frame_number[refresh_fb];
+        p_disp->present.refresh = p_disp->stats.refresh_count;
+        p_disp->present.time    = now;
+        p_disp->present.latency = now - p_disp->frame_update_time[refresh_fb];
+        p_disp->stats.frames_presented++;
+        if (p_disp->present.latency > p_disp->stats.present_latency_max)
+        {
+            p_disp->stats.present_latency_max = p_disp->present.latency;
+        }
+    }
+    const leddisplay_present_t present_info = p_disp->present;
+    const leddisplay_present_cb_t present_cb = p_disp->present_cb;
+    void *present_cb_arg = p_disp->present_cb_arg;
+    portEXIT_CRITICAL_ISR(&p_disp->frames_mux);
+
+    if (present && (present_cb != NULL))
+    {
+        present_cb(&present_info, present_cb_arg);
+    }
+
+    xSemaphoreGiveFromISR(p_disp->shift_complete_sem, &xHigherPriorityTaskWoken );
+    return xHigherPriorityTaskWoken;
 }
 
-int leddisplay_get_brightness(void)
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+// fill the row buffers of the ring ahead of the row that the DMA is outputting now (rows that are
+// too late are skipped), using the front buffer, which is replaced by the pending frame (if any)
+// at the first row of each refresh (the previous front buffer is free then)
+static void s_ring_fill(leddisplay_t *p_disp)
 {
-    return s_brightness_percent;
-}
+    const uint32_t seq = p_disp->ring_seq;
+    int lead = (int32_t)(p_disp->ring_fill_seq - seq);
+    if (lead <= 0)
+    {
+        p_disp->ring_fill_seq = seq + 1;
+        lead = 0;
+    }
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    if (lead < p_disp->stats.ring_lead_min)
+    {
+        p_disp->stats.ring_lead_min = lead;
+    }
+    portEXIT_CRITICAL(&p_disp->frames_mux);
 
-/* *********************************************************************************************** */
+    while ((int32_t)(p_disp->ring_fill_seq - seq) < RING_ROWS)
+    {
+        const uint32_t fill = p_disp->ring_fill_seq;
+        const int row = fill % ROWS_PER_FRAME;
+        if (row == 0)
+        {
+            portENTER_CRITICAL(&p_disp->frames_mux);
+            if (p_disp->pending_frame >= 0)
+            {
+                p_disp->front_frame = p_disp->pending_frame;
+                p_disp->pending_frame = -1;
+            }
+            portEXIT_CRITICAL(&p_disp->frames_mux);
+        }
+        memcpy(&p_disp->ring[fill % RING_ROWS], &p_disp->frames[p_disp->front_frame].rowdata[row], sizeof(row_data_t));
+        p_disp->ring_tag[fill % RING_ROWS] = fill;
+        p_disp->ring_fill_seq = fill + 1;
+    }
+}
 
-void leddisplay_pixel_xy_rgb(uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+static void s_ring_task_func(void *p_param)
 {
-    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    leddisplay_t *p_disp = (leddisplay_t *)p_param;
+    while (true)
     {
-        return;
+        // wait for the start of the next row
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        s_ring_fill(p_disp);
     }
+}
 
-    // What half of the HUB75 panel are we painting to?
-    bool paint_top_half = true;
-    if ( y_coord > (ROWS_PER_FRAME - 1) ) // co-ords start at zero, y_coord = 15 = 16 (rows per frame)
+// fill the ring with the first rows of the front buffer (before the DMA starts)
+static void s_ring_prefill(leddisplay_t *p_disp)
+{
+    for (uint32_t fill = 0; fill < RING_ROWS; fill++)
     {
-        y_coord -= ROWS_PER_FRAME; // if it's 16, subtract 16. Array position 0 again.
-        paint_top_half = false;
+        memcpy(&p_disp->ring[fill], &p_disp->frames[p_disp->front_frame].rowdata[fill], sizeof(row_data_t));
+        p_disp->ring_tag[fill] = fill;
     }
+    p_disp->ring_fill_seq = RING_ROWS;
+#  if CONFIG_LEDDISPLAY_BUS_8BIT
+    // the first interrupt comes at the start of the first row
+    p_disp->ring_seq = UINT32_MAX;
+#  else
+    // the first interrupt comes at the end of the first row
+    p_disp->ring_seq = 0;
+#  endif
+}
 
-#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
-    red   = val2pwm(red);
-    green = val2pwm(green);
-    blue  = val2pwm(blue);
-#endif
+// wait until the ring task is done with the last row (after the DMA has stopped)
+static void s_ring_task_idle(leddisplay_t *p_disp)
+{
+    while (eTaskGetState(p_disp->ring_task) != eBlocked)
+    {
+        vTaskDelay(1);
+    }
+}
 
-    row_data_t *row_data = &s_frames[s_current_frame].rowdata[y_coord];
+// prefill the ring, and start the ring task (before the DMA starts)
+static esp_err_t s_ring_task_start(leddisplay_t *p_disp)
+{
+    s_ring_prefill(p_disp);
+    p_disp->stats.ring_rows     = RING_ROWS;
+    p_disp->stats.ring_lead_min = RING_ROWS - 1;
 
-    for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
+    if (xTaskCreatePinnedToCore(s_ring_task_func, p_disp->num == 0 ? "leddisplay_ring" : "leddisplay_ring1",
+            2048 / sizeof(StackType_t), p_disp, CONFIG_LEDDISPLAY_PSRAM_RING_TASK_PRIO, &p_disp->ring_task,
+            CONFIG_LEDDISPLAY_PSRAM_RING_TASK_CORE) != pdPASS)
     {
-        // the destination for the pixel bitstream
-        row_bit_t *rowbits = &row_data->rowbits[bitplane_ix]; //matrixUpdateFrames location to write to uint16_t's
+        WARNING("ring task");
+        p_disp->ring_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
 
-        int v = 0; // the output bitstream
+// stop the ring task (after the DMA has stopped)
+static void s_ring_task_stop(leddisplay_t *p_disp)
+{
+    if (p_disp->ring_task != NULL)
+    {
+        s_ring_task_idle(p_disp);
+        vTaskDelete(p_disp->ring_task);
+        p_disp->ring_task = NULL;
+    }
+}
+#endif // CONFIG_LEDDISPLAY_PSRAM_RING
 
-        // if there is no latch to hold address, output ADDX lines directly to GPIO and latch data at end of cycle
-        // normally output current rows ADDX, special case for LSB, output previous row's ADDX (as previous row is being displayed for one latch cycle)
-        int gpioRowAddress = (bitplane_ix == 0) ? y_coord - 1 : y_coord;
+// current estimate (see below)
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+static void s_current_update(leddisplay_t *p_disp);
+#endif
 
-        if (gpioRowAddress & BIT(0)) { v |= BIT_A; } // 1
-        if (gpioRowAddress & BIT(1)) { v |= BIT_B; } // 2
-        if (gpioRowAddress & BIT(2)) { v |= BIT_C; } // 4
-        if (gpioRowAddress & BIT(3)) { v |= BIT_D; } // 8
-#if LEDDISPLAY_NEED_E_GPIO
-        if (gpioRowAddress & BIT(4)) { v |= BIT_E; } // 16
+// render task (see end of file)
+#if CONFIG_LEDDISPLAY_RENDER_TASK
+static esp_err_t s_render_task_start(leddisplay_t *p_disp);
+static void s_render_task_stop(leddisplay_t *p_disp);
 #endif
 
-        // need to disable OE after latch to hide row transition
-        if (x_coord == 0)
+// find a frame buffer that is neither being displayed nor waiting to be displayed (nor may have
+// been started by the DMA, see retired_frames) (or -1), must be called with frames_mux held
+static int s_find_free_frame(leddisplay_t *p_disp)
+{
+    for (int ix = 0; ix < NUM_FRAME_BUFFERS; ix++)
+    {
+        if ( (ix != p_disp->front_frame) && (ix != p_disp->pending_frame) && ((p_disp->retired_frames & BIT(ix)) == 0) )
         {
-            v |= BIT_OE;
+            return ix;
         }
+    }
+    return -1;
+}
 
-        // drive latch while shifting out last bit of RGB data
-        // need to turn off OE one clock before latch, otherwise can get ghosting
-        if (x_coord == (PIXELS_PER_LATCH - 1))
-        {
-            v |= (BIT_LAT | BIT_OE);
-        }
+// wait for the end of the current refresh, and measure how long it took for us to wake up
+static bool s_wait_refresh_timeout(leddisplay_t *p_disp, const TickType_t timeout)
+{
+    if (xSemaphoreTake(p_disp->shift_complete_sem, timeout) != pdTRUE)
+    {
+        return false;
+    }
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    const uint32_t latency = now - p_disp->eof_time;
+    int bin = 0;
+    while ( (bin < (LEDDISPLAY_STATS_LATENCY_BINS - 1)) && (latency >= ((uint32_t)16 << bin)) )
+    {
+        bin++;
+    }
+    p_disp->stats.wakeup_latency[bin]++;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    return true;
+}
+
+static void s_wait_refresh(leddisplay_t *p_disp)
+{
+    s_wait_refresh_timeout(p_disp, portMAX_DELAY);
+}
 
-        // turn off OE after brightness value is reached when displaying MSBs
-        // MSBs always output normal brightness
-        // LSB (bitplane_ix == 0) outputs normal brightness as MSB from previous row is being displayed
-        if ( ((bitplane_ix == 0) || (bitplane_ix > s_lsb_msb_transition_bit)) && (x_coord >= s_brightness_val) )
+// the current frame buffer is being displayed, waiting to be displayed, or may have been started
+// by the DMA (see retired_frames)
+static inline bool s_current_frame_busy(leddisplay_t *p_disp)
+{
+    return (p_disp->current_frame == p_disp->front_frame) || (p_disp->current_frame == p_disp->pending_frame) ||
+        ((p_disp->retired_frames & BIT(p_disp->current_frame)) != 0);
+}
+
+// wait until the current frame buffer is no longer used (I2S will continue using buffer until it's
+// done and only then switch to the new one)
+static void s_wait_current_frame(leddisplay_t *p_disp)
+{
+    if (s_current_frame_busy(p_disp))
+    {
+        const int64_t t0 = esp_timer_get_time();
+        while (s_current_frame_busy(p_disp))
         {
-            v |= BIT_OE; // for Brightness
+            s_wait_refresh(p_disp);
         }
+        const int64_t dt = esp_timer_get_time() - t0;
+        portENTER_CRITICAL(&p_disp->frames_mux);
+        p_disp->stats.blocked_time += dt;
+        portEXIT_CRITICAL(&p_disp->frames_mux);
+    }
+}
+
+// while the DMA is stopped the pending frame is the front buffer right away (the refresh starts
+// with it on resume, and no other buffer is in use), must be called with frames_mux held
+static void s_flip_suspended(leddisplay_t *p_disp)
+{
+    p_disp->retired_frames = 0;
+    if (p_disp->pending_frame >= 0)
+    {
+#if CONFIG_LEDDISPLAY_SHARED_DESC
+        i2s_parallel_move_shared_desc(p_disp->dev, FRAME_BUF(p_disp, p_disp->front_frame), sizeof(frame_t), FRAME_BUF(p_disp, p_disp->pending_frame));
+#endif
+        p_disp->front_frame = p_disp->pending_frame;
+        p_disp->pending_frame = -1;
+    }
+}
+
+void leddisplay_disp_pixel_update(leddisplay_t *p_disp, int block)
+{
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    // the frame buffer has (also) been written by the pixel based, indexed colour or direct
+    // functions, limit the brightness for it before it is displayed
+    if (p_disp->frame_load_stale_rows[p_disp->current_frame] != 0)
+    {
+        s_ctrl_lock(p_disp);
+        s_current_update(p_disp);
+        s_ctrl_unlock(p_disp);
+    }
+#endif
 
-        // special case for the bits *after* LSB through (s_lsb_msb_transition_bit) - OE is output
-        // after data is shifted, so need to set OE to fractional brightness
-        if (bitplane_ix && (bitplane_ix <= s_lsb_msb_transition_bit))
+    // forget any previous end of refresh, so that we can tell when the new buffer is being used
+    xSemaphoreTake(p_disp->shift_complete_sem, 0);
+    const int64_t now = esp_timer_get_time();
+
+    // display the current frame after the end of the current refresh, replacing a previously
+    // updated frame that hasn't been displayed yet, and continue drawing into a free buffer (if
+    // there's none, which is the case with two buffers, use the buffer that is being displayed
+    // now, it will become free at the end of the current refresh, or, if that is the updated one
+    // again, the replaced one, which becomes free at the next refresh interrupt)
+    portENTER_CRITICAL(&p_disp->frames_mux);
+#if !CONFIG_LEDDISPLAY_PSRAM_RING
+    i2s_parallel_flip_to_buffer(p_disp->dev, p_disp->current_frame);
+#endif
+    p_disp->stats.frames_submitted++;
+    if (p_disp->pending_frame >= 0)
+    {
+        p_disp->stats.frames_dropped++;
+#if !CONFIG_LEDDISPLAY_PSRAM_RING
+        p_disp->retired_frames |= BIT(p_disp->pending_frame);
+#endif
+    }
+    p_disp->frame_number[p_disp->current_frame] = p_disp->stats.frames_submitted;
+    p_disp->frame_update_time[p_disp->current_frame] = now;
+    p_disp->pending_frame = p_disp->current_frame;
+    if (p_disp->suspended)
+    {
+        s_flip_suspended(p_disp);
+    }
+#if CONFIG_LEDDISPLAY_PIXEL_PERSIST
+    const int updated_frame = p_disp->current_frame;
+#endif
+    int next_frame = s_find_free_frame(p_disp);
+    if (next_frame < 0)
+    {
+        next_frame = p_disp->front_frame;
+        for (int ix = 0; (ix < NUM_FRAME_BUFFERS) && (p_disp->pending_frame == p_disp->front_frame); ix++)
         {
-            // divide brightness in half for each bit below s_lsb_msb_transition_bit
-            int lsbBrightness = s_brightness_val >> (s_lsb_msb_transition_bit - bitplane_ix + 1);
-            if (x_coord >= lsbBrightness)
+            if ((p_disp->retired_frames & BIT(ix)) != 0)
             {
-                v |= BIT_OE; // for Brightness
+                next_frame = ix;
+                break;
             }
         }
+    }
+    p_disp->current_frame = next_frame;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
 
-        // When using the Adafruit drawPixel, we only have one pixel co-ordinate and colour to draw
-        // (duh) so we can't paint a top and bottom half (or whatever row split the panel is) at the
-        // same time.  Need to be smart and check the DMA buffer to see what the other half thinks
-        // (pun intended) and persist this when we refresh.
-        // The DMA buffer order has also been reversed (refer to the last code in this function) so
-        // we have to check for this and check the correct position of the uint16_t data.
-        int16_t tmp_x_coord = x_coord;
-        if ((x_coord % 2) != 0)
-        {
-            tmp_x_coord -= 1;
-        }
-        else
-        {
-            tmp_x_coord += 1;
-        } // end reordering
-
-        uint8_t mask = BIT(bitplane_ix); // 8 bit color
+    if (block != 0)
+    {
+        s_wait_current_frame(p_disp);
+    }
 
-        // need to copy what the RGB status is for the bottom pixels
-        if (paint_top_half)
+#if CONFIG_LEDDISPLAY_PIXEL_PERSIST
+    // all other frame buffers now miss the rows drawn to the updated one, copy them (and the ones
+    // missed before) to the next frame buffer
+    for (int ix = 0; ix < NUM_FRAME_BUFFERS; ix++)
+    {
+        if (ix != updated_frame)
         {
-
-           // Set the color of the pixel of interest
-           if (green & mask) { v |= BIT_G1; }
-           if (blue  & mask) { v |= BIT_B1; }
-           if (red   & mask) { v |= BIT_R1; }
-
-           // Persist what was painted to the other half of the frame equiv. pixel
-           if (rowbits->pixel[tmp_x_coord] & BIT_R2) { v |= BIT_R2; }
-           if (rowbits->pixel[tmp_x_coord] & BIT_G2) { v |= BIT_G2; }
-           if (rowbits->pixel[tmp_x_coord] & BIT_B2) { v |= BIT_B2; }
+            p_disp->persist_rows[ix] |= p_disp->persist_drawn_rows;
         }
-        // do it the other way around
-        else
+    }
+    p_disp->persist_drawn_rows = 0;
+    const uint32_t rows = p_disp->persist_rows[p_disp->current_frame];
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        if ((rows & ROW_MASK(row)) != 0)
         {
-            // color to set
-            if (red   & mask) { v |= BIT_R2; }
-            if (green & mask) { v |= BIT_G2; }
-            if (blue  & mask) { v |= BIT_B2; }
+            for (int sub = 0; sub < DITHER_FRAMES; sub++)
+            {
+                memcpy(&FRAME_BUF(p_disp, p_disp->current_frame)[sub].rowdata[row], &FRAME_BUF(p_disp, updated_frame)[sub].rowdata[row], sizeof(row_data_t));
+            }
+        }
+    }
+    p_disp->persist_rows[p_disp->current_frame] = 0;
+    p_disp->frame_stale_rows[p_disp->current_frame] = (p_disp->frame_stale_rows[p_disp->current_frame] & ~rows) | (p_disp->frame_stale_rows[updated_frame] & rows);
+    LOAD_STALE(p_disp, rows);
+#endif
+}
 
-            // copy
-            if (rowbits->pixel[tmp_x_coord] & BIT_R1) { v |= BIT_R1; }
-            if (rowbits->pixel[tmp_x_coord] & BIT_G1) { v |= BIT_G1; }
-            if (rowbits->pixel[tmp_x_coord] & BIT_B1) { v |= BIT_B1; }
+void leddisplay_disp_set_present_cb(leddisplay_t *p_disp, leddisplay_present_cb_t cb, void *arg)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->present_cb = cb;
+    p_disp->present_cb_arg = arg;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+}
 
-        } // paint
+uint32_t leddisplay_disp_get_frame_number(leddisplay_t *p_disp)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    const uint32_t frame = p_disp->stats.frames_submitted;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    return frame;
+}
 
+void leddisplay_disp_get_present(leddisplay_t *p_disp, leddisplay_present_t *p_present)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    *p_present = p_disp->present;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+}
 
-        // 16 bit parallel mode
-        // save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
-        if( (x_coord % 2) != 0)
-        {
-            rowbits->pixel[tmp_x_coord] = v;
-        }
-        else
-        {
-            rowbits->pixel[tmp_x_coord] = v;
-        } // end reordering
+esp_err_t leddisplay_disp_wait_vsync(leddisplay_t *p_disp, int timeout_ms)
+{
+    const TickType_t timeout = timeout_ms < 0 ? portMAX_DELAY : (timeout_ms / portTICK_PERIOD_MS);
 
-    } // color depth loop (8)
+    // wait for the next refresh (not one that has happened already), and pass it on to other
+    // waiters (see s_wait_current_frame())
+    xSemaphoreTake(p_disp->shift_complete_sem, 0);
+    if (!s_wait_refresh_timeout(p_disp, timeout))
+    {
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(p_disp->shift_complete_sem);
+    return ESP_OK;
 }
 
-
-void leddisplay_pixel_fill_rgb(uint8_t red, uint8_t green, uint8_t blue)
+esp_err_t leddisplay_disp_wait_present(leddisplay_t *p_disp, uint32_t frame, int timeout_ms)
 {
-#if 0
-    for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
+    const TickType_t t0 = xTaskGetTickCount();
+    const TickType_t timeout = timeout_ms / portTICK_PERIOD_MS;
+    while (true)
     {
-        for (uint16_t x = 0; x < LEDDISPLAY_WIDTH; x++)
+        portENTER_CRITICAL(&p_disp->frames_mux);
+        const uint32_t presented = p_disp->present.frame;
+        portEXIT_CRITICAL(&p_disp->frames_mux);
+        if ((int32_t)(presented - frame) >= 0)
+        {
+            return ESP_OK;
+        }
+        const TickType_t elapsed = xTaskGetTickCount() - t0;
+        if ( (timeout_ms >= 0) && (elapsed >= timeout) )
+        {
+            return ESP_ERR_TIMEOUT;
+        }
+        if (leddisplay_disp_wait_vsync(p_disp, timeout_ms < 0 ? -1 : ((timeout - elapsed) * portTICK_PERIOD_MS)) != ESP_OK)
         {
-            leddisplay_pixel_xy_rgb(x, y, red, green, blue);
+            return ESP_ERR_TIMEOUT;
         }
     }
+}
+
+// link DMA descriptors for some rows of a frame buffer (or the ring), returns the number of
+// descriptors used
+static int s_link_rows_desc(leddisplay_t *p_disp, lldesc_t *dmadesc, row_data_t *rowdata, const int first_row, const int num_rows)
+{
+    lldesc_t *prevdmadesc = NULL;
+    int currentDescOffset = 0;
+    for (int j = first_row; j < (first_row + num_rows); j++)
+    {
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+        row_data_t *p_rowdata = &rowdata[j % RING_ROWS];
 #else
-#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
-    red   = val2pwm(red);
-    green = val2pwm(green);
-    blue  = val2pwm(blue);
+        row_data_t *p_rowdata = &rowdata[j];
+#endif
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+        // row gap, with the interrupt for the row address (see s_shift_complete_sem_cb())
+        currentDescOffset += i2s_parallel_link_dma_desc(&dmadesc[currentDescOffset], prevdmadesc, &p_disp->row_gap[0], sizeof(bus_word_t) * ROW_GAP_IRQ_WORDS);
+        dmadesc[currentDescOffset - 1].eof = 1;
+        prevdmadesc = &dmadesc[currentDescOffset - 1];
+        currentDescOffset += i2s_parallel_link_dma_desc(&dmadesc[currentDescOffset], prevdmadesc, &p_disp->row_gap[ROW_GAP_IRQ_WORDS], sizeof(bus_word_t) * (ROW_GAP_WORDS - ROW_GAP_IRQ_WORDS));
+        prevdmadesc = &dmadesc[currentDescOffset - 1];
 #endif
-    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++) // half height - 16 iterations
-    {
-        row_data_t *row_data = &s_frames[s_current_frame].rowdata[y_coord];
-
-        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
-        {
-            uint16_t mask = (1 << bitplane_ix); // 24 bit color
 
-            // the destination for the pixel bitstream
-            row_bit_t *rowbits = &row_data->rowbits[bitplane_ix]; //matrixUpdateFrames location to write to uint16_t's
+        // first set of data is LSB through MSB, single pass - all color bits are displayed once, which takes care of everything below and inlcluding LSBMSB_TRANSITION_BIT
+        // (this is split into several descriptors if it is longer than the DMA can do with one)
+        currentDescOffset += i2s_parallel_link_dma_desc(&dmadesc[currentDescOffset], prevdmadesc, &(p_rowdata->rowbits[0].pixel), sizeof(row_bit_t) * COLOR_DEPTH_BITS);
+        prevdmadesc = &dmadesc[currentDescOffset - 1];
+        //DEBUG("row %d:", j);
 
-            for (int x_coord = 0; x_coord < LEDDISPLAY_WIDTH; x_coord++) // row pixel width 64 iterations
+        for (int i = p_disp->lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
+        {
+            // binary time division setup: we need 2 of bit (LSBMSB_TRANSITION_BIT + 1) four of (LSBMSB_TRANSITION_BIT + 2), etc
+            // because we sweep through to MSB each time, it divides the number of times we have to sweep in half (saving linked list RAM)
+            // we need 2^(i - LSBMSB_TRANSITION_BIT - 1) == 1 << (i - LSBMSB_TRANSITION_BIT - 1) passes from i to MSB
+            //DEBUG("buffer %d: repeat %d times, size: %d, from %d - %d", nextBufdescIndex, 1<<(i - LSBMSB_TRANSITION_BIT - 1), (COLOR_DEPTH_BITS - i), i, COLOR_DEPTH_BITS-1);
+            for (int k = 0; k < (1 << (i - p_disp->lsb_msb_transition_bit - 1)); k++)
             {
-                int v = 0; // the output bitstream
-
-                // if there is no latch to hold address, output ADDX lines directly to GPIO and latch data at end of cycle
-                // normally output current rows ADDX, special case for LSB, output previous row's ADDX (as previous row is being displayed for one latch cycle)
-                int gpioRowAddress = (bitplane_ix == 0) ? y_coord - 1 : y_coord;
+                currentDescOffset += i2s_parallel_link_dma_desc(&dmadesc[currentDescOffset], prevdmadesc, &(p_rowdata->rowbits[i].pixel), sizeof(row_bit_t) * (COLOR_DEPTH_BITS - i));
+                prevdmadesc = &dmadesc[currentDescOffset - 1];
+                //DEBUG("i %d, j %d, k %d", i, j, k);
+            }
+        }
 
-                if (gpioRowAddress & BIT(0)) { v |= BIT_A; } // 1
-                if (gpioRowAddress & BIT(1)) { v |= BIT_B; } // 2
-                if (gpioRowAddress & BIT(2)) { v |= BIT_C; } // 4
-                if (gpioRowAddress & BIT(3)) { v |= BIT_D; } // 8
-#if LEDDISPLAY_NEED_E_GPIO
-                if (gpioRowAddress & BIT(4)) { v |= BIT_E; } // 16
-#endif
-                // need to disable OE after latch to hide row transition
-                if (x_coord == 0) { v |= BIT_OE; }
-
-                // drive latch while shifting out last bit of RGB data
-                // need to turn off OE one clock before latch, otherwise can get ghosting
-                if (x_coord == (PIXELS_PER_LATCH - 1)) { v |= (BIT_LAT | BIT_OE); }
-
-                // turn off OE after brightness value is reached when displaying MSBs
-                // MSBs always output normal brightness
-                // LSB (!bitplane_ix) outputs normal brightness as MSB from previous row is being displayed
-                if ( ((bitplane_ix > s_lsb_msb_transition_bit) || !bitplane_ix) && (x_coord >= s_brightness_val) )
-                {
-                    v |= BIT_OE; // For Brightness
-                }
-
-                // special case for the bits *after* LSB through (s_lsb_msb_transition_bit) - OE is output after data is shifted, so need to set OE to fractional brightness
-                if (bitplane_ix && (bitplane_ix <= s_lsb_msb_transition_bit))
-                {
-                    // divide brightness in half for each bit below s_lsb_msb_transition_bit
-                    int lsbBrightness = s_brightness_val >> (s_lsb_msb_transition_bit - bitplane_ix + 1);
-                    if (x_coord >= lsbBrightness) { v |= BIT_OE; } // For Brightness
-                }
-
-                // top and bottom half colours
-                if (red    & mask) { v |= (BIT_R1 | BIT_R2); }
-                if (green  & mask) { v |= (BIT_G1 | BIT_G2); }
-                if (blue   & mask) { v |= (BIT_B1 | BIT_B2); }
-
-                // 16 bit parallel mode
-                // Save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
-                if ((x_coord % 2) != 0)
-                {
-                    rowbits->pixel[x_coord - 1] = v;
-                }
-                else
-                {
-                    rowbits->pixel[x_coord + 1] = v;
-                } // end reordering
-
-            } // end x_coord iteration
-        } // colour depth loop (8)
-    } // end row iteration
+#if CONFIG_LEDDISPLAY_PSRAM_RING && !CONFIG_LEDDISPLAY_BUS_8BIT
+        // interrupt at the end of each row for the ring task (see s_shift_complete_sem_cb())
+        prevdmadesc->eof = 1;
 #endif
+    }
+    return currentDescOffset;
 }
 
-/* *********************************************************************************************** */
-
-inline void leddisplay_frame_xy_rgb(leddisplay_frame_t *p_frame, uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+// configure the row address GPIOs, and calculate the GPIO output register values for each row
+static esp_err_t s_row_addr_init(leddisplay_t *p_disp)
 {
-    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    const int gpios[] =
     {
-        return;
+        p_disp->gpio->a, p_disp->gpio->b, p_disp->gpio->c, p_disp->gpio->d,
+#if LEDDISPLAY_NEED_E_GPIO
+        p_disp->gpio->e,
+#endif
+    };
+    gpio_config_t conf =
+    {
+        .pin_bit_mask = 0,
+        .mode         = GPIO_MODE_OUTPUT,
+        .pull_up_en   = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type    = GPIO_INTR_DISABLE,
+    };
+    for (int ix = 0; ix < NUMOF(gpios); ix++)
+    {
+        conf.pin_bit_mask |= (uint64_t)1 << gpios[ix];
     }
-    p_frame->yx[y_coord][x_coord][0] = red;
-    p_frame->yx[y_coord][x_coord][1] = green;
-    p_frame->yx[y_coord][x_coord][2] = blue;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        row_addr_gpio_t *p_gpio = &p_disp->row_addr_gpio[row];
+        memset(p_gpio, 0, sizeof(*p_gpio));
+        for (int ix = 0; ix < NUMOF(gpios); ix++)
+        {
+            const bool high = (row & BIT(ix)) != 0;
+            if (gpios[ix] < 32)
+            {
+                *(high ? &p_gpio->set : &p_gpio->clr) |= (uint32_t)1 << gpios[ix];
+            }
+            else
+            {
+                *(high ? &p_gpio->set1 : &p_gpio->clr1) |= (uint32_t)1 << (gpios[ix] - 32);
+            }
+        }
+    }
+    p_disp->row_addr_row = 0;
+    return gpio_config(&conf);
 }
+#endif
 
-inline void leddisplay_frame_fill_rgb(leddisplay_frame_t *p_frame, uint8_t red, uint8_t green, uint8_t blue)
+#if CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE
+// configure the sync GPIO (master: output, slave: input with interrupt on both edges)
+static esp_err_t s_sync_init(void)
 {
-    if ( (red == green) && (red == blue) )
+    gpio_config_t conf =
     {
-        memset(p_frame, red, sizeof(*p_frame));
+        .pin_bit_mask = (uint64_t)1 << CONFIG_LEDDISPLAY_SYNC_GPIO,
+        .pull_up_en   = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+#  if CONFIG_LEDDISPLAY_SYNC_MASTER
+        .mode         = GPIO_MODE_OUTPUT,
+        .intr_type    = GPIO_INTR_DISABLE,
+#  else
+        .mode         = GPIO_MODE_INPUT,
+        .intr_type    = GPIO_INTR_ANYEDGE,
+#  endif
+    };
+    esp_err_t res = gpio_config(&conf);
+#  if CONFIG_LEDDISPLAY_SYNC_MASTER
+    s_sync_level = false;
+    if (res == ESP_OK)
+    {
+        res = gpio_set_level(CONFIG_LEDDISPLAY_SYNC_GPIO, 0);
     }
-    else
+#  else
+    s_sync_master_time = 0;
+    if (res == ESP_OK)
     {
-        for (uint16_t ix = 0; ix < NUMOF(p_frame->ix); ix++)
+        // the application may have installed the service already
+        res = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+        if (res == ESP_ERR_INVALID_STATE)
         {
-            p_frame->ix[ix][0] = red;
-            p_frame->ix[ix][1] = green;
-            p_frame->ix[ix][2] = blue;
+            res = ESP_OK;
         }
     }
+    if (res == ESP_OK)
+    {
+        res = gpio_isr_handler_add(CONFIG_LEDDISPLAY_SYNC_GPIO, s_sync_master_isr, NULL);
+    }
+#  endif
+    return res;
 }
+#endif
 
-inline void leddisplay_frame_clear(leddisplay_frame_t *p_frame)
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+static bool s_oe_pwm_ready;
+
+// generator actions
+#  define OE_PWM_LOW              1
+#  define OE_PWM_HIGH             2
+
+// set the OE pulse width (brightness value, 0..BRIGHTNESS_MAX), the timing scales with the I2S
+// clock (see leddisplay_set_low_power()), so that the brightness stays the same
+static void s_oe_pwm_set(leddisplay_t *p_disp, const int brightness_val)
 {
-    memset(p_frame, 0, sizeof(*p_frame));
+    if (s_oe_pwm_ready)
+    {
+        MCPWM0.timer[0].period.period            = OE_PWM_PERIOD * p_disp->clock_div;
+        MCPWM0.channel[0].cmpr_value[0].cmpr_val = OE_PWM_START * p_disp->clock_div;
+        MCPWM0.channel[0].cmpr_value[1].cmpr_val = (OE_PWM_START + brightness_val) * p_disp->clock_div;
+        MCPWM0.channel[0].generator[0].utea = brightness_val > 0 ? OE_PWM_LOW : OE_PWM_HIGH;
+    }
 }
 
-#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
-#  define _VAL2PWM(v) val2pwm(v)
-#else
-#  define _VAL2PWM(v) (v)
+// configure the MCPWM (unit 0, timer 0, operator 0, output 0A) for the OE pulse, synchronised to
+// the latch, which the I2S outputs on the LAT GPIO, and which the MCPWM reads from the same pad
+static esp_err_t s_oe_pwm_init(leddisplay_t *p_disp)
+{
+    periph_module_enable(PERIPH_PWM0_MODULE);
+
+    MCPWM0.clk_cfg.prescale                  = 0;
+    MCPWM0.timer[0].period.prescale          = 0;
+    MCPWM0.timer[0].period.upmethod          = 0; // immediately
+    MCPWM0.timer[0].sync.timer_phase         = 0;
+    MCPWM0.timer[0].sync.in_en               = 1;
+    MCPWM0.timer_synci_cfg.t0_in_sel         = 4; // SYNC0 (GPIO matrix)
+    MCPWM0.timer_sel.operator0_sel           = 0; // timer 0
+    MCPWM0.channel[0].cmpr_cfg.a_upmethod    = 0; // immediately
+    MCPWM0.channel[0].cmpr_cfg.b_upmethod    = 0;
+    MCPWM0.channel[0].generator[0].val       = 0;
+    MCPWM0.channel[0].generator[0].uteb      = OE_PWM_HIGH;
+    MCPWM0.channel[0].generator[0].utep      = OE_PWM_HIGH;
+    s_oe_pwm_ready = true;
+    s_oe_pwm_set(p_disp, p_disp->brightness_val);
+    MCPWM0.timer[0].mode.mode                = 1; // count up
+    MCPWM0.timer[0].mode.start               = 2; // run
+
+    PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[p_disp->gpio->lat]);
+    gpio_matrix_in(p_disp->gpio->lat, PWM0_SYNC0_IN_IDX, false);
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[p_disp->gpio->oe], PIN_FUNC_GPIO);
+    const esp_err_t res = gpio_set_direction(p_disp->gpio->oe, GPIO_MODE_OUTPUT);
+    gpio_matrix_out(p_disp->gpio->oe, OE_GPIO_SIG(p_disp), false, false);
+    return res;
+}
+
+// stop the MCPWM, and keep the display dark
+static void s_oe_pwm_stop(leddisplay_t *p_disp)
+{
+    if (s_oe_pwm_ready)
+    {
+        s_oe_pwm_ready = false;
+        gpio_set_level(p_disp->gpio->oe, 1);
+        gpio_matrix_out(p_disp->gpio->oe, SIG_GPIO_OUT_IDX, false, false);
+        MCPWM0.timer[0].mode.start = 0;
+        periph_module_disable(PERIPH_PWM0_MODULE);
+    }
+}
 #endif
 
-void leddisplay_frame_update(const leddisplay_frame_t *p_frame)
+esp_err_t leddisplay_disp_init(leddisplay_t *p_disp)
 {
-    // if necessary, block until current framebuffer memory becomes available
-    xSemaphoreTake(s_shift_complete_sem, portMAX_DELAY);
+    esp_err_t res = ESP_OK;
 
-#if 0
-    for (uint16_t x = 0; x < LEDDISPLAY_WIDTH; x++)
+    INFO("display %d: %dx%d (%d bits, %d panel(s) of %dx%d in %d row(s)%s)", p_disp->num, LEDDISPLAY_WIDTH, LEDDISPLAY_HEIGHT, COLOR_DEPTH_BITS,
+        LEDDISPLAY_CHAIN_LENGTH, LEDDISPLAY_PANEL_WIDTH, LEDDISPLAY_PANEL_HEIGHT, LEDDISPLAY_CHAIN_ROWS,
+#if CONFIG_LEDDISPLAY_CHAIN_SERPENTINE
+        ", serpentine"
+#else
+        ""
+#endif
+        );
+
+    const disp_gpio_t *p_gpio = p_disp->gpio;
+    DEBUG("GPIOs: R1=%d G1=%d B1=%d R2=%d G2=%d B2=%d A=%d B=%d C=%d D=%d E=%d LAT=%d OE=%d CLK=%d",
+        p_gpio->r1, p_gpio->g1, p_gpio->b1, p_gpio->r2, p_gpio->g2, p_gpio->b2, p_gpio->a, p_gpio->b, p_gpio->c,
+        p_gpio->d, p_gpio->e, p_gpio->lat, p_gpio->oe, p_gpio->clk);
+    bool gpios_ok = (p_gpio->r1 >= 0) && (p_gpio->g1 >= 0) && (p_gpio->b1 >= 0) && (p_gpio->r2 >= 0) &&
+        (p_gpio->g2 >= 0) && (p_gpio->b2 >= 0) && (p_gpio->a >= 0) && (p_gpio->b >= 0) && (p_gpio->c >= 0) &&
+        (p_gpio->d >= 0) && (p_gpio->lat >= 0) && (p_gpio->oe >= 0) && (p_gpio->clk >= 0);
+#if LEDDISPLAY_NEED_E_GPIO
+    gpios_ok = gpios_ok && (p_gpio->e >= 0);
+#endif
+    if (!gpios_ok)
     {
-        for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
-        {
-            const uint8_t *p_rgb = p_frame->yx[y][x];
-            leddisplay_pixel_xy_rgb(x, y, _VAL2PWM(p_rgb[0]), _VAL2PWM(p_rgb[1]), _VAL2PWM(p_rgb[2]));
-        }
+        WARNING("GPIOs not configured");
+        res = ESP_ERR_INVALID_ARG;
     }
-#else
-    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++) // half height - 16 iterations
+
+    // the look-up tables are the same for all displays
+    static bool luts_ready;
+    if (!luts_ready)
     {
-        row_data_t *row_data = &s_frames[s_current_frame].rowdata[y_coord];
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+        // brightness correction look-up table for the colour depth
+        val2pwm_init();
+#endif
+#if DITHER_FRAMES > 1
+        // higher precision look-up table for the temporal dithering
+        val2pwm_dither_init();
+#endif
+        luts_ready = true;
+    }
 
-        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
-        {
-            uint16_t mask = (1 << bitplane_ix); // 24 bit color
+    memset(&p_disp->stats, 0, sizeof(p_disp->stats));
+    memset(&p_disp->present, 0, sizeof(p_disp->present));
+    memset(p_disp->frame_number, 0, sizeof(p_disp->frame_number));
+    p_disp->eof_ref_count = 0;
+    p_disp->eof_restart = false;
+    p_disp->suspended = false;
+    p_disp->clock_div = 1;
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    memset(p_disp->frame_load_rows, 0, sizeof(p_disp->frame_load_rows));
+    memset(p_disp->frame_load, 0, sizeof(p_disp->frame_load));
+    memset(p_disp->frame_load_stale_rows, 0, sizeof(p_disp->frame_load_stale_rows));
+    p_disp->brightness_limit_val = BRIGHTNESS_MAX;
+    p_disp->current_limit_ma = CONFIG_LEDDISPLAY_CURRENT_LIMIT_MA;
+#endif
+
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+    p_disp->ctrl_mutex = xSemaphoreCreateMutexStatic(&p_disp->ctrl_mutex_buf);
+#else
+    p_disp->ctrl_mutex = xSemaphoreCreateMutex();
+#endif
+
+    // set default brightness 75%
+    leddisplay_disp_set_brightness(p_disp, 75);
 
-            // the destination for the pixel bitstream
-            row_bit_t *rowbits = &row_data->rowbits[bitplane_ix]; //matrixUpdateFrames location to write to uint16_t's
+    // allocate memory for the frame buffers, initialise frame buffers
+    if (res == ESP_OK)
+    {
+        DEBUG("frame buffers: size=%u (available total=%u, largest=%u)", NUM_FRAME_BUFFERS * DITHER_FRAMES * sizeof(frame_t),
+            heap_caps_get_free_size(FRAME_BUF_CAPS), heap_caps_get_largest_free_block(FRAME_BUF_CAPS));
+        p_disp->frames = (frame_t *)heap_caps_malloc(NUM_FRAME_BUFFERS * DITHER_FRAMES * sizeof(frame_t), FRAME_BUF_CAPS);
+        if (p_disp->frames == NULL)
+        {
+            WARNING("framebuf alloc");
+            res = ESP_ERR_NO_MEM;
+        }
+        // clear frame buffers
+        else
+        {
+            const int old_brightness = leddisplay_disp_set_brightness(p_disp, 0);
 
-            for (int x_coord = 0; x_coord < LEDDISPLAY_WIDTH; x_coord++) // row pixel width 64 iterations
+            for (int ix = NUM_FRAME_BUFFERS - 1; ix >= 0; ix--)
             {
-                int v = 0; // the output bitstream
+                p_disp->current_frame = ix;
+                leddisplay_disp_pixel_fill_rgb(p_disp, 0, 0, 0);
+            }
 
-                // if there is no latch to hold address, output ADDX lines directly to GPIO and latch data at end of cycle
-                // normally output current rows ADDX, special case for LSB, output previous row's ADDX (as previous row is being displayed for one latch cycle)
-                int gpioRowAddress = (bitplane_ix == 0) ? y_coord - 1 : y_coord;
+            leddisplay_disp_set_brightness(p_disp, old_brightness);
+#if CONFIG_LEDDISPLAY_PIXEL_PERSIST
+            memset(p_disp->persist_rows, 0, sizeof(p_disp->persist_rows));
+            p_disp->persist_drawn_rows = 0;
+#endif
 
-                if (gpioRowAddress & BIT(0)) { v |= BIT_A; } // 1
-                if (gpioRowAddress & BIT(1)) { v |= BIT_B; } // 2
-                if (gpioRowAddress & BIT(2)) { v |= BIT_C; } // 4
-                if (gpioRowAddress & BIT(3)) { v |= BIT_D; } // 8
-#if LEDDISPLAY_NEED_E_GPIO
-                if (gpioRowAddress & BIT(4)) { v |= BIT_E; } // 16
-#endif
-                // need to disable OE after latch to hide row transition
-                if (x_coord == 0) { v |= BIT_OE; }
-
-                // drive latch while shifting out last bit of RGB data
-                // need to turn off OE one clock before latch, otherwise can get ghosting
-                if (x_coord == (PIXELS_PER_LATCH - 1)) { v |= (BIT_LAT | BIT_OE); }
-
-                // turn off OE after brightness value is reached when displaying MSBs
-                // MSBs always output normal brightness
-                // LSB (!bitplane_ix) outputs normal brightness as MSB from previous row is being displayed
-                if ( ((bitplane_ix > s_lsb_msb_transition_bit) || !bitplane_ix) && (x_coord >= s_brightness_val) )
-                {
-                    v |= BIT_OE; // For Brightness
-                }
-
-                // special case for the bits *after* LSB through (s_lsb_msb_transition_bit) - OE is output after data is shifted, so need to set OE to fractional brightness
-                if (bitplane_ix && (bitplane_ix <= s_lsb_msb_transition_bit))
-                {
-                    // divide brightness in half for each bit below s_lsb_msb_transition_bit
-                    int lsbBrightness = s_brightness_val >> (s_lsb_msb_transition_bit - bitplane_ix + 1);
-                    if (x_coord >= lsbBrightness) { v |= BIT_OE; } // For Brightness
-                }
-
-                // top half
-                const uint8_t *p_rgb_top = p_frame->yx[y_coord][x_coord];
-                if (_VAL2PWM(p_rgb_top[0]) & mask) { v |= BIT_R1; }
-                if (_VAL2PWM(p_rgb_top[1]) & mask) { v |= BIT_G1; }
-                if (_VAL2PWM(p_rgb_top[2]) & mask) { v |= BIT_B1; }
-
-                // bottom half
-                const uint8_t *p_rgb_bot = p_frame->yx[y_coord + ROWS_PER_FRAME][x_coord];
-                if (_VAL2PWM(p_rgb_bot[0]) & mask) { v |= BIT_R2; }
-                if (_VAL2PWM(p_rgb_bot[1]) & mask) { v |= BIT_G2; }
-                if (_VAL2PWM(p_rgb_bot[2]) & mask) { v |= BIT_B2; }
-
-                // 16 bit parallel mode
-                // Save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
-                if ((x_coord % 2) != 0)
-                {
-                    rowbits->pixel[x_coord - 1] = v;
-                }
-                else
-                {
-                    rowbits->pixel[x_coord + 1] = v;
-                } // end reordering
-
-            } // end x_coord iteration
-        } // colour depth loop (8)
-    } // end row iteration
-#endif
-
-    leddisplay_pixel_update(0);
-}
+            // DMA starts with the first buffer, draw into the second one
+            p_disp->front_frame = 0;
+            p_disp->pending_frame = -1;
+            p_disp->retired_frames = 0;
+            p_disp->current_frame = 1;
+        }
+    }
 
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    // allocate memory for the ring of row buffers
+    if (res == ESP_OK)
+    {
+        p_disp->ring = (row_data_t *)heap_caps_malloc(RING_ROWS * sizeof(row_data_t), MALLOC_CAP_DMA);
+        if (p_disp->ring == NULL)
+        {
+            WARNING("ring alloc");
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+#endif
 
-/* *********************************************************************************************** */
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    // allocate memory for the row gap, configure the row address GPIOs
+    if (res == ESP_OK)
+    {
+        p_disp->row_gap = (bus_word_t *)heap_caps_malloc(ROW_GAP_WORDS * sizeof(bus_word_t), MALLOC_CAP_DMA);
+        if (p_disp->row_gap == NULL)
+        {
+            WARNING("row gap alloc");
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+    if (res == ESP_OK)
+    {
+        const esp_err_t res2 = s_row_addr_init(p_disp);
+        if (res2 != ESP_OK)
+        {
+            WARNING("row addr gpio fail (%d, %s)", res2, esp_err_to_name(res2));
+            res = res2;
+        }
+    }
+#endif
+
+#if CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE
+    // configure the sync GPIO
+    if (res == ESP_OK)
+    {
+        const esp_err_t res2 = s_sync_init();
+        if (res2 != ESP_OK)
+        {
+            WARNING("sync gpio fail (%d, %s)", res2, esp_err_to_name(res2));
+            res = res2;
+        }
+    }
+#endif
+
+    // calculate the lowest LSBMSB_TRANSITION_BIT value that will fit in memory and achieves the minimal refresh rate
+    int numDescriptorsPerRow = 0;
+    int refreshRate = 0;
+    bool ramOkay = false;
+    bool refreshOkay = false;
+    if (res == ESP_OK)
+    {
+        int largestBlockFree = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+        int totalFree        = heap_caps_get_free_size(MALLOC_CAP_DMA);
+
+        p_disp->lsb_msb_transition_bit = 0;
+
+        while (1)
+        {
+            ramOkay = false;
+            refreshOkay = false;
+
+            // calculate memory requirements for this value of lsb_msb_transition_bit (long rows
+            // of chained panels may need more than one descriptor for each run of bitplanes)
+            numDescriptorsPerRow = i2s_parallel_dma_desc_count(sizeof(row_bit_t) * COLOR_DEPTH_BITS);
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            numDescriptorsPerRow += i2s_parallel_dma_desc_count(sizeof(bus_word_t) * ROW_GAP_IRQ_WORDS) +
+                i2s_parallel_dma_desc_count(sizeof(bus_word_t) * (ROW_GAP_WORDS - ROW_GAP_IRQ_WORDS));
+#endif
+            for (int i = p_disp->lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
+            {
+                numDescriptorsPerRow += (1 << (i - p_disp->lsb_msb_transition_bit - 1)) *
+                    i2s_parallel_dma_desc_count(sizeof(row_bit_t) * (COLOR_DEPTH_BITS - i));
+            }
+            int ramRequired = numDescriptorsPerRow * ((OWN_DESC_ROWS * NUM_DESC_CHAINS) + (ROWS_PER_FRAME - OWN_DESC_ROWS)) *
+                DITHER_FRAMES * sizeof(lldesc_t);
+
+            // calculate achievable refresh rate for this value of lsb_msb_transition_bit
+            int psPerClock = 1000000000000UL / I2S_CLOCK_SPEED;
+            int nsPerLatch = (PIXELS_PER_LATCH * psPerClock) / 1000;
+            // add time to shift out LSBs + LSB-MSB transition bit - this ignores fractions...
+            int nsPerRow = COLOR_DEPTH_BITS * nsPerLatch;
+            // add time to shift out MSBs
+            for (int i = p_disp->lsb_msb_transition_bit + 1; i < COLOR_DEPTH_BITS; i++)
+            {
+                nsPerRow += (1 << (i - p_disp->lsb_msb_transition_bit - 1)) * (COLOR_DEPTH_BITS - i) * nsPerLatch;
+            }
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            // add the row gap
+            nsPerRow += (ROW_GAP_WORDS * psPerClock) / 1000;
+#endif
+            int nsPerFrame = nsPerRow * ROWS_PER_FRAME;
+            refreshRate = 1000000000UL / nsPerFrame;
+
+            // check if that satisfies our requirements
+            if ( (ramRequired < largestBlockFree) && (ramRequired < (totalFree - CONFIG_LEDDISPLAY_PRESERVE_RAM_SIZE)) )
+            {
+                ramOkay = true;
+            }
+            if (refreshRate >= CONFIG_LEDDISPLAY_MIN_FRAME_RATE)
+            {
+                refreshOkay = true;
+            }
+
+            // log summary
+            DEBUG("lsb_msb_transition_bit=%d: ramRequired=%u available=%u largest=%u %s, refreshRate=%d %s",
+                p_disp->lsb_msb_transition_bit, ramRequired, totalFree, largestBlockFree, ramOkay ? ":-)" : ":-(",
+                refreshRate, refreshOkay ? ":-)" : ":-(");
+
+            // stop if we're satisfied
+            if (ramOkay && refreshOkay)
+            {
+                break;
+            }
+            // try again if we can do more
+            if ( p_disp->lsb_msb_transition_bit < TRANSITION_BIT_MAX )
+            {
+                p_disp->lsb_msb_transition_bit++;
+            }
+            // give up
+            else
+            {
+                break;
+            }
+        }
+
+        // are we happy?
+        if (ramOkay && refreshOkay)
+        {
+            leddisplay_enc_ctrl_bits(&p_disp->ctrl_bits, p_disp->brightness_val, p_disp->lsb_msb_transition_bit);
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            leddisplay_enc_row_gap(p_disp->row_gap, ROW_GAP_WORDS, &p_disp->ctrl_bits);
+#endif
+            // (with dithering, a refresh is all sub-frames)
+            p_disp->refresh_rate_full = refreshRate / DITHER_FRAMES;
+            p_disp->stats.refresh_rate = p_disp->refresh_rate_full;
+            DEBUG("finally: lsb_msb_transition_bit=%d/%d, rows=%d, RAM=%d, refresh=%d", p_disp->lsb_msb_transition_bit, COLOR_DEPTH_BITS - 1,
+                ROWS_PER_FRAME, numDescriptorsPerRow * ((OWN_DESC_ROWS * NUM_DESC_CHAINS) + (ROWS_PER_FRAME - OWN_DESC_ROWS)) *
+                DITHER_FRAMES * sizeof(lldesc_t), refreshRate);
+        }
+        // give up if we could not meet the RAM and refresh rate requirements
+        else
+        {
+            if (!ramOkay)
+            {
+                WARNING("desc alloc");
+                res = ESP_ERR_NO_MEM;
+            }
+            if (!refreshOkay)
+            {
+                WARNING("refresh");
+                res = ESP_FAIL;
+            }
+        }
+    }
+
+    // malloc the DMA linked list descriptors that i2s_parallel will need (for each frame buffer, and
+    // the ones shared by all buffers, if any)
+    const int desccount        = numDescriptorsPerRow * ROWS_PER_FRAME * DITHER_FRAMES;
+    const int desccount_own    = numDescriptorsPerRow * OWN_DESC_ROWS * DITHER_FRAMES;
+    const int desccount_shared = desccount - desccount_own;
+    if (res == ESP_OK)
+    {
+        p_disp->stats.lsb_msb_transition_bit = p_disp->lsb_msb_transition_bit;
+        p_disp->stats.chain_length           = LEDDISPLAY_CHAIN_LENGTH;
+        p_disp->stats.num_frame_buffers      = NUM_FRAME_BUFFERS;
+        p_disp->stats.desc_count             = desccount;
+        p_disp->stats.desc_shared_count      = desccount_shared;
+        p_disp->stats.frame_buf_bytes        = DITHER_FRAMES * sizeof(frame_t);
+        p_disp->stats.desc_buf_bytes         = desccount_own * sizeof(lldesc_t);
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+        p_disp->stats.dma_total_bytes        = p_disp->stats.desc_buf_bytes + (RING_ROWS * sizeof(row_data_t));
+#else
+        p_disp->stats.dma_total_bytes        = (NUM_FRAME_BUFFERS * (p_disp->stats.frame_buf_bytes + p_disp->stats.desc_buf_bytes)) +
+            (desccount_shared * sizeof(lldesc_t));
+#endif
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+        p_disp->stats.dma_total_bytes       += ROW_GAP_WORDS * sizeof(bus_word_t);
+#endif
+    }
+    for (int fb = 0; (res == ESP_OK) && (fb < NUM_DESC_CHAINS); fb++)
+    {
+        p_disp->dmadesc[fb] = (lldesc_t *)heap_caps_malloc(desccount_own * sizeof(lldesc_t), MALLOC_CAP_DMA);
+        if (p_disp->dmadesc[fb] == NULL)
+        {
+            WARNING("desc %d alloc", fb);
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+    if ( (res == ESP_OK) && (desccount_shared > 0) )
+    {
+        p_disp->dmadesc_shared = (lldesc_t *)heap_caps_malloc(desccount_shared * sizeof(lldesc_t), MALLOC_CAP_DMA);
+        if (p_disp->dmadesc_shared == NULL)
+        {
+            WARNING("desc shared alloc");
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+
+    //heap_caps_print_heap_info(MALLOC_CAP_DMA);
+
+    // fill DMA linked lists for all frames (or the ring)
+    for (int fb = 0; (res == ESP_OK) && (fb < NUM_DESC_CHAINS); fb++)
+    {
+        lldesc_t *dmadesc = p_disp->dmadesc[fb];
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+        s_link_rows_desc(p_disp, dmadesc, p_disp->ring, 0, OWN_DESC_ROWS);
+#  if !CONFIG_LEDDISPLAY_BUS_8BIT
+        p_disp->ring_last_desc = &dmadesc[desccount_own - 1];
+#  endif
+#else
+        // (with dithering, the sub-frames one after the other)
+        int desc_ix = 0;
+        for (int sub = 0; sub < DITHER_FRAMES; sub++)
+        {
+            if (sub > 0)
+            {
+                dmadesc[desc_ix - 1].qe.stqe_next = &dmadesc[desc_ix];
+            }
+            desc_ix += s_link_rows_desc(p_disp, &dmadesc[desc_ix], FRAME_BUF(p_disp, fb)[sub].rowdata, 0, OWN_DESC_ROWS);
+        }
+#endif
+        // continue with the shared descriptors
+        if (desccount_shared > 0)
+        {
+            dmadesc[desccount_own - 1].qe.stqe_next = &p_disp->dmadesc_shared[0];
+        }
+        else
+        {
+            dmadesc[desccount_own - 1].qe.stqe_next = (lldesc_t *)&dmadesc[0];
+        }
+        // the interrupt for the start of the refresh comes from the first descriptor, so that it
+        // tells which frame buffer the DMA started with (with the 8 bit bus that's the first row
+        // gap, see s_link_rows_desc(), and the ring has an interrupt at the end of each row)
+#if !CONFIG_LEDDISPLAY_BUS_8BIT && !CONFIG_LEDDISPLAY_PSRAM_RING
+        dmadesc[0].eof = 1;
+#endif
+    }
+    // the shared descriptors initially point to the first frame buffer, which the DMA starts with
+    if ( (res == ESP_OK) && (desccount_shared > 0) )
+    {
+        s_link_rows_desc(p_disp, p_disp->dmadesc_shared, FRAME_BUF(p_disp, 0)->rowdata, OWN_DESC_ROWS, ROWS_PER_FRAME - OWN_DESC_ROWS);
+        p_disp->dmadesc_shared[desccount_shared - 1].qe.stqe_next = (lldesc_t *)&p_disp->dmadesc[0][0];
+    }
+
+    // flush complete semaphore
+    if (res == ESP_OK)
+    {
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+        p_disp->shift_complete_sem = xSemaphoreCreateBinaryStatic(&p_disp->shift_complete_sem_buf);
+#else
+        p_disp->shift_complete_sem = xSemaphoreCreateBinary();
+#endif
+        i2s_parallel_set_shiftcomplete_cb(p_disp->dev, s_shift_complete_sem_cb, p_disp);
+    }
+
+    // ring task
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    if (res == ESP_OK)
+    {
+        res = s_ring_task_start(p_disp);
+    }
+#endif
+
+    // background render task
+#if CONFIG_LEDDISPLAY_RENDER_TASK
+    if (res == ESP_OK)
+    {
+        res = s_render_task_start(p_disp);
+    }
+#endif
+
+    // initialise parallel I2S
+    if (res == ESP_OK)
+    {
+        i2s_parallel_config_t cfg =
+        {
+            .gpio_bus =
+            {
+                p_gpio->r1,                  //  0 BIT_R1
+                p_gpio->g1,                  //  1 BIT_G1
+                p_gpio->b1,                  //  2 BIT_B1
+                p_gpio->r2,                  //  3 BIT_R2
+                p_gpio->g2,                  //  4 BIT_G2
+                p_gpio->b2,                  //  5 BIT_B2
+                p_gpio->lat,                 //  6 BIT_LAT
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+                -1,                          //  7 BIT_OE (see s_oe_pwm_init())
+#else
+                p_gpio->oe,                  //  7 BIT_OE
+#endif
+                p_gpio->a,                   //  8 BIT_A
+                p_gpio->b,                   //  9 BIT_B
+                p_gpio->c,                   // 10 BIT_C
+                p_gpio->d,                   // 11 BIT_D
+#if LEDDISPLAY_NEED_E_GPIO
+                p_gpio->e,                   // 12 BIT_E
+#else
+                -1,
+#endif
+                -1,                          // 13
+                -1,                          // 14
+                -1,                          // 15
+            },
+            .gpio_clk    = p_gpio->clk,
+            .clkspeed_hz = I2S_CLOCK_SPEED,
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            .bits        = I2S_PARALLEL_BITS_8,
+#else
+            .bits        = I2S_PARALLEL_BITS_16,
+#endif
+            .bufcount    = NUM_DESC_CHAINS,
+        };
+        for (int fb = 0; fb < NUM_DESC_CHAINS; fb++)
+        {
+            cfg.desccount[fb] = desccount_own;
+            cfg.lldesc[fb]    = p_disp->dmadesc[fb];
+        }
+        cfg.desccount_shared = desccount_shared;
+        cfg.lldesc_shared    = p_disp->dmadesc_shared;
+
+        esp_err_t res2 = i2s_parallel_setup(p_disp->dev, &cfg);
+        if (res2 != ESP_OK)
+        {
+            WARNING("i2s fail (%d, %s)", res2, esp_err_to_name(res2));
+            res = ESP_FAIL;
+        }
+    }
+
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    // output enable by the MCPWM
+    if (res == ESP_OK)
+    {
+        const esp_err_t res2 = s_oe_pwm_init(p_disp);
+        if (res2 != ESP_OK)
+        {
+            WARNING("oe mcpwm fail (%d, %s)", res2, esp_err_to_name(res2));
+            res = res2;
+        }
+    }
+#endif
+
+    if (res == ESP_OK)
+    {
+        INFO("display %d: init done (refresh rate %dHz)", p_disp->num, p_disp->stats.refresh_rate);
+    }
+    // clean up on error
+    else
+    {
+        WARNING("display %d: init fail: %s (%d)", p_disp->num, esp_err_to_name(res), res);
+        leddisplay_disp_shutdown(p_disp);
+    }
+    return res;
+}
+
+void leddisplay_disp_shutdown(leddisplay_t *p_disp)
+{
+    INFO("display %d: shutdown", p_disp->num);
+#if CONFIG_LEDDISPLAY_RENDER_TASK
+    s_render_task_stop(p_disp);
+#endif
+    i2s_parallel_stop(p_disp->dev);
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    s_oe_pwm_stop(p_disp);
+#endif
+#if CONFIG_LEDDISPLAY_SYNC_SLAVE
+    gpio_isr_handler_remove(CONFIG_LEDDISPLAY_SYNC_GPIO);
+#endif
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    s_ring_task_stop(p_disp);
+    if (p_disp->ring != NULL)
+    {
+        heap_caps_free(p_disp->ring);
+        p_disp->ring = NULL;
+    }
+#endif
+    if (p_disp->frames != NULL)
+    {
+        heap_caps_free(p_disp->frames);
+        p_disp->frames = NULL;
+    }
+    if (p_disp->palette != NULL)
+    {
+        heap_caps_free(p_disp->palette);
+        p_disp->palette = NULL;
+    }
+    for (int fb = 0; fb < NUM_DESC_CHAINS; fb++)
+    {
+        if (p_disp->dmadesc[fb] != NULL)
+        {
+            heap_caps_free(p_disp->dmadesc[fb]);
+            p_disp->dmadesc[fb] = NULL;
+        }
+    }
+    if (p_disp->dmadesc_shared != NULL)
+    {
+        heap_caps_free(p_disp->dmadesc_shared);
+        p_disp->dmadesc_shared = NULL;
+    }
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    if (p_disp->row_gap != NULL)
+    {
+        heap_caps_free(p_disp->row_gap);
+        p_disp->row_gap = NULL;
+    }
+#endif
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+#else
+    vSemaphoreDelete(p_disp->shift_complete_sem);
+    vSemaphoreDelete(p_disp->ctrl_mutex);
+#endif
+
+
+}
+
+esp_err_t leddisplay_disp_suspend(leddisplay_t *p_disp)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    const bool suspended = p_disp->suspended;
+    p_disp->suspended = true;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    if (suspended)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    DEBUG("display %d: suspend", p_disp->num);
+
+    // keep the display dark (the bus stops with whatever the DMA output last), and stop the DMA
+    gpio_set_level(p_disp->gpio->oe, 1);
+    gpio_matrix_out(p_disp->gpio->oe, SIG_GPIO_OUT_IDX, false, false);
+    i2s_parallel_pause(p_disp->dev);
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    s_ring_task_idle(p_disp);
+#endif
+
+    // a frame waiting for the next refresh will be the first one displayed on resume, and a task
+    // waiting for the previous front buffer can have it now (see s_wait_current_frame())
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    s_flip_suspended(p_disp);
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    xSemaphoreGive(p_disp->shift_complete_sem);
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_disp_resume(leddisplay_t *p_disp)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    const bool suspended = p_disp->suspended;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    if (!suspended)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    DEBUG("display %d: resume", p_disp->num);
+
+    // restart the DMA with the first row of the front buffer (whose interrupt, as for any other
+    // refresh, wakes up waiters and presents the frame), and display it
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    s_ring_prefill(p_disp);
+#endif
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->suspended = false;
+    p_disp->eof_restart = true;
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    const int chain = 0;
+#else
+    const int chain = p_disp->front_frame;
+#endif
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    i2s_parallel_resume(p_disp->dev, chain);
+    gpio_matrix_out(p_disp->gpio->oe, OE_GPIO_SIG(p_disp), false, false);
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_disp_set_low_power(leddisplay_t *p_disp, int enable)
+{
+#if CONFIG_LEDDISPLAY_SYNC_MASTER || CONFIG_LEDDISPLAY_SYNC_SLAVE
+    if (enable != 0)
+    {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
+    // the largest clock divider scale that keeps the refresh rate at or above the minimum
+    int div = 1;
+    if (enable != 0)
+    {
+        div = p_disp->refresh_rate_full / CONFIG_LEDDISPLAY_LOW_POWER_REFRESH;
+        if (div > LOW_POWER_DIV_MAX)
+        {
+            div = LOW_POWER_DIV_MAX;
+        }
+        if (div < 1)
+        {
+            div = 1;
+        }
+    }
+    const esp_err_t res = i2s_parallel_set_clock_div(p_disp->dev, div);
+    if (res != ESP_OK)
+    {
+        WARNING("clock div %d fail (%s)", div, esp_err_to_name(res));
+        return res;
+    }
+    p_disp->clock_div = div;
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    s_ctrl_lock(p_disp);
+    s_oe_pwm_set(p_disp, p_disp->brightness_val);
+    s_ctrl_unlock(p_disp);
+#endif
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->stats.refresh_rate = p_disp->refresh_rate_full / div;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+    DEBUG("low power %s (clock div %d, refresh rate %dHz)", enable != 0 ? "on" : "off", div, p_disp->refresh_rate_full / div);
+    return ESP_OK;
+}
+
+/* *********************************************************************************************** */
+
+// apply the brightness value to the control signals (and the MCPWM), must be called with
+// ctrl_mutex held
+static void s_brightness_apply(leddisplay_t *p_disp)
+{
+    leddisplay_enc_ctrl_bits(&p_disp->ctrl_bits, p_disp->brightness_val, p_disp->lsb_msb_transition_bit);
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    // the row gap is used by all frame buffers, so this changes the display right away
+    if (p_disp->row_gap != NULL)
+    {
+        leddisplay_enc_row_gap(p_disp->row_gap, ROW_GAP_WORDS, &p_disp->ctrl_bits);
+    }
+#endif
+
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    // the brightness is the width of the OE pulse, the control signals in the frame buffers don't
+    // depend on it
+    s_oe_pwm_set(p_disp, p_disp->brightness_val);
+#else
+    // patch the control signals of all frame buffers (including the one being displayed), so that
+    // the new brightness shows from the next refresh on (at the latest) without rendering anything
+    if (p_disp->frames != NULL)
+    {
+        for (int ix = 0; ix < (NUM_FRAME_BUFFERS * DITHER_FRAMES); ix++)
+        {
+            leddisplay_enc_ctrl_update(&p_disp->frames[ix], &p_disp->ctrl_bits);
+        }
+    }
+#endif
+}
+
+int leddisplay_disp_set_brightness(leddisplay_t *p_disp, int brightness)
+{
+    s_ctrl_lock(p_disp);
+    const int last_brightness_percent = p_disp->brightness_percent;
+
+    if (brightness <= 0)
+    {
+        p_disp->brightness_val = 0;
+        p_disp->brightness_percent = 0;
+    }
+    else if (brightness >= 100)
+    {
+        p_disp->brightness_val = BRIGHTNESS_MAX;
+        p_disp->brightness_percent = 100;
+    }
+    else
+    {
+        p_disp->brightness_percent = brightness;
+
+        // scale brightness percent to value for this display: 0..100% --> 0..BRIGHTNESS_MAX
+        const int brightness_val = (BRIGHTNESS_MAX * brightness) / 100;
+
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT
+
+        p_disp->brightness_val = (val2pwm_bits((brightness_val * 256) / BRIGHTNESS_MAX, 8) * BRIGHTNESS_MAX) / 256;
+
+#elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+
+        const int lut = (val2pwm_bits((brightness_val * 256) / BRIGHTNESS_MAX, 8) * BRIGHTNESS_MAX) / 256;
+        if (lut <= 0)
+        {
+            p_disp->brightness_val = 1;
+        }
+        else
+        {
+            p_disp->brightness_val = lut;
+        }
+
+#else
+        p_disp->brightness_val = brightness_val;
+#endif
+    }
+
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    // not more than the current limit allows
+    p_disp->brightness_set_val = p_disp->brightness_val;
+    if (p_disp->brightness_val > p_disp->brightness_limit_val)
+    {
+        p_disp->brightness_val = p_disp->brightness_limit_val;
+    }
+#endif
+
+    s_brightness_apply(p_disp);
+    s_ctrl_unlock(p_disp);
+
+    return last_brightness_percent;
+}
+
+int leddisplay_disp_get_brightness(leddisplay_t *p_disp)
+{
+    return p_disp->brightness_percent;
+}
+
+esp_err_t leddisplay_disp_set_current_limit(leddisplay_t *p_disp, int limit_ma)
+{
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    if (limit_ma < 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_ctrl_lock(p_disp);
+    p_disp->current_limit_ma = limit_ma;
+    s_ctrl_unlock(p_disp);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+// supply current of a frame buffer (without the base current) with the load at the brightness [uA]
+static uint64_t s_current_ua(const uint32_t load, const int brightness_val)
+{
+    return ((uint64_t)load * CONFIG_LEDDISPLAY_CURRENT_LED_UA * brightness_val) /
+        ((uint64_t)PWM_LOAD_MAX * BRIGHTNESS_MAX);
+}
+
+// estimate the current of the frame just rendered into the current frame buffer, and limit the
+// brightness so that neither that nor the frames that may be displayed until it is (the front,
+// the pending and any retired frame buffer) need more than the limit allows, so that a brighter frame is
+// dimmed before it is displayed, and the brightness of a darker frame increases with the next one,
+// the load of rows not written by the frame based encoder is measured from the frame buffer memory,
+// must be called with ctrl_mutex held
+static void s_current_update(leddisplay_t *p_disp)
+{
+    uint32_t *p_load_rows = p_disp->frame_load_rows[p_disp->current_frame];
+    const uint32_t stale_rows = p_disp->frame_load_stale_rows[p_disp->current_frame];
+    if (stale_rows != 0)
+    {
+        for (int row = 0; row < ROWS_PER_FRAME; row++)
+        {
+            if ((stale_rows & ROW_MASK(row)) != 0)
+            {
+                p_load_rows[row] = 0;
+            }
+        }
+        for (int sub = 0; sub < DITHER_FRAMES; sub++)
+        {
+            leddisplay_enc_load_rows(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], stale_rows, p_load_rows);
+        }
+        p_disp->frame_load_stale_rows[p_disp->current_frame] = 0;
+    }
+
+    uint32_t load = 0;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        load += p_load_rows[row];
+    }
+    p_disp->frame_load[p_disp->current_frame] = load;
+
+    int limit_val = BRIGHTNESS_MAX;
+    if (p_disp->current_limit_ma > 0)
+    {
+        portENTER_CRITICAL(&p_disp->frames_mux);
+        uint32_t load_max = load;
+        if (p_disp->frame_load[p_disp->front_frame] > load_max)
+        {
+            load_max = p_disp->frame_load[p_disp->front_frame];
+        }
+        for (int ix = 0; ix < NUM_FRAME_BUFFERS; ix++)
+        {
+            if ( ((ix == p_disp->pending_frame) || ((p_disp->retired_frames & BIT(ix)) != 0)) && (p_disp->frame_load[ix] > load_max) )
+            {
+                load_max = p_disp->frame_load[ix];
+            }
+        }
+        portEXIT_CRITICAL(&p_disp->frames_mux);
+
+        const int64_t budget_ua = ((int64_t)p_disp->current_limit_ma - CONFIG_LEDDISPLAY_CURRENT_BASE_MA) * 1000;
+        const uint64_t full_ua = s_current_ua(load_max, BRIGHTNESS_MAX);
+        if (budget_ua <= 0)
+        {
+            limit_val = 0;
+        }
+        else if (full_ua > (uint64_t)budget_ua)
+        {
+            limit_val = ((uint64_t)budget_ua * BRIGHTNESS_MAX) / full_ua;
+        }
+    }
+    p_disp->brightness_limit_val = limit_val;
+
+    const int brightness_val = p_disp->brightness_set_val < limit_val ? p_disp->brightness_set_val : limit_val;
+    if (brightness_val != p_disp->brightness_val)
+    {
+        p_disp->brightness_val = brightness_val;
+        s_brightness_apply(p_disp);
+    }
+
+    const uint32_t current_ma = CONFIG_LEDDISPLAY_CURRENT_BASE_MA + ((s_current_ua(load, brightness_val) + 500) / 1000);
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->stats.current_ma = current_ma;
+    if (current_ma > p_disp->stats.current_ma_max)
+    {
+        p_disp->stats.current_ma_max = current_ma;
+    }
+    if (brightness_val < p_disp->brightness_set_val)
+    {
+        p_disp->stats.current_limited++;
+    }
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+}
+#endif
+
+void leddisplay_disp_get_stats(leddisplay_t *p_disp, leddisplay_stats_t *p_stats)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    *p_stats = p_disp->stats;
+
+    // start next measurement period
+    const uint32_t count = p_disp->stats.refresh_count - p_disp->eof_ref_count;
+    const int64_t duration = p_disp->eof_time - p_disp->eof_ref_time;
+    p_disp->eof_ref_count = p_disp->stats.refresh_count;
+    p_disp->eof_ref_time = p_disp->eof_time;
+    p_disp->stats.refresh_period_min = 0;
+    p_disp->stats.refresh_period_max = 0;
+    p_disp->stats.sync_phase_error_max = 0;
+    p_disp->stats.current_ma_max = 0;
+#if CONFIG_LEDDISPLAY_PSRAM_RING
+    p_disp->stats.ring_lead_min = RING_ROWS - 1;
+#endif
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+
+    p_stats->refresh_rate_measured = duration > 0 ? ((int64_t)count * 1000000 + (duration / 2)) / duration : 0;
+}
+
+/* *********************************************************************************************** */
+
+void leddisplay_disp_pixel_xy_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+{
+    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    {
+        return;
+    }
+    p_disp->frame_stale_rows[p_disp->current_frame] |= leddisplay_enc_row_mask(y_coord);
+    PERSIST_DRAWN(p_disp, leddisplay_enc_row_mask(y_coord));
+    LOAD_STALE(p_disp, leddisplay_enc_row_mask(y_coord));
+    s_ctrl_lock(p_disp);
+    for (int sub = 0; sub < DITHER_FRAMES; sub++)
+    {
+        leddisplay_enc_pixel_xy(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], &p_disp->ctrl_bits, x_coord, y_coord, red, green, blue);
+    }
+    s_ctrl_unlock(p_disp);
+}
+
+void leddisplay_disp_pixel_fill_rgb(leddisplay_t *p_disp, uint8_t red, uint8_t green, uint8_t blue)
+{
+    p_disp->frame_stale_rows[p_disp->current_frame] = ROWS_MASK_ALL;
+    PERSIST_DRAWN(p_disp, ROWS_MASK_ALL);
+    LOAD_STALE(p_disp, ROWS_MASK_ALL);
+    s_ctrl_lock(p_disp);
+    for (int sub = 0; sub < DITHER_FRAMES; sub++)
+    {
+        leddisplay_enc_fill(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], &p_disp->ctrl_bits, red, green, blue);
+    }
+    s_ctrl_unlock(p_disp);
+}
+
+// set rows of pixels from the pixel data (rgb_step 0 for one colour, 3 for RGB triplets, or -1 for
+// RGB565 values, rows stride bytes apart), clipped to the display
+static void s_pixel_rect(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint8_t *p_data, const int rgb_step, const uint32_t stride)
+{
+    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    {
+        return;
+    }
+    const uint16_t span_width = width < (LEDDISPLAY_WIDTH - x_coord) ? width : (LEDDISPLAY_WIDTH - x_coord);
+    const uint16_t y_end = height < (LEDDISPLAY_HEIGHT - y_coord) ? (y_coord + height) : LEDDISPLAY_HEIGHT;
+    s_ctrl_lock(p_disp);
+    for (uint16_t y = y_coord; y < y_end; y++)
+    {
+        p_disp->frame_stale_rows[p_disp->current_frame] |= leddisplay_enc_row_mask(y);
+        PERSIST_DRAWN(p_disp, leddisplay_enc_row_mask(y));
+        LOAD_STALE(p_disp, leddisplay_enc_row_mask(y));
+        for (int sub = 0; sub < DITHER_FRAMES; sub++)
+        {
+            if (rgb_step < 0)
+            {
+                leddisplay_enc_pixel_span_rgb565(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], &p_disp->ctrl_bits, x_coord, y, span_width, (const uint16_t *)p_data);
+            }
+            else
+            {
+                leddisplay_enc_pixel_span(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], &p_disp->ctrl_bits, x_coord, y, span_width, p_data, rgb_step);
+            }
+        }
+        p_data += stride;
+    }
+    s_ctrl_unlock(p_disp);
+}
+
+void leddisplay_disp_pixel_hline_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint8_t red, uint8_t green, uint8_t blue)
+{
+    const uint8_t rgb[3] = { red, green, blue };
+    s_pixel_rect(p_disp, x_coord, y_coord, width, 1, rgb, 0, 0);
+}
+
+void leddisplay_disp_pixel_rect_fill_rgb(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    uint8_t red, uint8_t green, uint8_t blue)
+{
+    const uint8_t rgb[3] = { red, green, blue };
+    s_pixel_rect(p_disp, x_coord, y_coord, width, height, rgb, 0, 0);
+}
+
+void leddisplay_disp_pixel_blit(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height, const uint8_t *p_rgb)
+{
+    s_pixel_rect(p_disp, x_coord, y_coord, width, height, p_rgb, 3, 3 * (uint32_t)width);
+}
+
+void leddisplay_disp_pixel_flush_rgb888(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint8_t *p_rgb, uint16_t stride)
+{
+    s_pixel_rect(p_disp, x_coord, y_coord, width, height, p_rgb, 3, 3 * (uint32_t)(stride > 0 ? stride : width));
+}
+
+void leddisplay_disp_pixel_flush_rgb565(leddisplay_t *p_disp, uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint16_t *p_rgb565, uint16_t stride)
+{
+    s_pixel_rect(p_disp, x_coord, y_coord, width, height, (const uint8_t *)p_rgb565, -1, 2 * (uint32_t)(stride > 0 ? stride : width));
+}
+
+/* *********************************************************************************************** */
+
+inline void leddisplay_frame_xy_rgb(leddisplay_frame_t *p_frame, uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+{
+    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    {
+        return;
+    }
+    p_frame->yx[y_coord][x_coord][0] = red;
+    p_frame->yx[y_coord][x_coord][1] = green;
+    p_frame->yx[y_coord][x_coord][2] = blue;
+}
+
+inline void leddisplay_frame_fill_rgb(leddisplay_frame_t *p_frame, uint8_t red, uint8_t green, uint8_t blue)
+{
+    if ( (red == green) && (red == blue) )
+    {
+        memset(p_frame, red, sizeof(*p_frame));
+    }
+    else
+    {
+        for (uint16_t ix = 0; ix < NUMOF(p_frame->ix); ix++)
+        {
+            p_frame->ix[ix][0] = red;
+            p_frame->ix[ix][1] = green;
+            p_frame->ix[ix][2] = blue;
+        }
+    }
+}
+
+inline void leddisplay_frame_clear(leddisplay_frame_t *p_frame)
+{
+    memset(p_frame, 0, sizeof(*p_frame));
+}
+
+// render rows of the frame into the current frame buffer, and any rows that are not up to date in it
+void leddisplay_disp_frame_render_rows(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, const uint32_t dirty_rows)
+{
+    // if necessary, block until current framebuffer memory becomes available
+    s_wait_current_frame(p_disp);
+
+    const int64_t t0 = esp_timer_get_time();
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    uint32_t *p_load = p_disp->frame_load_rows[p_disp->current_frame];
+#else
+    uint32_t *p_load = NULL;
+#endif
+    s_ctrl_lock(p_disp);
+    leddisplay_enc_frame_rows(FRAME_BUF(p_disp, p_disp->current_frame), &p_disp->ctrl_bits, p_frame, dirty_rows | p_disp->frame_stale_rows[p_disp->current_frame], p_load);
+    PERSIST_DRAWN(p_disp, dirty_rows | p_disp->frame_stale_rows[p_disp->current_frame]);
+    const uint32_t dt = esp_timer_get_time() - t0;
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->stats.encode_time_last = dt;
+    if (dt > p_disp->stats.encode_time_max)
+    {
+        p_disp->stats.encode_time_max = dt;
+    }
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+
+#if CONFIG_LEDDISPLAY_CURRENT_EST
+    p_disp->frame_load_stale_rows[p_disp->current_frame] &= ~(dirty_rows | p_disp->frame_stale_rows[p_disp->current_frame]);
+    s_current_update(p_disp);
+#endif
+    s_ctrl_unlock(p_disp);
+
+    // this buffer now matches the frame, the dirty rows in all other buffers don't
+    for (int ix = 0; ix < NUM_FRAME_BUFFERS; ix++)
+    {
+        p_disp->frame_stale_rows[ix] = (ix == p_disp->current_frame) ? 0 : (p_disp->frame_stale_rows[ix] | dirty_rows);
+    }
+}
+
+static void s_frame_update_rows(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, const uint32_t dirty_rows)
+{
+    leddisplay_disp_frame_render_rows(p_disp, p_frame, dirty_rows);
+    leddisplay_disp_pixel_update(p_disp, 0);
+}
+
+void leddisplay_disp_frame_update(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame)
+{
+    s_frame_update_rows(p_disp, p_frame, ROWS_MASK_ALL);
+}
+
+void leddisplay_disp_frame_update_rect(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame,
+    uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height)
+{
+    // the rows of the frame buffer that intersect the rectangle (width doesn't matter as each
+    // frame buffer row contains all pixels of two display rows anyway)
+    uint32_t dirty_rows = 0;
+    if ( (x_coord < LEDDISPLAY_WIDTH) && (width > 0) )
+    {
+        for (uint32_t y = y_coord; (y < ((uint32_t)y_coord + height)) && (y < LEDDISPLAY_HEIGHT); y++)
+        {
+            dirty_rows |= leddisplay_enc_row_mask(y);
+        }
+    }
+
+    s_frame_update_rows(p_disp, p_frame, dirty_rows);
+}
+
+/* *********************************************************************************************** */
+
+static esp_err_t s_palette_alloc(leddisplay_t *p_disp)
+{
+    if (p_disp->palette == NULL)
+    {
+        p_disp->palette = (palette_bits_t *)heap_caps_malloc(sizeof(*p_disp->palette), MALLOC_CAP_8BIT);
+        if (p_disp->palette == NULL)
+        {
+            WARNING("palette alloc");
+            return ESP_ERR_NO_MEM;
+        }
+        memset(p_disp->palette, 0, sizeof(*p_disp->palette));
+    }
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_disp_palette_set(leddisplay_t *p_disp, const uint8_t *p_rgb, int first, int num)
+{
+    if ( (p_rgb == NULL) || (first < 0) || (num < 0) || ((first + num) > NUMOF(p_disp->palette->planes)) )
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const esp_err_t res = s_palette_alloc(p_disp);
+    if (res != ESP_OK)
+    {
+        return res;
+    }
+    for (int colour = first; colour < (first + num); colour++)
+    {
+        leddisplay_enc_palette(p_disp->palette, colour, p_rgb[0], p_rgb[1], p_rgb[2]);
+        p_rgb += 3;
+    }
+    return ESP_OK;
+}
+
+static void s_frame_ix_update(leddisplay_t *p_disp, const uint8_t *p_frame, const int bits)
+{
+    if (s_palette_alloc(p_disp) != ESP_OK)
+    {
+        return;
+    }
+
+    // if necessary, block until current framebuffer memory becomes available
+    s_wait_current_frame(p_disp);
+
+    const int64_t t0 = esp_timer_get_time();
+    s_ctrl_lock(p_disp);
+    for (int sub = 0; sub < DITHER_FRAMES; sub++)
+    {
+        leddisplay_enc_frame_ix_rows(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], &p_disp->ctrl_bits, p_disp->palette, p_frame, bits, ROWS_MASK_ALL);
+    }
+    s_ctrl_unlock(p_disp);
+    const uint32_t dt = esp_timer_get_time() - t0;
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->stats.encode_time_last = dt;
+    if (dt > p_disp->stats.encode_time_max)
+    {
+        p_disp->stats.encode_time_max = dt;
+    }
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+
+    // the frame buffer no longer matches the last frame rendered using the (RGB) frame based functions
+    p_disp->frame_stale_rows[p_disp->current_frame] = ROWS_MASK_ALL;
+    PERSIST_DRAWN(p_disp, ROWS_MASK_ALL);
+    LOAD_STALE(p_disp, ROWS_MASK_ALL);
+    leddisplay_disp_pixel_update(p_disp, 0);
+}
+
+void leddisplay_disp_frame8_update(leddisplay_t *p_disp, const leddisplay_frame8_t *p_frame)
+{
+    s_frame_ix_update(p_disp, p_frame->ix, 8);
+}
+
+void leddisplay_frame4_xy(leddisplay_frame4_t *p_frame, uint16_t x_coord, uint16_t y_coord, uint8_t colour)
+{
+    if ( (x_coord >= LEDDISPLAY_WIDTH) || (y_coord >= LEDDISPLAY_HEIGHT) )
+    {
+        return;
+    }
+    uint8_t *p_pair = &p_frame->yx[y_coord][x_coord / 2];
+    if ((x_coord % 2) == 0)
+    {
+        *p_pair = (*p_pair & 0xf0) | (colour & 0x0f);
+    }
+    else
+    {
+        *p_pair = (*p_pair & 0x0f) | (colour << 4);
+    }
+}
+
+void leddisplay_disp_frame4_update(leddisplay_t *p_disp, const leddisplay_frame4_t *p_frame)
+{
+    s_frame_ix_update(p_disp, p_frame->ix, 4);
+}
+
+/* *********************************************************************************************** */
+
+void leddisplay_disp_direct_get(leddisplay_t *p_disp, leddisplay_direct_t *p_direct)
+{
+    // if necessary, block until current framebuffer memory becomes available
+    s_wait_current_frame(p_disp);
+
+    p_direct->mem           = (uint8_t *)FRAME_BUF(p_disp, p_disp->current_frame);
+    p_direct->size          = sizeof(frame_t);
+    p_direct->num_rows      = ROWS_PER_FRAME;
+    p_direct->num_bitplanes = COLOR_DEPTH_BITS;
+    p_direct->num_words     = CHAIN_WIDTH;
+    p_direct->word_size     = sizeof(bus_word_t);
+    p_direct->ctrl          = &p_disp->ctrl_bits.oe[0][0];
+}
+
+void leddisplay_disp_direct_update(leddisplay_t *p_disp, int block)
+{
+    // the frame buffer no longer matches the last frame rendered using the frame based functions
+    p_disp->frame_stale_rows[p_disp->current_frame] = ROWS_MASK_ALL;
+    PERSIST_DRAWN(p_disp, ROWS_MASK_ALL);
+    LOAD_STALE(p_disp, ROWS_MASK_ALL);
+#if DITHER_FRAMES > 1
+    // the direct access is to the first sub-frame, the others show the same
+    s_ctrl_lock(p_disp);
+    for (int sub = 1; sub < DITHER_FRAMES; sub++)
+    {
+        memcpy(&FRAME_BUF(p_disp, p_disp->current_frame)[sub], FRAME_BUF(p_disp, p_disp->current_frame), sizeof(frame_t));
+    }
+    s_ctrl_unlock(p_disp);
+#endif
+    leddisplay_disp_pixel_update(p_disp, block);
+}
+
+/* *********************************************************************************************** */
+
+#if CONFIG_LEDDISPLAY_RENDER_TASK
+
+// how often the render task checks if it should stop while waiting for a frame to be displayed
+// (which doesn't happen while the refresh is suspended) [ms]
+#define RENDER_STOP_POLL_MS 100
+
+static void s_render_task_func(void *p_param)
+{
+    leddisplay_t *p_disp = (leddisplay_t *)p_param;
+    while (true)
+    {
+        // wait for frame to render (or to stop)
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (p_disp->render_stop)
+        {
+            break;
+        }
+
+        // render the frame
+        s_frame_update_rows(p_disp, p_disp->render_frame, ROWS_MASK_ALL);
+        const uint32_t frame = leddisplay_disp_get_frame_number(p_disp);
+        xSemaphoreGive(p_disp->render_free_sem);
+        portENTER_CRITICAL(&p_disp->frames_mux);
+        const leddisplay_frame_cb_t cb = p_disp->render_cb;
+        void *arg = p_disp->render_cb_arg;
+        portEXIT_CRITICAL(&p_disp->frames_mux);
+        if (cb != NULL)
+        {
+            cb(LEDDISPLAY_FRAME_RENDERED, arg);
+        }
+
+        // the new frame is displayed after the current refresh has completed (and then the
+        // previously displayed buffer is available for the next frame again)
+        if (cb != NULL)
+        {
+            esp_err_t res = ESP_ERR_TIMEOUT;
+            while ( (res != ESP_OK) && !p_disp->render_stop )
+            {
+                res = leddisplay_disp_wait_present(p_disp, frame, RENDER_STOP_POLL_MS);
+            }
+            if (res == ESP_OK)
+            {
+                cb(LEDDISPLAY_FRAME_DISPLAYED, arg);
+            }
+        }
+    }
+    xSemaphoreGive(p_disp->render_done_sem);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t s_render_task_start(leddisplay_t *p_disp)
+{
+    p_disp->render_frame = (leddisplay_frame_t *)heap_caps_malloc(sizeof(*p_disp->render_frame), MALLOC_CAP_8BIT);
+    if (p_disp->render_frame == NULL)
+    {
+        WARNING("render frame alloc");
+        return ESP_ERR_NO_MEM;
+    }
+
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+    p_disp->render_free_sem = xSemaphoreCreateBinaryStatic(&p_disp->render_free_sem_buf);
+#else
+    p_disp->render_free_sem = xSemaphoreCreateBinary();
+#endif
+    xSemaphoreGive(p_disp->render_free_sem);
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+    p_disp->render_done_sem = xSemaphoreCreateBinaryStatic(&p_disp->render_done_sem_buf);
+#else
+    p_disp->render_done_sem = xSemaphoreCreateBinary();
+#endif
+    p_disp->render_stop = false;
+
+#if CONFIG_LEDDISPLAY_SECOND_DISP
+    const int core = p_disp->num == 0 ? CONFIG_LEDDISPLAY_RENDER_TASK_CORE : CONFIG_LEDDISPLAY_DISP1_RENDER_TASK_CORE;
+#else
+    const int core = CONFIG_LEDDISPLAY_RENDER_TASK_CORE;
+#endif
+    if (xTaskCreatePinnedToCore(s_render_task_func, p_disp->num == 0 ? "leddisplay" : "leddisplay1",
+            3072 / sizeof(StackType_t), p_disp, CONFIG_LEDDISPLAY_RENDER_TASK_PRIO, &p_disp->render_task, core) != pdPASS)
+    {
+        WARNING("render task");
+        p_disp->render_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static void s_render_task_stop(leddisplay_t *p_disp)
+{
+    if (p_disp->render_task != NULL)
+    {
+        // wait until the task is done with the current frame (so that no other one is submitted),
+        // then let it end itself, once it is back at the top of its loop (not while it may be in
+        // the frame callback, or waiting for a refresh)
+        xSemaphoreTake(p_disp->render_free_sem, portMAX_DELAY);
+        p_disp->render_stop = true;
+        xTaskNotifyGive(p_disp->render_task);
+        xSemaphoreTake(p_disp->render_done_sem, portMAX_DELAY);
+        p_disp->render_task = NULL;
+    }
+    if (p_disp->render_frame != NULL)
+    {
+        heap_caps_free(p_disp->render_frame);
+        p_disp->render_frame = NULL;
+    }
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+#else
+    if (p_disp->render_free_sem != NULL)
+    {
+        vSemaphoreDelete(p_disp->render_free_sem);
+    }
+    if (p_disp->render_done_sem != NULL)
+    {
+        vSemaphoreDelete(p_disp->render_done_sem);
+    }
+#endif
+    p_disp->render_free_sem = NULL;
+    p_disp->render_done_sem = NULL;
+}
+
+esp_err_t leddisplay_disp_frame_submit(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, int timeout_ms)
+{
+    if (p_disp->render_task == NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const TickType_t timeout = timeout_ms < 0 ? portMAX_DELAY : (timeout_ms / portTICK_PERIOD_MS);
+    if (xSemaphoreTake(p_disp->render_free_sem, timeout) != pdTRUE)
+    {
+        portENTER_CRITICAL(&p_disp->frames_mux);
+        p_disp->stats.frames_dropped++;
+        portEXIT_CRITICAL(&p_disp->frames_mux);
+        return ESP_ERR_TIMEOUT;
+    }
+    memcpy(p_disp->render_frame, p_frame, sizeof(*p_disp->render_frame));
+    xTaskNotifyGive(p_disp->render_task);
+    return ESP_OK;
+}
+
+void leddisplay_disp_set_frame_cb(leddisplay_t *p_disp, leddisplay_frame_cb_t cb, void *arg)
+{
+    portENTER_CRITICAL(&p_disp->frames_mux);
+    p_disp->render_cb = cb;
+    p_disp->render_cb_arg = arg;
+    portEXIT_CRITICAL(&p_disp->frames_mux);
+}
+
+#else // CONFIG_LEDDISPLAY_RENDER_TASK
+
+esp_err_t leddisplay_disp_frame_submit(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, int timeout_ms)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void leddisplay_disp_set_frame_cb(leddisplay_t *p_disp, leddisplay_frame_cb_t cb, void *arg)
+{
+}
+
+#endif // CONFIG_LEDDISPLAY_RENDER_TASK
+
+/* *********************************************************************************************** */
+
+leddisplay_t *leddisplay_get_disp(int num)
+{
+    return (num >= 0) && (num < LEDDISPLAY_NUM_DISPS) ? &s_disps[num] : NULL;
+}
+
+// the functions without the display argument are for the first display
+
+esp_err_t leddisplay_init(void)
+{
+    return leddisplay_disp_init(&s_disps[0]);
+}
+
+void leddisplay_shutdown(void)
+{
+    leddisplay_disp_shutdown(&s_disps[0]);
+}
+
+esp_err_t leddisplay_suspend(void)
+{
+    return leddisplay_disp_suspend(&s_disps[0]);
+}
+
+esp_err_t leddisplay_resume(void)
+{
+    return leddisplay_disp_resume(&s_disps[0]);
+}
+
+esp_err_t leddisplay_set_low_power(int enable)
+{
+    return leddisplay_disp_set_low_power(&s_disps[0], enable);
+}
+
+int leddisplay_set_brightness(int brightness)
+{
+    return leddisplay_disp_set_brightness(&s_disps[0], brightness);
+}
+
+int leddisplay_get_brightness(void)
+{
+    return leddisplay_disp_get_brightness(&s_disps[0]);
+}
+
+esp_err_t leddisplay_set_current_limit(int limit_ma)
+{
+    return leddisplay_disp_set_current_limit(&s_disps[0], limit_ma);
+}
+
+void leddisplay_get_stats(leddisplay_stats_t *p_stats)
+{
+    leddisplay_disp_get_stats(&s_disps[0], p_stats);
+}
+
+void leddisplay_pixel_xy_rgb(uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+{
+    leddisplay_disp_pixel_xy_rgb(&s_disps[0], x_coord, y_coord, red, green, blue);
+}
+
+void leddisplay_pixel_fill_rgb(uint8_t red, uint8_t green, uint8_t blue)
+{
+    leddisplay_disp_pixel_fill_rgb(&s_disps[0], red, green, blue);
+}
+
+void leddisplay_pixel_hline_rgb(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint8_t red, uint8_t green, uint8_t blue)
+{
+    leddisplay_disp_pixel_hline_rgb(&s_disps[0], x_coord, y_coord, width, red, green, blue);
+}
+
+void leddisplay_pixel_rect_fill_rgb(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    uint8_t red, uint8_t green, uint8_t blue)
+{
+    leddisplay_disp_pixel_rect_fill_rgb(&s_disps[0], x_coord, y_coord, width, height, red, green, blue);
+}
+
+void leddisplay_pixel_blit(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height, const uint8_t *p_rgb)
+{
+    leddisplay_disp_pixel_blit(&s_disps[0], x_coord, y_coord, width, height, p_rgb);
+}
+
+void leddisplay_pixel_flush_rgb888(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint8_t *p_rgb, uint16_t stride)
+{
+    leddisplay_disp_pixel_flush_rgb888(&s_disps[0], x_coord, y_coord, width, height, p_rgb, stride);
+}
+
+void leddisplay_pixel_flush_rgb565(uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height,
+    const uint16_t *p_rgb565, uint16_t stride)
+{
+    leddisplay_disp_pixel_flush_rgb565(&s_disps[0], x_coord, y_coord, width, height, p_rgb565, stride);
+}
+
+void leddisplay_pixel_update(int block)
+{
+    leddisplay_disp_pixel_update(&s_disps[0], block);
+}
+
+void leddisplay_frame_render_rows(const leddisplay_frame_t *p_frame, const uint32_t dirty_rows)
+{
+    leddisplay_disp_frame_render_rows(&s_disps[0], p_frame, dirty_rows);
+}
+
+void leddisplay_frame_update(const leddisplay_frame_t *p_frame)
+{
+    leddisplay_disp_frame_update(&s_disps[0], p_frame);
+}
+
+void leddisplay_frame_update_rect(const leddisplay_frame_t *p_frame,
+    uint16_t x_coord, uint16_t y_coord, uint16_t width, uint16_t height)
+{
+    leddisplay_disp_frame_update_rect(&s_disps[0], p_frame, x_coord, y_coord, width, height);
+}
+
+esp_err_t leddisplay_frame_submit(const leddisplay_frame_t *p_frame, int timeout_ms)
+{
+    return leddisplay_disp_frame_submit(&s_disps[0], p_frame, timeout_ms);
+}
+
+void leddisplay_set_frame_cb(leddisplay_frame_cb_t cb, void *arg)
+{
+    leddisplay_disp_set_frame_cb(&s_disps[0], cb, arg);
+}
+
+esp_err_t leddisplay_palette_set(const uint8_t *p_rgb, int first, int num)
+{
+    return leddisplay_disp_palette_set(&s_disps[0], p_rgb, first, num);
+}
+
+void leddisplay_frame8_update(const leddisplay_frame8_t *p_frame)
+{
+    leddisplay_disp_frame8_update(&s_disps[0], p_frame);
+}
+
+void leddisplay_frame4_update(const leddisplay_frame4_t *p_frame)
+{
+    leddisplay_disp_frame4_update(&s_disps[0], p_frame);
+}
+
+void leddisplay_direct_get(leddisplay_direct_t *p_direct)
+{
+    leddisplay_disp_direct_get(&s_disps[0], p_direct);
+}
+
+void leddisplay_direct_update(int block)
+{
+    leddisplay_disp_direct_update(&s_disps[0], block);
+}
+
+void leddisplay_set_present_cb(leddisplay_present_cb_t cb, void *arg)
+{
+    leddisplay_disp_set_present_cb(&s_disps[0], cb, arg);
+}
+
+uint32_t leddisplay_get_frame_number(void)
+{
+    return leddisplay_disp_get_frame_number(&s_disps[0]);
+}
+
+void leddisplay_get_present(leddisplay_present_t *p_present)
+{
+    leddisplay_disp_get_present(&s_disps[0], p_present);
+}
+
+esp_err_t leddisplay_wait_vsync(int timeout_ms)
+{
+    return leddisplay_disp_wait_vsync(&s_disps[0], timeout_ms);
+}
+
+esp_err_t leddisplay_wait_present(uint32_t frame, int timeout_ms)
+{
+    return leddisplay_disp_wait_present(&s_disps[0], frame, timeout_ms);
+}
+
+/* *********************************************************************************************** */
\ No newline at end of file
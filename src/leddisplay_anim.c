@@ -0,0 +1,309 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: pre-encoded animations player
+
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    See include/leddisplay_anim.h for the format. The animation encoder is in
+    examples/leddisplay_host.
+*/
+
+/* *********************************************************************************************** */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sdkconfig.h>
+#include <esp_log.h>
+#include <esp_partition.h>
+
+#include "leddisplay_enc.h"
+
+#include "leddisplay.h"
+#include "leddisplay_anim.h"
+
+/* *********************************************************************************************** */
+// local logging and debugging
+
+#define LOGNAME "leddisplay"
+#define ERROR(fmt, ...)   ESP_LOGE(LOGNAME, fmt, ## __VA_ARGS__)
+#define WARNING(fmt, ...) ESP_LOGW(LOGNAME, fmt, ## __VA_ARGS__)
+#define INFO(fmt, ...)    ESP_LOGI(LOGNAME, fmt, ## __VA_ARGS__)
+#define DEBUG(fmt, ...)   ESP_LOGD(LOGNAME, fmt, ## __VA_ARGS__)
+
+/* *********************************************************************************************** */
+
+// number of values (bus words) per frame
+#define ANIM_NUM_VALUES (ROWS_PER_FRAME * COLOR_DEPTH_BITS * CHAIN_WIDTH)
+
+// next byte of the animation data, -1 at the end of the data
+static int s_anim_byte(leddisplay_anim_t *p_anim)
+{
+    if (p_anim->read == NULL)
+    {
+        return p_anim->pos < p_anim->size ? p_anim->data[p_anim->pos++] : -1;
+    }
+    if (p_anim->pos >= p_anim->len)
+    {
+        const int len = p_anim->read(p_anim->arg, p_anim->buf, sizeof(p_anim->buf));
+        if (len <= 0)
+        {
+            return -1;
+        }
+        p_anim->len = len;
+        p_anim->pos = 0;
+    }
+    return p_anim->buf[p_anim->pos++];
+}
+
+// next n (<= 4) bytes of the animation data as a little endian value, -1 at the end of the data
+static int64_t s_anim_uint(leddisplay_anim_t *p_anim, const int n)
+{
+    int64_t val = 0;
+    for (int ix = 0; ix < n; ix++)
+    {
+        const int byte = s_anim_byte(p_anim);
+        if (byte < 0)
+        {
+            return -1;
+        }
+        val |= (int64_t)byte << (8 * ix);
+    }
+    return val;
+}
+
+// read and check the header, allocate the state, the data source must be set
+static esp_err_t s_anim_open(leddisplay_anim_t *p_anim)
+{
+    const int64_t magic         = s_anim_uint(p_anim, 4);
+    const int64_t num_words     = s_anim_uint(p_anim, 2);
+    const int64_t num_rows      = s_anim_uint(p_anim, 1);
+    const int64_t num_bitplanes = s_anim_uint(p_anim, 1);
+    const int64_t num_frames    = s_anim_uint(p_anim, 2);
+    const int64_t frame_ms      = s_anim_uint(p_anim, 2);
+    const int64_t reserved      = s_anim_uint(p_anim, 4);
+    if ( (magic != 0x3141444c) /* "LDA1" */ || (reserved != 0) || (num_frames < 1) || (frame_ms < 0) )
+    {
+        WARNING("anim: not an animation");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ( (num_words != CHAIN_WIDTH) || (num_rows != ROWS_PER_FRAME) || (num_bitplanes != COLOR_DEPTH_BITS) )
+    {
+        WARNING("anim: wrong configuration (%d words, %d rows, %d bitplanes, expected %d, %d, %d)",
+            (int)num_words, (int)num_rows, (int)num_bitplanes, CHAIN_WIDTH, ROWS_PER_FRAME, COLOR_DEPTH_BITS);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    p_anim->state = malloc(ANIM_NUM_VALUES);
+    if (p_anim->state == NULL)
+    {
+        WARNING("anim: malloc state (%u bytes)", ANIM_NUM_VALUES);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(p_anim->state, 0, ANIM_NUM_VALUES);
+    p_anim->num_frames = num_frames;
+    p_anim->frame_ms   = frame_ms;
+    p_anim->frame      = 0;
+    DEBUG("anim: %d frames, %dms", p_anim->num_frames, p_anim->frame_ms);
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_anim_open_mem(leddisplay_anim_t *p_anim, const void *p_data, uint32_t size)
+{
+    memset(p_anim, 0, sizeof(*p_anim));
+    p_anim->data = p_data;
+    p_anim->size = size;
+    return s_anim_open(p_anim);
+}
+
+esp_err_t leddisplay_anim_open_partition(leddisplay_anim_t *p_anim, const char *label)
+{
+    const esp_partition_t *p_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (p_part == NULL)
+    {
+        WARNING("anim: no partition %s", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const void *p_data = NULL;
+    spi_flash_mmap_handle_t handle;
+    esp_err_t res = esp_partition_mmap(p_part, 0, p_part->size, SPI_FLASH_MMAP_DATA, &p_data, &handle);
+    if (res != ESP_OK)
+    {
+        WARNING("anim: mmap partition %s (%s)", label, esp_err_to_name(res));
+        return res;
+    }
+    res = leddisplay_anim_open_mem(p_anim, p_data, p_part->size);
+    if (res == ESP_OK)
+    {
+        p_anim->mmap    = handle;
+        p_anim->mmapped = true;
+    }
+    else
+    {
+        spi_flash_munmap(handle);
+    }
+    return res;
+}
+
+esp_err_t leddisplay_anim_open_stream(leddisplay_anim_t *p_anim, leddisplay_anim_read_t read, void *arg)
+{
+    memset(p_anim, 0, sizeof(*p_anim));
+    p_anim->read = read;
+    p_anim->arg  = arg;
+    return s_anim_open(p_anim);
+}
+
+// decode the next frame's data into the state
+static esp_err_t s_anim_decode(leddisplay_anim_t *p_anim)
+{
+    if (p_anim->frame >= p_anim->num_frames)
+    {
+        return ESP_ERR_NOT_FOUND;
+    }
+    const int64_t size = s_anim_uint(p_anim, 4);
+    if (size < 0)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const bool key_frame = (size & LEDDISPLAY_ANIM_KEY_FRAME) != 0;
+    if (key_frame)
+    {
+        memset(p_anim->state, 0, ANIM_NUM_VALUES);
+    }
+    else if (p_anim->frame == 0)
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // apply the tokens, count the bytes
+    uint8_t *p_state = p_anim->state;
+    uint32_t ix = 0;
+    uint32_t num_bytes = 0;
+    while (ix < ANIM_NUM_VALUES)
+    {
+        const int token = s_anim_byte(p_anim);
+        uint32_t n = 0;
+        int val = 0;
+        if (token < 0)
+        {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        else if (token < 0x40) // one value
+        {
+            p_state[ix++] ^= token;
+            num_bytes += 1;
+            continue;
+        }
+        else if (token < 0x80) // short run
+        {
+            n = (token & 0x3f) + 2;
+            val = s_anim_byte(p_anim);
+            num_bytes += 2;
+        }
+        else if (token < 0xc0) // unchanged
+        {
+            n = (token & 0x3f) + 1;
+            num_bytes += 1;
+        }
+        else // long run
+        {
+            const int n_lo = s_anim_byte(p_anim);
+            n = ((((token & 0x3f) << 8) | n_lo) + 1);
+            val = n_lo < 0 ? -1 : s_anim_byte(p_anim);
+            num_bytes += 3;
+        }
+        if ( (val < 0) || ((val & ~LEDDISPLAY_DIRECT_RGB_MASK) != 0) || (n > (ANIM_NUM_VALUES - ix)) )
+        {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        if (val != 0)
+        {
+            for (uint32_t end = ix + n; ix < end; ix++)
+            {
+                p_state[ix] ^= val;
+            }
+        }
+        else
+        {
+            ix += n;
+        }
+    }
+    if (num_bytes != (size & ~LEDDISPLAY_ANIM_KEY_FRAME))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    p_anim->frame++;
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_anim_frame(leddisplay_anim_t *p_anim, int block)
+{
+    const esp_err_t res = s_anim_decode(p_anim);
+    if (res != ESP_OK)
+    {
+        if (res != ESP_ERR_NOT_FOUND)
+        {
+            WARNING("anim: corrupt frame %d", p_anim->frame);
+            p_anim->frame = p_anim->num_frames;
+        }
+        return res;
+    }
+
+    // write the state (colours) and the control bits (latch, output enable) into the frame buffer
+    leddisplay_direct_t direct;
+    leddisplay_direct_get(&direct);
+    frame_t *p_dst = (frame_t *)direct.mem;
+    const uint8_t *p_state = p_anim->state;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        for (int bp = 0; bp < COLOR_DEPTH_BITS; bp++)
+        {
+            row_bit_t *p_rowbits = &p_dst->rowdata[row].rowbits[bp];
+            const uint8_t *p_ctrl = &direct.ctrl[bp * CHAIN_WIDTH];
+            for (int x = 0; x < CHAIN_WIDTH; x++)
+            {
+                BUS_WORD_LO(p_rowbits, BUS_WORD_IX(x)) = p_ctrl[x] | p_state[x];
+            }
+            p_state += CHAIN_WIDTH;
+        }
+    }
+    leddisplay_direct_update(block);
+    return ESP_OK;
+}
+
+esp_err_t leddisplay_anim_rewind(leddisplay_anim_t *p_anim)
+{
+    if (p_anim->read != NULL)
+    {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    p_anim->pos   = LEDDISPLAY_ANIM_HEADER_SIZE;
+    p_anim->frame = 0;
+    return ESP_OK;
+}
+
+void leddisplay_anim_close(leddisplay_anim_t *p_anim)
+{
+    if (p_anim->state != NULL)
+    {
+        free(p_anim->state);
+    }
+    if (p_anim->mmapped)
+    {
+        spi_flash_munmap(p_anim->mmap);
+    }
+    memset(p_anim, 0, sizeof(*p_anim));
+}
+
+/* *********************************************************************************************** */
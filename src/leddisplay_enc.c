@@ -0,0 +1,684 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: frame buffer encoder (see leddisplay_enc.h)
+
+    - Copyright 2017 Espressif Systems (Shanghai) PTE LTD
+    - Copyright 2018 Louis Beaudoin (Pixelmatix)
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/* *********************************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <sdkconfig.h>
+
+#include "val2pwm.h"
+#include "leddisplay_enc.h"
+
+/* *********************************************************************************************** */
+
+// colour value (0..255) to PWM value (0..2^COLOR_DEPTH_BITS-1)
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+#  define _VAL2PWM(v) val2pwm(v)
+#else
+#  define _VAL2PWM(v) ((v) >> (8 - COLOR_DEPTH_BITS))
+#endif
+
+/* *********************************************************************************************** */
+// chained panels: display (canvas) coordinates vs. chain coordinates (see CHAIN_WIDTH)
+
+// the index of a panel in the chain (0 = the one connected to the controller) for the position of
+// the panel on the display (column 0 = left, row 0 = top), and if that panel is upside down
+static inline int s_chain_panel(const int panel_col, const int panel_row, bool *p_flipped)
+{
+#if CONFIG_LEDDISPLAY_CHAIN_SERPENTINE
+    if ((panel_row % 2) != 0)
+    {
+        *p_flipped = true;
+        return (panel_row * LEDDISPLAY_CHAIN_COLS) + panel_col;
+    }
+#endif
+    *p_flipped = false;
+    return (panel_row * LEDDISPLAY_CHAIN_COLS) + (LEDDISPLAY_CHAIN_COLS - 1 - panel_col);
+}
+
+// display coordinates to chain coordinates
+static inline void s_display_to_chain(const uint16_t x_coord, const uint16_t y_coord,
+    uint16_t *p_chain_x, uint16_t *p_chain_y)
+{
+    bool flipped;
+    const int panel = s_chain_panel(x_coord / LEDDISPLAY_PANEL_WIDTH, y_coord / LEDDISPLAY_PANEL_HEIGHT, &flipped);
+    uint16_t panel_x = x_coord % LEDDISPLAY_PANEL_WIDTH;
+    uint16_t panel_y = y_coord % LEDDISPLAY_PANEL_HEIGHT;
+    if (flipped)
+    {
+        panel_x = LEDDISPLAY_PANEL_WIDTH - 1 - panel_x;
+        panel_y = LEDDISPLAY_PANEL_HEIGHT - 1 - panel_y;
+    }
+    *p_chain_x = ((LEDDISPLAY_CHAIN_LENGTH - 1 - panel) * LEDDISPLAY_PANEL_WIDTH) + panel_x;
+    *p_chain_y = panel_y;
+}
+
+uint32_t leddisplay_enc_row_mask(uint16_t y_coord)
+{
+    uint16_t chain_x, chain_y;
+    s_display_to_chain(0, y_coord, &chain_x, &chain_y);
+    return ROW_MASK(chain_y % ROWS_PER_FRAME);
+}
+
+/* *********************************************************************************************** */
+
+void leddisplay_enc_ctrl_bits(ctrl_bits_t *p_ctrl, const int brightness_val, const int lsb_msb_transition_bit)
+{
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+    // (the brightness is the width of the MCPWM pulse, and there are no LSB bitplanes)
+    (void)brightness_val;
+    (void)lsb_msb_transition_bit;
+#endif
+    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++)
+    {
+        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+        {
+            int v = 0;
+
+#if !CONFIG_LEDDISPLAY_BUS_8BIT
+            // if there is no latch to hold address, output ADDX lines directly to GPIO and latch data at end of cycle
+            // normally output current rows ADDX, special case for LSB, output previous row's ADDX (as previous row is being displayed for one latch cycle)
+            int gpioRowAddress = (bitplane_ix == 0) ? y_coord - 1 : y_coord;
+
+            if (gpioRowAddress & BIT(0)) { v |= BIT_A; } // 1
+            if (gpioRowAddress & BIT(1)) { v |= BIT_B; } // 2
+            if (gpioRowAddress & BIT(2)) { v |= BIT_C; } // 4
+            if (gpioRowAddress & BIT(3)) { v |= BIT_D; } // 8
+#if LEDDISPLAY_NEED_E_GPIO
+            if (gpioRowAddress & BIT(4)) { v |= BIT_E; } // 16
+#endif
+#endif
+            p_ctrl->addr[y_coord][bitplane_ix] = v;
+        }
+    }
+
+    for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+    {
+        for (int x_coord = 0; x_coord < CHAIN_WIDTH; x_coord++)
+        {
+            int v = 0;
+
+#if CONFIG_LEDDISPLAY_OE_MCPWM
+            // the output enable is a pulse after each latch generated by the MCPWM (see
+            // leddisplay.c), so that all words of a bitplane are the same (except for the latch)
+            if (x_coord == (PIXELS_PER_LATCH - 1)) { v |= BIT_LAT; }
+#else
+            // need to disable OE after latch to hide row transition
+            if (x_coord == 0) { v |= BIT_OE; }
+
+            // drive latch while shifting out last bit of RGB data
+            // need to turn off OE one clock before latch, otherwise can get ghosting
+            if (x_coord == (PIXELS_PER_LATCH - 1)) { v |= (BIT_LAT | BIT_OE); }
+
+            // turn off OE after brightness value is reached when displaying MSBs
+            // MSBs always output normal brightness
+            // LSB (!bitplane_ix) outputs normal brightness as MSB from previous row is being displayed
+            if ( ((bitplane_ix > lsb_msb_transition_bit) || !bitplane_ix) && (x_coord >= brightness_val) )
+            {
+                v |= BIT_OE; // For Brightness
+            }
+
+            // special case for the bits *after* LSB through (lsb_msb_transition_bit) - OE is output after data is shifted, so need to set OE to fractional brightness
+            if (bitplane_ix && (bitplane_ix <= lsb_msb_transition_bit))
+            {
+                // divide brightness in half for each bit below lsb_msb_transition_bit
+                int lsbBrightness = brightness_val >> (lsb_msb_transition_bit - bitplane_ix + 1);
+                if (x_coord >= lsbBrightness) { v |= BIT_OE; } // For Brightness
+            }
+#endif
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+            // the previous row's last bitplane is displayed in the row gap, the LSB only latches
+            if (!bitplane_ix)
+            {
+                p_ctrl->gap_oe[x_coord] = v & ~BIT_LAT;
+                v = BIT_OE | (v & BIT_LAT);
+            }
+#endif
+            p_ctrl->oe[bitplane_ix][x_coord] = v;
+        }
+    }
+}
+
+/* *********************************************************************************************** */
+
+void leddisplay_enc_pixel_xy(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue)
+{
+    // Where in the chain (of panels) is this pixel?
+    s_display_to_chain(x_coord, y_coord, &x_coord, &y_coord);
+
+    // What half of the HUB75 panel are we painting to?
+    bool paint_top_half = true;
+    if ( y_coord > (ROWS_PER_FRAME - 1) ) // co-ords start at zero, y_coord = 15 = 16 (rows per frame)
+    {
+        y_coord -= ROWS_PER_FRAME; // if it's 16, subtract 16. Array position 0 again.
+        paint_top_half = false;
+    }
+
+    red   = _VAL2PWM(red);
+    green = _VAL2PWM(green);
+    blue  = _VAL2PWM(blue);
+
+    row_data_t *row_data = &p_dst->rowdata[y_coord];
+
+    for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
+    {
+        // the destination for the pixel bitstream
+        row_bit_t *rowbits = &row_data->rowbits[bitplane_ix]; //matrixUpdateFrames location to write to uint16_t's
+
+        // the control signals for this pixel (the row address has been set by leddisplay_enc_fill())
+        int v = p_ctrl->oe[bitplane_ix][x_coord];
+
+        // When using the Adafruit drawPixel, we only have one pixel co-ordinate and colour to draw
+        // (duh) so we can't paint a top and bottom half (or whatever row split the panel is) at the
+        // same time.  Need to be smart and check the DMA buffer to see what the other half thinks
+        // (pun intended) and persist this when we refresh.
+        // The DMA buffer order has also been reversed (refer to the last code in this function) so
+        // we have to check for this and check the correct position of the uint16_t data.
+        const int tmp_x_coord = BUS_WORD_IX(x_coord);
+        const uint8_t other = BUS_WORD_LO(rowbits, tmp_x_coord);
+
+        uint8_t mask = BIT(bitplane_ix); // 8 bit color
+
+        // need to copy what the RGB status is for the bottom pixels
+        if (paint_top_half)
+        {
+
+           // Set the color of the pixel of interest
+           if (green & mask) { v |= BIT_G1; }
+           if (blue  & mask) { v |= BIT_B1; }
+           if (red   & mask) { v |= BIT_R1; }
+
+           // Persist what was painted to the other half of the frame equiv. pixel
+           if (other & BIT_R2) { v |= BIT_R2; }
+           if (other & BIT_G2) { v |= BIT_G2; }
+           if (other & BIT_B2) { v |= BIT_B2; }
+        }
+        // do it the other way around
+        else
+        {
+            // color to set
+            if (red   & mask) { v |= BIT_R2; }
+            if (green & mask) { v |= BIT_G2; }
+            if (blue  & mask) { v |= BIT_B2; }
+
+            // copy
+            if (other & BIT_R1) { v |= BIT_R1; }
+            if (other & BIT_G1) { v |= BIT_G1; }
+            if (other & BIT_B1) { v |= BIT_B1; }
+
+        } // paint
+
+
+        // save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
+        BUS_WORD_LO(rowbits, tmp_x_coord) = v;
+
+    } // color depth loop (8)
+}
+
+
+void leddisplay_enc_fill(frame_t *p_dst, const ctrl_bits_t *p_ctrl, uint8_t red, uint8_t green, uint8_t blue)
+{
+#if 0
+    for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
+    {
+        for (uint16_t x = 0; x < LEDDISPLAY_WIDTH; x++)
+        {
+            leddisplay_enc_pixel_xy(p_dst, p_ctrl, x, y, red, green, blue);
+        }
+    }
+#else
+    red   = _VAL2PWM(red);
+    green = _VAL2PWM(green);
+    blue  = _VAL2PWM(blue);
+    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++) // half height - 16 iterations
+    {
+        row_data_t *row_data = &p_dst->rowdata[y_coord];
+
+        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
+        {
+            uint16_t mask = (1 << bitplane_ix); // 24 bit color
+
+            // the destination for the pixel bitstream
+            row_bit_t *rowbits = &row_data->rowbits[bitplane_ix]; //matrixUpdateFrames location to write to uint16_t's
+
+            // the control signals for this row and bitplane
+            const uint16_t ctrl_addr = p_ctrl->addr[y_coord][bitplane_ix];
+            const uint8_t *ctrl_oe = p_ctrl->oe[bitplane_ix];
+
+            for (int x_coord = 0; x_coord < CHAIN_WIDTH; x_coord++) // row pixel width 64 iterations
+            {
+                int v = ctrl_addr | ctrl_oe[x_coord]; // the output bitstream
+
+                // top and bottom half colours
+                if (red    & mask) { v |= (BIT_R1 | BIT_R2); }
+                if (green  & mask) { v |= (BIT_G1 | BIT_G2); }
+                if (blue   & mask) { v |= (BIT_B1 | BIT_B2); }
+
+                // Save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
+                rowbits->pixel[BUS_WORD_IX(x_coord)] = v;
+
+            } // end x_coord iteration
+        } // colour depth loop (8)
+    } // end row iteration
+#endif
+}
+
+void leddisplay_enc_ctrl_update(frame_t *p_dst, const ctrl_bits_t *p_ctrl)
+{
+    for (int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++)
+    {
+        row_data_t *row_data = &p_dst->rowdata[y_coord];
+        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+        {
+            row_bit_t *rowbits = &row_data->rowbits[bitplane_ix];
+            const uint8_t *ctrl_oe = p_ctrl->oe[bitplane_ix];
+            for (int x_coord = 0; x_coord < CHAIN_WIDTH; x_coord++)
+            {
+                uint8_t *p_lo = &BUS_WORD_LO(rowbits, BUS_WORD_IX(x_coord));
+                *p_lo = (*p_lo & ~(BIT_LAT | BIT_OE)) | ctrl_oe[x_coord];
+            }
+        }
+    }
+}
+
+/* *********************************************************************************************** */
+
+// Transposes the 8x8 bit matrix formed by the six colour channel values (and two zero values) of
+// a pixel pair (top and bottom half) to one byte per bitplane, with the RGB bits at their bus
+// position (see BIT_R1 etc.). This is the "transpose8rS32" method from Hacker's Delight (7-3),
+// which only needs 32-bit shifts and masks. Bitplanes 0..3 are returned in the bytes of
+// *p_planes_lo, bitplanes 4..7 in *p_planes_hi (LSB first).
+static inline void s_rgb_to_bitplanes(const uint8_t r1, const uint8_t g1, const uint8_t b1,
+    const uint8_t r2, const uint8_t g2, const uint8_t b2, uint32_t *p_planes_lo, uint32_t *p_planes_hi)
+{
+    // rows of the matrix (most significant first): 0, 0, B2, G2, R2, B1, G1, R1
+    uint32_t x = ((uint32_t)b2 << 8) | (uint32_t)g2;
+    uint32_t y = ((uint32_t)r2 << 24) | ((uint32_t)b1 << 16) | ((uint32_t)g1 << 8) | (uint32_t)r1;
+    uint32_t t;
+
+    t = (x ^ (x >>  7)) & 0x00aa00aa; x = x ^ t ^ (t <<  7);
+    t = (y ^ (y >>  7)) & 0x00aa00aa; y = y ^ t ^ (t <<  7);
+    t = (x ^ (x >> 14)) & 0x0000cccc; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000cccc; y = y ^ t ^ (t << 14);
+    t = (x & 0xf0f0f0f0) | ((y >> 4) & 0x0f0f0f0f);
+    y = ((x << 4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+
+    *p_planes_lo = y;
+    *p_planes_hi = t;
+}
+
+// write the RGB bits of all bitplanes (see s_rgb_to_bitplanes()) and the control signals of a
+// pixel pair (chain x) to the frame buffer row
+static inline void s_write_bitplanes(row_data_t *row_data, const ctrl_bits_t *p_ctrl, const int x_coord,
+    const uint32_t planes_lo, const uint32_t planes_hi)
+{
+    // Save the calculated value to the bitplane memory in reverse order to account for I2S Tx FIFO mode1 ordering
+    const int pixel_ix = BUS_WORD_IX(x_coord);
+
+    for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)  // color depth - 8 iterations
+    {
+        const uint32_t rgb_bits = bitplane_ix < 4 ?
+            (planes_lo >> (8 * bitplane_ix)) : (planes_hi >> (8 * (bitplane_ix - 4)));
+        BUS_WORD_LO(&row_data->rowbits[bitplane_ix], pixel_ix) = p_ctrl->oe[bitplane_ix][x_coord] | (rgb_bits & 0xff);
+    }
+}
+
+#if DITHER_FRAMES > 1
+// the sub-frames in which the dithered values are one higher: a value with remainder r (0..
+// DITHER_FRAMES-1) is one higher in the sub-frames whose order is < r, the order of the sub-frames
+// depends on the pixel (phase), so that neighbouring pixels (2x2 pixels with 4 sub-frames, or
+// checkerboard with 2) don't change at the same time, and are spread evenly (0, 2, 1, 3)
+static const uint8_t s_dither_order[DITHER_FRAMES] =
+#  if DITHER_FRAMES == 4
+    { 0, 2, 1, 3 };
+#  else
+    { 0, 1 };
+#  endif
+
+static inline int s_dither_phase(const int x_coord, const int y_coord)
+{
+#  if DITHER_FRAMES == 4
+    return (x_coord & 1) | ((y_coord & 1) << 1);
+#  else
+    return (x_coord + y_coord) & 1;
+#  endif
+}
+#endif
+
+void leddisplay_enc_frame_rows(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    const leddisplay_frame_t *p_frame, const uint32_t rows, uint32_t *p_load)
+{
+#if 0
+    for (uint16_t x = 0; x < LEDDISPLAY_WIDTH; x++)
+    {
+        for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
+        {
+            const uint8_t *p_rgb = p_frame->yx[y][x];
+            leddisplay_enc_pixel_xy(p_dst, p_ctrl, x, y, p_rgb[0], p_rgb[1], p_rgb[2]);
+        }
+    }
+#else
+    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++) // half height - 16 iterations
+    {
+        if ((rows & ROW_MASK(y_coord)) == 0)
+        {
+            continue;
+        }
+
+#if DITHER_FRAMES == 1
+        row_data_t *row_data = &p_dst->rowdata[y_coord];
+#endif
+        uint32_t load = 0;
+
+        for (int panel_ix = 0; panel_ix < LEDDISPLAY_CHAIN_LENGTH; panel_ix++)
+        {
+            // the part of the display (a row of pixels of a panel, top and bottom half) for this part
+            // of the chain, right to left for panels that are upside down
+            const int panel_col = panel_ix % LEDDISPLAY_CHAIN_COLS;
+            const int panel_row = panel_ix / LEDDISPLAY_CHAIN_COLS;
+            bool flipped;
+            const int chain_x0 = (LEDDISPLAY_CHAIN_LENGTH - 1 - s_chain_panel(panel_col, panel_row, &flipped)) * LEDDISPLAY_PANEL_WIDTH;
+            const int display_x0 = panel_col * LEDDISPLAY_PANEL_WIDTH;
+            const int display_y0 = panel_row * LEDDISPLAY_PANEL_HEIGHT;
+            const uint8_t *p_rgb_top;
+            const uint8_t *p_rgb_bot;
+            int rgb_step;
+            if (!flipped)
+            {
+                p_rgb_top = p_frame->yx[display_y0 + y_coord][display_x0];
+                p_rgb_bot = p_frame->yx[display_y0 + y_coord + ROWS_PER_FRAME][display_x0];
+                rgb_step = 3;
+            }
+            else
+            {
+                p_rgb_top = p_frame->yx[display_y0 + LEDDISPLAY_PANEL_HEIGHT - 1 - y_coord][display_x0 + LEDDISPLAY_PANEL_WIDTH - 1];
+                p_rgb_bot = p_frame->yx[display_y0 + LEDDISPLAY_PANEL_HEIGHT - 1 - y_coord - ROWS_PER_FRAME][display_x0 + LEDDISPLAY_PANEL_WIDTH - 1];
+                rgb_step = -3;
+            }
+
+            for (int x_coord = chain_x0; x_coord < (chain_x0 + LEDDISPLAY_PANEL_WIDTH); x_coord++) // row pixel width 64 iterations
+            {
+#if DITHER_FRAMES > 1
+                // brightness corrected top and bottom half colours (sum over all sub-frames),
+                // split into the value for all sub-frames and the remainder, which adds one in as
+                // many sub-frames
+                const uint16_t sum[6] =
+                {
+                    val2pwm_dither(p_rgb_top[0]), val2pwm_dither(p_rgb_top[1]), val2pwm_dither(p_rgb_top[2]),
+                    val2pwm_dither(p_rgb_bot[0]), val2pwm_dither(p_rgb_bot[1]), val2pwm_dither(p_rgb_bot[2]),
+                };
+                uint8_t pwm[6], rem[6];
+                for (int ix = 0; ix < 6; ix++)
+                {
+                    pwm[ix] = sum[ix] / DITHER_FRAMES;
+                    rem[ix] = sum[ix] % DITHER_FRAMES;
+                }
+                load += sum[0] + sum[1] + sum[2] + sum[3] + sum[4] + sum[5];
+                p_rgb_top += rgb_step;
+                p_rgb_bot += rgb_step;
+
+                const int phase = s_dither_phase(x_coord, y_coord);
+                for (int sub = 0; sub < DITHER_FRAMES; sub++)
+                {
+                    const uint8_t order = s_dither_order[(phase + sub) % DITHER_FRAMES];
+                    uint32_t planes_lo, planes_hi;
+                    s_rgb_to_bitplanes(
+                        pwm[0] + (rem[0] > order ? 1 : 0), pwm[1] + (rem[1] > order ? 1 : 0), pwm[2] + (rem[2] > order ? 1 : 0),
+                        pwm[3] + (rem[3] > order ? 1 : 0), pwm[4] + (rem[4] > order ? 1 : 0), pwm[5] + (rem[5] > order ? 1 : 0),
+                        &planes_lo, &planes_hi);
+                    s_write_bitplanes(&p_dst[sub].rowdata[y_coord], p_ctrl, x_coord, planes_lo, planes_hi);
+                }
+#else
+                // brightness corrected top and bottom half colours
+                const uint8_t r1 = _VAL2PWM(p_rgb_top[0]);
+                const uint8_t g1 = _VAL2PWM(p_rgb_top[1]);
+                const uint8_t b1 = _VAL2PWM(p_rgb_top[2]);
+                const uint8_t r2 = _VAL2PWM(p_rgb_bot[0]);
+                const uint8_t g2 = _VAL2PWM(p_rgb_bot[1]);
+                const uint8_t b2 = _VAL2PWM(p_rgb_bot[2]);
+                p_rgb_top += rgb_step;
+                p_rgb_bot += rgb_step;
+                load += r1 + g1 + b1 + r2 + g2 + b2;
+
+                // RGB bits for all bitplanes
+                uint32_t planes_lo, planes_hi;
+                s_rgb_to_bitplanes(r1, g1, b1, r2, g2, b2, &planes_lo, &planes_hi);
+
+                s_write_bitplanes(row_data, p_ctrl, x_coord, planes_lo, planes_hi);
+#endif
+            } // end x_coord iteration
+        } // end panel iteration
+
+        if (p_load != NULL)
+        {
+            p_load[y_coord] = load;
+        }
+    } // end row iteration
+#endif
+}
+
+void leddisplay_enc_load_rows(const frame_t *p_src, const uint32_t rows, uint32_t *p_load)
+{
+    // number of lit LEDs for each combination of the colour bits (BIT_R1..BIT_B2)
+    static const uint8_t s_num_lit[64] =
+    {
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+        1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    };
+    const uint8_t rgb_mask = BIT_R1 | BIT_G1 | BIT_B1 | BIT_R2 | BIT_G2 | BIT_B2;
+
+    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++)
+    {
+        if ((rows & ROW_MASK(y_coord)) == 0)
+        {
+            continue;
+        }
+
+        // each bitplane adds its weight for each LED lit in it (the order of the words doesn't matter)
+        uint32_t load = 0;
+        for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+        {
+            const row_bit_t *rowbits = &p_src->rowdata[y_coord].rowbits[bitplane_ix];
+            uint32_t num_lit = 0;
+            for (int pixel_ix = 0; pixel_ix < CHAIN_WIDTH; pixel_ix++)
+            {
+                num_lit += s_num_lit[BUS_WORD_LO(rowbits, pixel_ix) & rgb_mask];
+            }
+            load += num_lit << bitplane_ix;
+        }
+        p_load[y_coord] += load;
+    }
+}
+
+void leddisplay_enc_palette(palette_bits_t *p_pal, const int colour, uint8_t red, uint8_t green, uint8_t blue)
+{
+    s_rgb_to_bitplanes(_VAL2PWM(red), _VAL2PWM(green), _VAL2PWM(blue), 0, 0, 0,
+        &p_pal->planes[colour][0], &p_pal->planes[colour][1]);
+}
+
+// palette index of a pixel of an indexed colour frame
+static inline int s_frame_ix(const uint8_t *p_frame, const int bits, const int x_coord, const int y_coord)
+{
+    const int ix = (y_coord * LEDDISPLAY_WIDTH) + x_coord;
+    return bits == 8 ? p_frame[ix] : ((p_frame[ix / 2] >> ((ix % 2) * 4)) & 0x0f);
+}
+
+void leddisplay_enc_frame_ix_rows(frame_t *p_dst, const ctrl_bits_t *p_ctrl, const palette_bits_t *p_pal,
+    const uint8_t *p_frame, const int bits, const uint32_t rows)
+{
+    for (unsigned int y_coord = 0; y_coord < ROWS_PER_FRAME; y_coord++)
+    {
+        if ((rows & ROW_MASK(y_coord)) == 0)
+        {
+            continue;
+        }
+
+        row_data_t *row_data = &p_dst->rowdata[y_coord];
+
+        for (int panel_ix = 0; panel_ix < LEDDISPLAY_CHAIN_LENGTH; panel_ix++)
+        {
+            // the part of the display for this part of the chain (see leddisplay_enc_frame_rows())
+            const int panel_col = panel_ix % LEDDISPLAY_CHAIN_COLS;
+            const int panel_row = panel_ix / LEDDISPLAY_CHAIN_COLS;
+            bool flipped;
+            const int chain_x0 = (LEDDISPLAY_CHAIN_LENGTH - 1 - s_chain_panel(panel_col, panel_row, &flipped)) * LEDDISPLAY_PANEL_WIDTH;
+            const int display_x0 = panel_col * LEDDISPLAY_PANEL_WIDTH;
+            const int display_y0 = panel_row * LEDDISPLAY_PANEL_HEIGHT;
+            int display_x, display_y_top, display_y_bot, x_step;
+            if (!flipped)
+            {
+                display_x = display_x0;
+                display_y_top = display_y0 + y_coord;
+                display_y_bot = display_y0 + y_coord + ROWS_PER_FRAME;
+                x_step = 1;
+            }
+            else
+            {
+                display_x = display_x0 + LEDDISPLAY_PANEL_WIDTH - 1;
+                display_y_top = display_y0 + LEDDISPLAY_PANEL_HEIGHT - 1 - y_coord;
+                display_y_bot = display_y0 + LEDDISPLAY_PANEL_HEIGHT - 1 - y_coord - ROWS_PER_FRAME;
+                x_step = -1;
+            }
+
+            for (int x_coord = chain_x0; x_coord < (chain_x0 + LEDDISPLAY_PANEL_WIDTH); x_coord++)
+            {
+                // RGB bits for all bitplanes of the top and bottom half colours
+                const uint32_t *p_top = p_pal->planes[s_frame_ix(p_frame, bits, display_x, display_y_top)];
+                const uint32_t *p_bot = p_pal->planes[s_frame_ix(p_frame, bits, display_x, display_y_bot)];
+                const uint32_t planes_lo = p_top[0] | (p_bot[0] << 3);
+                const uint32_t planes_hi = p_top[1] | (p_bot[1] << 3);
+                display_x += x_step;
+
+                const int pixel_ix = BUS_WORD_IX(x_coord);
+                for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+                {
+                    const uint32_t rgb_bits = bitplane_ix < 4 ?
+                        (planes_lo >> (8 * bitplane_ix)) : (planes_hi >> (8 * (bitplane_ix - 4)));
+                    BUS_WORD_LO(&row_data->rowbits[bitplane_ix], pixel_ix) = p_ctrl->oe[bitplane_ix][x_coord] | (rgb_bits & 0xff);
+                }
+            }
+        }
+    }
+}
+
+// set a span of pixels from RGB triplets (see leddisplay_enc_pixel_span()), or from RGB565 values
+// if p_rgb565 is not NULL
+static inline void s_pixel_span(frame_t *p_dst, const ctrl_bits_t *p_ctrl, uint16_t x_coord, const uint16_t y_coord,
+    uint16_t width, const uint8_t *p_rgb, const int rgb_step, const uint16_t *p_rgb565)
+{
+    while (width > 0)
+    {
+        uint32_t planes_lo = 0, planes_hi = 0;
+        bool planes_valid = false;
+
+        // the part of the span on this panel, right to left in the chain if the panel is upside down
+        bool flipped;
+        s_chain_panel(x_coord / LEDDISPLAY_PANEL_WIDTH, y_coord / LEDDISPLAY_PANEL_HEIGHT, &flipped);
+        const uint16_t panel_width = LEDDISPLAY_PANEL_WIDTH - (x_coord % LEDDISPLAY_PANEL_WIDTH);
+        const uint16_t num = width < panel_width ? width : panel_width;
+        const int chain_step = flipped ? -1 : 1;
+        uint16_t chain_x, chain_y;
+        s_display_to_chain(x_coord, y_coord, &chain_x, &chain_y);
+
+        // the half of the panel and the colour bits of the other half (which must be kept)
+        const bool top_half = chain_y < ROWS_PER_FRAME;
+        row_data_t *row_data = &p_dst->rowdata[top_half ? chain_y : chain_y - ROWS_PER_FRAME];
+        const uint8_t keep = top_half ? (BIT_R2 | BIT_G2 | BIT_B2) : (BIT_R1 | BIT_G1 | BIT_B1);
+
+        for (uint16_t n = 0; n < num; n++)
+        {
+            // RGB bits for all bitplanes (only once for spans of one colour)
+            if (!planes_valid)
+            {
+                uint8_t red, green, blue;
+                if (p_rgb565 != NULL)
+                {
+                    // expand to 8 bits per colour (replicating the high bits into the low ones)
+                    const uint16_t rgb565 = *p_rgb565++;
+                    const uint8_t red5   = (rgb565 >> 11) & 0x1f;
+                    const uint8_t green6 = (rgb565 >>  5) & 0x3f;
+                    const uint8_t blue5  =  rgb565        & 0x1f;
+                    red   = _VAL2PWM((red5   << 3) | (red5   >> 2));
+                    green = _VAL2PWM((green6 << 2) | (green6 >> 4));
+                    blue  = _VAL2PWM((blue5  << 3) | (blue5  >> 2));
+                }
+                else
+                {
+                    red   = _VAL2PWM(p_rgb[0]);
+                    green = _VAL2PWM(p_rgb[1]);
+                    blue  = _VAL2PWM(p_rgb[2]);
+                    p_rgb += rgb_step;
+                }
+                if (top_half)
+                {
+                    s_rgb_to_bitplanes(red, green, blue, 0, 0, 0, &planes_lo, &planes_hi);
+                }
+                else
+                {
+                    s_rgb_to_bitplanes(0, 0, 0, red, green, blue, &planes_lo, &planes_hi);
+                }
+                planes_valid = (p_rgb565 == NULL) && (rgb_step == 0);
+            }
+
+            const int pixel_ix = BUS_WORD_IX(chain_x);
+            for (int bitplane_ix = 0; bitplane_ix < COLOR_DEPTH_BITS; bitplane_ix++)
+            {
+                const uint32_t rgb_bits = bitplane_ix < 4 ?
+                    (planes_lo >> (8 * bitplane_ix)) : (planes_hi >> (8 * (bitplane_ix - 4)));
+                uint8_t *p_lo = &BUS_WORD_LO(&row_data->rowbits[bitplane_ix], pixel_ix);
+                *p_lo = p_ctrl->oe[bitplane_ix][chain_x] | (*p_lo & keep) | (rgb_bits & 0xff);
+            }
+            chain_x += chain_step;
+        }
+
+        x_coord += num;
+        width -= num;
+    }
+}
+
+void leddisplay_enc_pixel_span(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, const uint16_t y_coord, uint16_t width, const uint8_t *p_rgb, const int rgb_step)
+{
+    s_pixel_span(p_dst, p_ctrl, x_coord, y_coord, width, p_rgb, rgb_step, NULL);
+}
+
+void leddisplay_enc_pixel_span_rgb565(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, const uint16_t y_coord, uint16_t width, const uint16_t *p_rgb565)
+{
+    s_pixel_span(p_dst, p_ctrl, x_coord, y_coord, width, NULL, 0, p_rgb565);
+}
+
+/* *********************************************************************************************** */
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+void leddisplay_enc_row_gap(bus_word_t *p_gap, const int num_words, const ctrl_bits_t *p_ctrl)
+{
+    for (int x_coord = 0; x_coord < num_words; x_coord++)
+    {
+        p_gap[BUS_WORD_IX(x_coord)] = x_coord < PIXELS_PER_LATCH ? p_ctrl->gap_oe[x_coord] : BIT_OE;
+    }
+}
+#endif
+
+/* *********************************************************************************************** */
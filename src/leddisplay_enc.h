@@ -0,0 +1,244 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: frame buffer encoder
+
+    - Copyright 2017 Espressif Systems (Shanghai) PTE LTD
+    - Copyright 2018 Louis Beaudoin (Pixelmatix)
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    This converts RGB pixel data into the I2S bus words of the DMA frame buffer memory (bitplanes,
+    see leddisplay.c). It does not depend on any hardware or operating system functionality, only
+    on the configuration (sdkconfig.h) and the leddisplay.h types, so that it can be built and
+    profiled on a host (see examples/leddisplay_host).
+*/
+
+#ifndef __LEDDISPLAY_ENC_H__
+#define __LEDDISPLAY_ENC_H__
+
+#include <stdint.h>
+#include <sdkconfig.h>
+
+#include "leddisplay.h"
+
+/* *********************************************************************************************** */
+// some useful macros
+
+#ifdef BIT
+#  undef BIT
+#endif
+#define BIT(bit) (1<<(bit))
+
+/* *********************************************************************************************** */
+// I2S bus bits (corresponds to the GPIOs)
+
+// display panel upper half
+#define BIT_R1   BIT(0)   // CONFIG_LEDDISPLAY_R1_GPIO
+#define BIT_G1   BIT(1)   // CONFIG_LEDDISPLAY_G1_GPIO
+#define BIT_B1   BIT(2)   // CONFIG_LEDDISPLAY_B1_GPIO
+
+// display panel lower half
+#define BIT_R2   BIT(3)   // CONFIG_LEDDISPLAY_R2_GPIO
+#define BIT_G2   BIT(4)   // CONFIG_LEDDISPLAY_G2_GPIO
+#define BIT_B2   BIT(5)   // CONFIG_LEDDISPLAY_B2_GPIO
+
+// display panel control signals (latch, output enable)
+#define BIT_LAT  BIT(6)   // CONFIG_LEDDISPLAY_LAT_GPIO
+#define BIT_OE   BIT(7)   // CONFIG_LEDDISPLAY_OE_GPIO
+
+// row address (not on the bus with CONFIG_LEDDISPLAY_BUS_8BIT, see leddisplay.c)
+#define BIT_A    BIT(8)   // CONFIG_LEDDISPLAY_A_GPIO
+#define BIT_B    BIT(9)   // CONFIG_LEDDISPLAY_B_GPIO
+#define BIT_C    BIT(10)  // CONFIG_LEDDISPLAY_C_GPIO
+#define BIT_D    BIT(11)  // CONFIG_LEDDISPLAY_D_GPIO
+#define BIT_E    BIT(12)  // CONFIG_LEDDISPLAY_E_GPIO
+
+// CONFIG_LEDDISPLAY_E_CLK
+
+/* *********************************************************************************************** */
+// display configuration (see also leddisplay.h)
+
+#if CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN     // doesn't work
+#  warning CONFIG_LEDDISPLAY_TYPE_32X16_4SCAN does not work
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+
+#elif CONFIG_LEDDISPLAY_TYPE_32X16_8SCAN   // tested, works
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+
+#elif CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN   // doesn't work
+#  warning CONFIG_LEDDISPLAY_TYPE_32X32_8SCAN does not work
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+
+#elif CONFIG_LEDDISPLAY_TYPE_32X32_16SCAN  // tested, works
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+
+#elif CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN   // doesn't work
+#  warning CONFIG_LEDDISPLAY_TYPE_64X32_8SCAN does not work
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      4
+
+#elif CONFIG_LEDDISPLAY_TYPE_64X32_16SCAN  // tested, works
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+
+#elif CONFIG_LEDDISPLAY_TYPE_64X64_32SCAN  // not tested
+#  define LEDDISPLAY_ROWS_IN_PARALLEL      2
+#  define LEDDISPLAY_NEED_E_GPIO 1
+#else
+#  error This CONFIG_LEDDISPLAY_TYPE is not implemented!
+#endif
+
+//#define OE_OFF_CLKS_AFTER_LATCH   1
+#define COLOR_DEPTH_BITS          CONFIG_LEDDISPLAY_COLOR_DEPTH
+// all panels of the chain are shifted out as if they were one long panel (CHAIN_WIDTH x
+// LEDDISPLAY_PANEL_HEIGHT), the first pixel shifted out ends up at the left of the last panel
+#define CHAIN_WIDTH               (LEDDISPLAY_PANEL_WIDTH * LEDDISPLAY_CHAIN_LENGTH)
+#define PIXELS_PER_LATCH          CHAIN_WIDTH
+#define ROWS_PER_FRAME            (LEDDISPLAY_PANEL_HEIGHT / LEDDISPLAY_ROWS_IN_PARALLEL)
+// temporal dithering (see Kconfig), number of sub-frames in each frame buffer (1 = no dithering)
+#if CONFIG_LEDDISPLAY_DITHER_FRAMES > 1
+#  define DITHER_FRAMES           CONFIG_LEDDISPLAY_DITHER_FRAMES
+#  if (DITHER_FRAMES != 2) && (DITHER_FRAMES != 4)
+#    error CONFIG_LEDDISPLAY_DITHER_FRAMES must be 1, 2 or 4!
+#  endif
+#else
+#  define DITHER_FRAMES           1
+#endif
+#define ROW_MASK(row)             ((uint32_t)1 << (row))
+#define ROWS_MASK_ALL             ((uint32_t)(((uint64_t)1 << ROWS_PER_FRAME) - 1))
+// the sum of the PWM values of a fully lit LED in all sub-frames (see leddisplay_enc_frame_rows())
+#define PWM_LOAD_MAX              (((1 << COLOR_DEPTH_BITS) - 1) * DITHER_FRAMES)
+
+// I2S bus word (one per pixel clock), and its index in the DMA memory (the I2S Tx FIFO mode 1
+// outputs the 16 bit words of each 32 bit word in reverse order, and the bytes in 8 bit mode in
+// order 2, 3, 0, 1)
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+typedef uint8_t bus_word_t;
+#  define BUS_WORD_IX(x)          ((x) ^ 2)
+#else
+typedef uint16_t bus_word_t;
+#  define BUS_WORD_IX(x)          ((x) ^ 1)
+#endif
+
+// the low byte (colours, latch and output enable) of a bus word (little endian), the rest of it
+// (the row address) only depends on the row and the bitplane and is set by leddisplay_enc_fill()
+#define BUS_WORD_LO(p_rowbits, ix) (((uint8_t *)(p_rowbits)->pixel)[(ix) * sizeof(bus_word_t)])
+
+/* *********************************************************************************************** */
+
+// RGB data for two rows of pixels (of all panels in the chain), and address and control signals
+typedef struct row_bit_s
+{
+    bus_word_t pixel[CHAIN_WIDTH];
+} row_bit_t;
+// Note: sizeof(data) must be multiple of 32 bits, as DMA linked list buffer address pointer must be word-aligned
+
+// row data for each bitplane
+typedef struct row_data_s
+{
+    row_bit_t rowbits[COLOR_DEPTH_BITS];
+} row_data_t;
+
+// full frame (display)
+typedef struct frame_s
+{
+    row_data_t rowdata[ROWS_PER_FRAME];
+} frame_t;
+
+// control signals templates: the row address (A..E) only depends on the row and bitplane, and the
+// latch and output enable signals (OE after latch, LAT, OE for brightness, fractional OE for the
+// LSBs) only depend on the bitplane and the pixel (x) position, so together they give the control
+// bits for each (row, bitplane, x) data word
+// with the 8 bit bus there is no row address, and the last bitplane of the previous row (which
+// normally is displayed while the LSB is shifted out) is displayed in the row gap (see
+// leddisplay_enc_row_gap()) instead, so that the address can be changed before the LSB
+typedef struct ctrl_bits_s
+{
+    uint16_t addr[ROWS_PER_FRAME][COLOR_DEPTH_BITS];
+    uint8_t  oe[COLOR_DEPTH_BITS][CHAIN_WIDTH];
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+    uint8_t  gap_oe[CHAIN_WIDTH];
+#endif
+} ctrl_bits_t;
+
+// palette for indexed colour frames: the (brightness corrected) RGB bits of all bitplanes of each
+// colour, at the bus positions for the top half (BIT_R1 etc.), bitplanes 0..3 in the bytes of
+// planes[][0], bitplanes 4..7 in planes[][1] (LSB first), for the bottom half they are shifted by 3
+typedef struct palette_bits_s
+{
+    uint32_t planes[256][2];
+} palette_bits_t;
+
+/* *********************************************************************************************** */
+
+// (re-)calculate the control signals templates, needs to be called whenever the brightness value
+// (0..PIXELS_PER_LATCH) or the LSB/MSB transition bit change (with CONFIG_LEDDISPLAY_OE_MCPWM
+// there is no output enable in the templates, and the brightness value is not used)
+void leddisplay_enc_ctrl_bits(ctrl_bits_t *p_ctrl, const int brightness_val, const int lsb_msb_transition_bit);
+
+// the frame buffer rows (bit mask of frame_t.rowdata[] indices) a display (canvas) row is in
+uint32_t leddisplay_enc_row_mask(uint16_t y_coord);
+
+// Note: leddisplay_enc_pixel_xy() and leddisplay_enc_frame_rows() only write the low byte of the
+// bus words (see BUS_WORD_LO()), so the frame buffer memory must have been initialised using
+// leddisplay_enc_fill() once
+
+// set one pixel (the display coordinates must be valid) in the frame buffer memory
+void leddisplay_enc_pixel_xy(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, uint16_t y_coord, uint8_t red, uint8_t green, uint8_t blue);
+
+// set a horizontal span of pixels (the display coordinates must be valid, and x_coord + width
+// <= LEDDISPLAY_WIDTH) in the frame buffer memory, with the colours of consecutive RGB triplets
+// (rgb_step = 3) or all with the same colour (rgb_step = 0)
+void leddisplay_enc_pixel_span(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, const uint16_t y_coord, uint16_t width, const uint8_t *p_rgb, const int rgb_step);
+
+// like leddisplay_enc_pixel_span(), but from consecutive RGB565 values (red in the 5 MSBs)
+void leddisplay_enc_pixel_span_rgb565(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    uint16_t x_coord, const uint16_t y_coord, uint16_t width, const uint16_t *p_rgb565);
+
+// fill the frame buffer memory with a colour (all bits of all bus words)
+void leddisplay_enc_fill(frame_t *p_dst, const ctrl_bits_t *p_ctrl, uint8_t red, uint8_t green, uint8_t blue);
+
+// replace the latch and output enable signals in the frame buffer memory with the (new) ones of
+// the control signals templates, leaving the colours as they are (e.g. to change the brightness
+// without rendering the frame again)
+void leddisplay_enc_ctrl_update(frame_t *p_dst, const ctrl_bits_t *p_ctrl);
+
+// render the given rows (bit mask of frame_t.rowdata[] indices) of the frame into the frame buffer
+// memory, which are DITHER_FRAMES frame_t (sub-frames, all other functions only write one), and
+// store the load of each row rendered in p_load[] (ROWS_PER_FRAME entries, or NULL), which is the
+// sum of the PWM values of all LEDs of the row (PWM_LOAD_MAX for each fully lit LED)
+void leddisplay_enc_frame_rows(frame_t *p_dst, const ctrl_bits_t *p_ctrl,
+    const leddisplay_frame_t *p_frame, const uint32_t rows, uint32_t *p_load);
+
+// add the load (see leddisplay_enc_frame_rows()) of the given rows (bit mask of frame_t.rowdata[]
+// indices) of the frame buffer memory (one sub-frame) to p_load[] (ROWS_PER_FRAME entries), as
+// shown from the colour bits, regardless of how they were written
+void leddisplay_enc_load_rows(const frame_t *p_src, const uint32_t rows, uint32_t *p_load);
+
+// set palette colour
+void leddisplay_enc_palette(palette_bits_t *p_pal, const int colour, uint8_t red, uint8_t green, uint8_t blue);
+
+// render the rows (bit mask of frame_t.rowdata[] indices) of the indexed colour frame (palette
+// indices of the display (canvas) pixels row by row, bits = 8 or 4 per pixel, the left pixel of
+// each pair in the low nibble) into the frame buffer memory
+void leddisplay_enc_frame_ix_rows(frame_t *p_dst, const ctrl_bits_t *p_ctrl, const palette_bits_t *p_pal,
+    const uint8_t *p_frame, const int bits, const uint32_t rows);
+
+#if CONFIG_LEDDISPLAY_BUS_8BIT
+// render the row gap (num_words >= PIXELS_PER_LATCH, a multiple of 4), which is output before
+// each row: the previous row's last bitplane is displayed for one latch period, then the display
+// is dark
+void leddisplay_enc_row_gap(bus_word_t *p_gap, const int num_words, const ctrl_bits_t *p_ctrl);
+#endif
+
+/* *********************************************************************************************** */
+#endif // __LEDDISPLAY_ENC_H__
@@ -0,0 +1,435 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: network frame receiver
+
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    See include/leddisplay_net.h for details.
+*/
+
+/* *********************************************************************************************** */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include <sdkconfig.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#if CONFIG_LEDDISPLAY_NET
+#  include <lwip/sockets.h>
+#endif
+
+#include "leddisplay_enc.h"
+#include "leddisplay_priv.h"
+
+#include "leddisplay.h"
+#include "leddisplay_net.h"
+
+/* *********************************************************************************************** */
+// local logging and debugging
+
+#define LOGNAME "leddisplay"
+#define ERROR(fmt, ...)   ESP_LOGE(LOGNAME, fmt, ## __VA_ARGS__)
+#define WARNING(fmt, ...) ESP_LOGW(LOGNAME, fmt, ## __VA_ARGS__)
+#define INFO(fmt, ...)    ESP_LOGI(LOGNAME, fmt, ## __VA_ARGS__)
+#define DEBUG(fmt, ...)   ESP_LOGD(LOGNAME, fmt, ## __VA_ARGS__)
+
+/* *********************************************************************************************** */
+
+#if CONFIG_LEDDISPLAY_NET
+
+// DDP packet header (see http://www.3waylabs.com/ddp/)
+#define DDP_HEADER_SIZE        10    // flags, sequence, data type, id, offset (4), length (2)
+#define DDP_TIMECODE_SIZE      4     // optional, after the header
+#define DDP_FLAGS_VER_MASK     0xc0
+#define DDP_FLAGS_VER1         0x40
+#define DDP_FLAGS_TIMECODE     0x10
+#define DDP_FLAGS_QUERY        0x02
+#define DDP_FLAGS_PUSH         0x01
+#define DDP_SEQ_MASK           0x0f  // 1..15, 0 = not used
+#define DDP_TYPE_TTT(type)     (((type) >> 3) & 0x07) // 0 = undefined, 1 = RGB
+#define DDP_TYPE_SSS(type)     ((type) & 0x07)        // 0 = undefined, 3 = 8 bits
+#define DDP_TYPE_CUSTOM        0x80
+#define DDP_ID_DEFAULT         1
+#define DDP_ID_ALL             255
+#define DDP_MAX_PACKET_SIZE    1500
+
+#define NET_FRAME_SIZE         (LEDDISPLAY_WIDTH * LEDDISPLAY_HEIGHT * 3)
+#define NET_ROW_SIZE           (LEDDISPLAY_WIDTH * 3)
+
+// receive timeout, and after how many timeouts the sequence numbers are forgotten (the sender
+// may have been restarted)
+#define NET_RECV_TIMEOUT_MS    200
+#define NET_IDLE_RESET         5
+
+typedef struct net_state_s
+{
+    leddisplay_frame_t frame;                       // received pixels (of the previous frames for the others)
+    uint16_t           row_bytes[LEDDISPLAY_HEIGHT]; // bytes received of each display row (current frame)
+    uint8_t            rows_num[ROWS_PER_FRAME];    // number of complete display rows in each frame buffer row (current frame)
+    uint8_t            rows_need[ROWS_PER_FRAME];   // number of display rows in each frame buffer row
+    uint32_t           rows_touched;                // frame buffer rows with received pixels (current frame)
+    uint32_t           rows_rendered;               // frame buffer rows rendered (current frame)
+    int                last_seq;                    // newest sequence number seen (0 = none)
+    int                since_push;                  // sequence numbers since the last push (-1 = none, or too long ago)
+    int                idle;                        // number of receive timeouts
+    uint8_t            packet[DDP_MAX_PACKET_SIZE];
+} net_state_t;
+
+static net_state_t *s_net;
+static int s_net_sock = -1;
+static TaskHandle_t s_net_task;
+static SemaphoreHandle_t s_net_done_sem;
+static volatile bool s_net_stop;
+static leddisplay_net_stats_t s_net_stats;
+static portMUX_TYPE s_net_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#define NET_STATS_INC(field) do { portENTER_CRITICAL(&s_net_mux); s_net_stats.field++; portEXIT_CRITICAL(&s_net_mux); } while (0)
+
+// how far sequence number a is ahead of b (0..14, 0 = same)
+static int s_net_seq_ahead(const int a, const int b)
+{
+    return (a - b + 15) % 15;
+}
+
+// check the sequence number of a packet, returns false if the packet is late (i.e. its frame has
+// already been displayed)
+static bool s_net_seq_check(net_state_t *p_net, const int seq)
+{
+    if (seq == 0)
+    {
+        return true;
+    }
+    if (p_net->last_seq == 0)
+    {
+        p_net->last_seq = seq;
+        return true;
+    }
+
+    // newer packet, possibly after lost ones
+    const int ahead = s_net_seq_ahead(seq, p_net->last_seq);
+    if ( (ahead >= 1) && (ahead <= 7) )
+    {
+        portENTER_CRITICAL(&s_net_mux);
+        s_net_stats.packets_lost += ahead - 1;
+        portEXIT_CRITICAL(&s_net_mux);
+        p_net->last_seq = seq;
+        if (p_net->since_push >= 0)
+        {
+            p_net->since_push += ahead;
+            if (p_net->since_push > 7)
+            {
+                p_net->since_push = -1; // older packets can't be told apart from newer ones anymore
+            }
+        }
+        return true;
+    }
+
+    // older packet, late if the push of its frame has been received already
+    const int behind = s_net_seq_ahead(p_net->last_seq, seq);
+    if ( (p_net->since_push >= 0) && (behind >= p_net->since_push) )
+    {
+        NET_STATS_INC(packets_late);
+        return false;
+    }
+    portENTER_CRITICAL(&s_net_mux);
+    s_net_stats.packets_reordered++;
+    if (s_net_stats.packets_lost > 0)
+    {
+        s_net_stats.packets_lost--; // counted as lost before
+    }
+    portEXIT_CRITICAL(&s_net_mux);
+    return true;
+}
+
+// store the pixels of a packet, and render the frame buffer rows that are complete
+static void s_net_pixels(net_state_t *p_net, const uint8_t *p_data, const uint32_t offset, const uint32_t end)
+{
+    memcpy(&((uint8_t *)&p_net->frame)[offset], p_data, end - offset);
+
+    uint32_t complete = 0;
+    for (uint32_t y = offset / NET_ROW_SIZE; (y < LEDDISPLAY_HEIGHT) && ((y * NET_ROW_SIZE) < end); y++)
+    {
+        const uint32_t row_start = y * NET_ROW_SIZE;
+        const uint32_t row_end   = row_start + NET_ROW_SIZE;
+        const uint32_t num = (end < row_end ? end : row_end) - (offset > row_start ? offset : row_start);
+        const uint32_t mask = leddisplay_enc_row_mask(y);
+        p_net->rows_touched |= mask;
+        if (p_net->row_bytes[y] < NET_ROW_SIZE)
+        {
+            p_net->row_bytes[y] += num;
+            if (p_net->row_bytes[y] >= NET_ROW_SIZE)
+            {
+                for (int row = 0; row < ROWS_PER_FRAME; row++)
+                {
+                    if ( ((mask & ROW_MASK(row)) != 0) && (++p_net->rows_num[row] == p_net->rows_need[row]) )
+                    {
+                        complete |= ROW_MASK(row);
+                    }
+                }
+            }
+        }
+    }
+
+    complete &= ~p_net->rows_rendered;
+    if (complete != 0)
+    {
+        leddisplay_frame_render_rows(&p_net->frame, complete);
+        p_net->rows_rendered |= complete;
+    }
+}
+
+// render the rest of the frame and display it
+static void s_net_push(net_state_t *p_net)
+{
+    leddisplay_frame_render_rows(&p_net->frame, p_net->rows_touched & ~p_net->rows_rendered);
+    leddisplay_pixel_update(0);
+
+    bool incomplete = false;
+    for (int row = 0; row < ROWS_PER_FRAME; row++)
+    {
+        if (p_net->rows_num[row] < p_net->rows_need[row])
+        {
+            incomplete = true;
+        }
+    }
+    portENTER_CRITICAL(&s_net_mux);
+    s_net_stats.frames++;
+    if (incomplete)
+    {
+        s_net_stats.frames_incomplete++;
+    }
+    portEXIT_CRITICAL(&s_net_mux);
+
+    memset(p_net->row_bytes, 0, sizeof(p_net->row_bytes));
+    memset(p_net->rows_num, 0, sizeof(p_net->rows_num));
+    p_net->rows_touched = 0;
+    p_net->rows_rendered = 0;
+}
+
+static void s_net_packet(net_state_t *p_net, const uint8_t *p_pkt, const int len)
+{
+    if (len < DDP_HEADER_SIZE)
+    {
+        NET_STATS_INC(packets_invalid);
+        return;
+    }
+    const uint8_t  flags  = p_pkt[0];
+    const int      seq    = p_pkt[1] & DDP_SEQ_MASK;
+    const uint8_t  type   = p_pkt[2];
+    const uint8_t  id     = p_pkt[3];
+    const uint32_t offset = ((uint32_t)p_pkt[4] << 24) | ((uint32_t)p_pkt[5] << 16) | ((uint32_t)p_pkt[6] << 8) | p_pkt[7];
+    const uint32_t size   = ((uint32_t)p_pkt[8] << 8) | p_pkt[9];
+    const int      header = DDP_HEADER_SIZE + ((flags & DDP_FLAGS_TIMECODE) != 0 ? DDP_TIMECODE_SIZE : 0);
+    if ( ((flags & DDP_FLAGS_VER_MASK) != DDP_FLAGS_VER1) || ((flags & DDP_FLAGS_QUERY) != 0) ||
+         ((id != DDP_ID_DEFAULT) && (id != DDP_ID_ALL)) || ((type & DDP_TYPE_CUSTOM) != 0) ||
+         (DDP_TYPE_TTT(type) > 1) || ((DDP_TYPE_SSS(type) != 0) && (DDP_TYPE_SSS(type) != 3)) ||
+         (len < (header + (int)size)) || (offset > NET_FRAME_SIZE) )
+    {
+        NET_STATS_INC(packets_invalid);
+        return;
+    }
+    NET_STATS_INC(packets);
+
+    if (!s_net_seq_check(p_net, seq))
+    {
+        return;
+    }
+
+    const uint32_t end = (offset + size) < NET_FRAME_SIZE ? (offset + size) : NET_FRAME_SIZE;
+    if (end > offset)
+    {
+        s_net_pixels(p_net, &p_pkt[header], offset, end);
+    }
+
+    if ((flags & DDP_FLAGS_PUSH) != 0)
+    {
+        if (seq != 0)
+        {
+            p_net->since_push = s_net_seq_ahead(p_net->last_seq, seq);
+        }
+        s_net_push(p_net);
+    }
+}
+
+static void s_net_task_func(void *p_param)
+{
+    net_state_t *p_net = s_net;
+    while (!s_net_stop)
+    {
+        const int len = recv(s_net_sock, p_net->packet, sizeof(p_net->packet), 0);
+        if (len > 0)
+        {
+            p_net->idle = 0;
+            s_net_packet(p_net, p_net->packet, len);
+        }
+        else if (p_net->idle < NET_IDLE_RESET)
+        {
+            p_net->idle++;
+            if (p_net->idle == NET_IDLE_RESET)
+            {
+                p_net->last_seq = 0;
+                p_net->since_push = -1;
+            }
+        }
+    }
+    xSemaphoreGive(s_net_done_sem);
+    vTaskDelete(NULL);
+}
+
+static void s_net_cleanup(void)
+{
+    if (s_net_sock >= 0)
+    {
+        close(s_net_sock);
+        s_net_sock = -1;
+    }
+    if (s_net != NULL)
+    {
+        heap_caps_free(s_net);
+        s_net = NULL;
+    }
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+#else
+    if (s_net_done_sem != NULL)
+    {
+        vSemaphoreDelete(s_net_done_sem);
+    }
+#endif
+    s_net_done_sem = NULL;
+}
+
+esp_err_t leddisplay_net_start(void)
+{
+    if (s_net_task != NULL)
+    {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t res = ESP_OK;
+
+    // receiver state
+    s_net = (net_state_t *)heap_caps_malloc(sizeof(*s_net), MALLOC_CAP_8BIT);
+    if (s_net == NULL)
+    {
+        WARNING("net: state alloc");
+        res = ESP_ERR_NO_MEM;
+    }
+    if (res == ESP_OK)
+    {
+        memset(s_net, 0, sizeof(*s_net));
+        s_net->since_push = -1;
+        for (uint16_t y = 0; y < LEDDISPLAY_HEIGHT; y++)
+        {
+            const uint32_t mask = leddisplay_enc_row_mask(y);
+            for (int row = 0; row < ROWS_PER_FRAME; row++)
+            {
+                if ((mask & ROW_MASK(row)) != 0)
+                {
+                    s_net->rows_need[row]++;
+                }
+            }
+        }
+        memset(&s_net_stats, 0, sizeof(s_net_stats));
+    }
+
+    // UDP socket
+    if (res == ESP_OK)
+    {
+        s_net_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        struct sockaddr_in addr =
+        {
+            .sin_family = AF_INET, .sin_port = htons(CONFIG_LEDDISPLAY_NET_PORT), .sin_addr.s_addr = htonl(INADDR_ANY),
+        };
+        const struct timeval timeout = { .tv_sec = 0, .tv_usec = NET_RECV_TIMEOUT_MS * 1000 };
+        if ( (s_net_sock < 0) || (bind(s_net_sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+             (setsockopt(s_net_sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0) )
+        {
+            WARNING("net: socket (port %d, errno %d)", CONFIG_LEDDISPLAY_NET_PORT, errno);
+            res = ESP_FAIL;
+        }
+    }
+
+    // receiver task
+    if (res == ESP_OK)
+    {
+#if CONFIG_SUPPORT_STATIC_ALLOCATION
+        static StaticSemaphore_t sem;
+        s_net_done_sem = xSemaphoreCreateBinaryStatic(&sem);
+#else
+        s_net_done_sem = xSemaphoreCreateBinary();
+#endif
+        s_net_stop = false;
+        if (xTaskCreatePinnedToCore(s_net_task_func, "leddisplay_net", 4096 / sizeof(StackType_t), NULL,
+                CONFIG_LEDDISPLAY_NET_TASK_PRIO, &s_net_task, CONFIG_LEDDISPLAY_NET_TASK_CORE) != pdPASS)
+        {
+            WARNING("net: task");
+            s_net_task = NULL;
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (res == ESP_OK)
+    {
+        INFO("net: receiving DDP on port %d", CONFIG_LEDDISPLAY_NET_PORT);
+    }
+    else
+    {
+        s_net_cleanup();
+    }
+    return res;
+}
+
+void leddisplay_net_stop(void)
+{
+    if (s_net_task != NULL)
+    {
+        // wait until the task is done with the current packet
+        s_net_stop = true;
+        xSemaphoreTake(s_net_done_sem, portMAX_DELAY);
+        s_net_task = NULL;
+    }
+    s_net_cleanup();
+}
+
+void leddisplay_net_get_stats(leddisplay_net_stats_t *p_stats)
+{
+    portENTER_CRITICAL(&s_net_mux);
+    *p_stats = s_net_stats;
+    portEXIT_CRITICAL(&s_net_mux);
+}
+
+#else // CONFIG_LEDDISPLAY_NET
+
+esp_err_t leddisplay_net_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void leddisplay_net_stop(void)
+{
+}
+
+void leddisplay_net_get_stats(leddisplay_net_stats_t *p_stats)
+{
+    memset(p_stats, 0, sizeof(*p_stats));
+}
+
+#endif // CONFIG_LEDDISPLAY_NET
+
+/* *********************************************************************************************** */
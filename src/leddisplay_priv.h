@@ -0,0 +1,40 @@
+/*!
+    \file
+    \brief HUB75 LED display driver: internal functions
+
+    - Copyright 2019 Philippe Kehl (flipflip at oinkzwurgl dot org)
+
+    Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+    in compliance with the License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software distributed under the
+    License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+    express or implied.  See the License for the specific language governing permissions and
+    limitations under the License.
+
+    These are the functions of leddisplay.c that other modules of the driver (but not the
+    application) use.
+*/
+
+#ifndef __LEDDISPLAY_PRIV_H__
+#define __LEDDISPLAY_PRIV_H__
+
+#include <stdint.h>
+
+#include "leddisplay.h"
+
+/* *********************************************************************************************** */
+
+// render the given rows (bit mask of frame_t.rowdata[] indices, see leddisplay_enc_row_mask()) of
+// the frame into the current frame buffer without updating the display (see
+// leddisplay_pixel_update()), blocks until the frame buffer is available, this also renders any
+// other rows that are not up to date in the frame buffer, so the frame must be complete
+void leddisplay_frame_render_rows(const leddisplay_frame_t *p_frame, const uint32_t dirty_rows);
+
+// like leddisplay_frame_render_rows() for the display p_disp
+void leddisplay_disp_frame_render_rows(leddisplay_t *p_disp, const leddisplay_frame_t *p_frame, const uint32_t dirty_rows);
+
+/* *********************************************************************************************** */
+#endif // __LEDDISPLAY_PRIV_H__
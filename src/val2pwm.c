@@ -18,9 +18,11 @@
 
 #include "val2pwm.h"
 
-#if 0
+#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+
 //C/p'ed from https://ledshield.wordpress.com/2012/11/13/led-brightness-to-your-eye-gamma-correction-no/
-const uint16_t lumConvTab[]={
+// (see also https://github.com/TrippyLighting/HPRGB2)
+static const uint16_t lumConvTab[256] = {
     65535,    65508,    65479,    65451,    65422,    65394,    65365,    65337,
     65308,    65280,    65251,    65223,    65195,    65166,    65138,    65109,
     65081,    65052,    65024,    64995,    64967,    64938,    64909,    64878,
@@ -54,57 +56,35 @@ const uint16_t lumConvTab[]={
     9473,    8872,    8266,    7657,    7043,    6424,    5802,    5175,
     4543,    3908,    3267,    2623,    1974,    1320,    662,    0};
 
-
-uint8_t valToPwm(int val) {
-    if (val<0) val=0;
-    if (val>255) val=255;
-    return (65535-lumConvTab[val])>>8;
-}
-#endif
-
-#if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
-
-// from above, see also https://github.com/TrippyLighting/HPRGB2
-static const uint8_t sLumLut[256] =
+uint8_t val2pwm_bits(const uint8_t val, const int bits)
 {
-#  if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT // original curve
-     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
-     1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,
-     3,   3,   4,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,
-     6,   7,   7,   7,   7,   8,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,
-    11,  11,  12,  12,  12,  13,  13,  13,  14,  14,  14,  15,  15,  16,  16,  17,
-    17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  24,  24,
-    25,  25,  26,  27,  27,  28,  28,  29,  30,  30,  31,  31,  32,  33,  33,  34,
-    35,  35,  36,  37,  38,  38,  39,  40,  41,  41,  42,  43,  44,  45,  45,  46,
-    47,  48,  49,  50,  51,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,
-    62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  73,  74,  75,  76,  77,  78,
-    80,  81,  82,  83,  84,  86,  87,  88,  90,  91,  92,  93,  95,  96,  98,  99,
-   100, 102, 103, 105, 106, 107, 109, 110, 112, 113, 115, 116, 118, 120, 121, 123,
-   124, 126, 128, 129, 131, 133, 134, 136, 138, 139, 141, 143, 145, 146, 148, 150,
-   152, 154, 156, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181,
-   183, 185, 187, 189, 192, 194, 196, 198, 200, 203, 205, 207, 209, 212, 214, 216,
-   218, 221, 223, 226, 228, 230, 233, 235, 238, 240, 243, 245, 248, 250, 253, 255,
-#  elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED // scaled to 1..255 (round(x + (255 - x) / 255))
-     0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,
-     2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,
-     4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   6,   7,   7,   7,   7,
-     7,   8,   8,   8,   8,   9,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,
-    12,  12,  13,  13,  13,  14,  14,  14,  15,  15,  15,  16,  16,  17,  17,  18,
-    18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  24,  24,  25,  25,
-    26,  26,  27,  28,  28,  29,  29,  30,  31,  31,  32,  32,  33,  34,  34,  35,
-    36,  36,  37,  38,  39,  39,  40,  41,  42,  42,  43,  44,  45,  46,  46,  47,
-    48,  49,  50,  51,  52,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,
-    63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  74,  75,  76,  77,  78,  79,
-    81,  82,  83,  84,  85,  87,  88,  89,  91,  92,  93,  94,  96,  97,  99, 100,
-   101, 103, 104, 106, 107, 108, 110, 111, 113, 114, 116, 117, 119, 121, 122, 124,
-   125, 127, 128, 129, 131, 133, 134, 136, 138, 139, 141, 143, 145, 146, 148, 150,
-   152, 154, 156, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181,
-   183, 185, 187, 189, 192, 194, 196, 198, 200, 203, 205, 207, 209, 212, 214, 216,
-   218, 221, 223, 226, 228, 230, 233, 235, 238, 240, 243, 245, 248, 250, 253, 255,
+    // original curve, truncated to the requested number of bits
+    const int pwm = (65535 - lumConvTab[val]) >> (16 - bits);
+#  if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT
+    return pwm;
+#  elif CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    // scaled to 1..max (round(x + (max - x) / max))
+    if (val == 0)
+    {
+        return 0;
+    }
+    const int max = (1 << bits) - 1;
+    return pwm + ( (2 * (max - pwm)) >= max ? 1 : 0 );
 #  else
 #    error Hmm...
 #  endif
-};
+}
+
+// look-up table for the configured colour depth, see val2pwm_init()
+static uint8_t sLumLut[256];
+
+void val2pwm_init(void)
+{
+    for (int val = 0; val < (int)sizeof(sLumLut); val++)
+    {
+        sLumLut[val] = val2pwm_bits(val, CONFIG_LEDDISPLAY_COLOR_DEPTH);
+    }
+}
 
 inline uint8_t val2pwm(const uint8_t val)
 {
@@ -112,3 +92,42 @@ inline uint8_t val2pwm(const uint8_t val)
 }
 
 #endif // CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+
+#if CONFIG_LEDDISPLAY_DITHER_FRAMES > 1
+
+uint16_t val2pwm_dither_bits(const uint8_t val, const int bits, const int frames)
+{
+    // the curve (or the linear value) scaled to 0..max (rounded)
+    const uint32_t max = ((1 << bits) - 1) * frames;
+#  if CONFIG_LEDDISPLAY_CORR_BRIGHT_STRICT || CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    const uint32_t pwm = (((65535 - lumConvTab[val]) * max) + 32767) / 65535;
+#  else
+    const uint32_t pwm = ((val * max) + 127) / 255;
+#  endif
+#  if CONFIG_LEDDISPLAY_CORR_BRIGHT_MODIFIED
+    // the lowest values are lit, too (as with val2pwm_bits())
+    if ( (val != 0) && (pwm == 0) )
+    {
+        return 1;
+    }
+#  endif
+    return pwm;
+}
+
+// look-up table for the configured colour depth and number of sub-frames, see val2pwm_dither_init()
+static uint16_t sLumLutDither[256];
+
+void val2pwm_dither_init(void)
+{
+    for (int val = 0; val < (int)(sizeof(sLumLutDither) / sizeof(*sLumLutDither)); val++)
+    {
+        sLumLutDither[val] = val2pwm_dither_bits(val, CONFIG_LEDDISPLAY_COLOR_DEPTH, CONFIG_LEDDISPLAY_DITHER_FRAMES);
+    }
+}
+
+inline uint16_t val2pwm_dither(const uint8_t val)
+{
+    return sLumLutDither[val];
+}
+
+#endif // CONFIG_LEDDISPLAY_DITHER_FRAMES > 1
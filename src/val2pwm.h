@@ -2,8 +2,29 @@
 #define __VAL2PWM_H__
 
 #include <stdint.h>
+#include <sdkconfig.h>
 
-// converts an 0-255 intensity value to an equivalent  0-255 LED PWM value
+// converts an 0-255 intensity value to an equivalent 0..(2^bits-1) LED PWM value
+uint8_t val2pwm_bits(const uint8_t val, const int bits);
+
+// initialise the look-up table for val2pwm()
+void val2pwm_init(void);
+
+// converts an 0-255 intensity value to an equivalent LED PWM value for the configured colour depth
+// (CONFIG_LEDDISPLAY_COLOR_DEPTH), i.e. 0..255 for 8 bits, 0..63 for 6 bits, etc.
 uint8_t val2pwm(const uint8_t val);
 
+#if CONFIG_LEDDISPLAY_DITHER_FRAMES > 1
+// converts an 0-255 intensity value to an equivalent LED PWM value for the configured colour depth
+// times the number of dithering sub-frames (CONFIG_LEDDISPLAY_DITHER_FRAMES), i.e. the sum of
+// the PWM values to output in the sub-frames (0..255 * 4 for 8 bits and 4 sub-frames, etc.)
+uint16_t val2pwm_dither_bits(const uint8_t val, const int bits, const int frames);
+
+// initialise the look-up table for val2pwm_dither()
+void val2pwm_dither_init(void);
+
+// val2pwm_dither_bits() for the configured colour depth and number of sub-frames
+uint16_t val2pwm_dither(const uint8_t val);
+#endif
+
 #endif // __VAL2PWM_H__